@@ -62,7 +62,12 @@ def get_version():
 
 def read_network(path_to_xml : str, path_to_bin : str):
     cdef IENetwork net = IENetwork()
-    net.impl = C.read_network(path_to_xml.encode(), path_to_bin.encode())
+    cdef string c_path_to_xml = path_to_xml.encode()
+    cdef string c_path_to_bin = path_to_bin.encode()
+    cdef C.IENetwork c_net
+    with nogil:
+        c_net = C.read_network(c_path_to_xml, c_path_to_bin)
+    net.impl = c_net
     return net
 
 
@@ -323,12 +328,17 @@ cdef class IECore:
     #  ```
     cpdef IENetwork read_network(self, model: [str, bytes, os.PathLike], weights: [str, bytes, os.PathLike] = "", init_from_buffer: bool = False):
         cdef uint8_t*bin_buffer
+        cdef size_t bin_size
         cdef string weights_
         cdef string model_
+        cdef C.IENetwork c_net
         cdef IENetwork net = IENetwork()
         if init_from_buffer:
             model_ = bytes(model)
-            net.impl = self.impl.readNetwork(model_, weights, len(weights))
+            bin_buffer = <uint8_t*> weights
+            bin_size = len(weights)
+            with nogil:
+                c_net = self.impl.readNetwork(model_, bin_buffer, bin_size)
         else:
             weights_ = "".encode()
 
@@ -343,7 +353,9 @@ cdef class IECore:
                     raise Exception(f"Path to the weights {weights} doesn't exist or it's a directory")
                 weights_ = weights.encode()
 
-            net.impl = self.impl.readNetwork(model_, weights_)
+            with nogil:
+                c_net = self.impl.readNetwork(model_, weights_)
+        net.impl = c_net
         return net
 
     ## Loads a network that was read from the Intermediate Representation (IR) to the plugin with specified device name
@@ -367,6 +379,9 @@ cdef class IECore:
     cpdef ExecutableNetwork load_network(self, network: [IENetwork, str], str device_name, config=None, int num_requests=1):
         cdef ExecutableNetwork exec_net = ExecutableNetwork()
         cdef map[string, string] c_config
+        cdef string c_device_name = device_name.encode()
+        cdef string c_model_path
+        cdef C.IENetwork c_network
         if num_requests < 0:
             raise ValueError(f"Incorrect number of requests specified: {num_requests}. Expected positive integer number "
                              "or zero for auto detection")
@@ -374,9 +389,13 @@ cdef class IECore:
             c_config = dict_to_c_map(config)
         exec_net.ie_core_impl = self.impl
         if isinstance(network, str):
-            exec_net.impl = move(self.impl.loadNetworkFromFile((<str>network).encode(), device_name.encode(), c_config, num_requests))
+            c_model_path = (<str>network).encode()
+            with nogil:
+                exec_net.impl = move(self.impl.loadNetworkFromFile(c_model_path, c_device_name, c_config, num_requests))
         else:
-            exec_net.impl = move(self.impl.loadNetwork((<IENetwork>network).impl, device_name.encode(), c_config, num_requests))
+            c_network = (<IENetwork>network).impl
+            with nogil:
+                exec_net.impl = move(self.impl.loadNetwork(c_network, c_device_name, c_config, num_requests))
         return exec_net
 
     ## Creates an executable network from a previously exported network
@@ -400,13 +419,16 @@ cdef class IECore:
     cpdef ExecutableNetwork import_network(self, str model_file, str device_name, config=None, int num_requests=1):
         cdef ExecutableNetwork exec_net = ExecutableNetwork()
         cdef map[string, string] c_config
+        cdef string c_model_file = model_file.encode()
+        cdef string c_device_name = device_name.encode()
         if num_requests < 0:
             raise ValueError(f"Incorrect number of requests specified: {num_requests}. Expected positive integer number "
                              "or zero for auto detection")
         if config:
             c_config = dict_to_c_map(config)
         exec_net.ie_core_impl = self.impl
-        exec_net.impl = move(self.impl.importNetwork(model_file.encode(), device_name.encode(), c_config, num_requests))
+        with nogil:
+            exec_net.impl = move(self.impl.importNetwork(c_model_file, c_device_name, c_config, num_requests))
         return exec_net
 
     ## Queries the plugin with specified device name what network layers are supported in the current configuration.
@@ -850,6 +872,8 @@ cdef class ExecutableNetwork:
     #  Wraps `infer()` method of the `InferRequest` class
     #  @param inputs:  A dictionary that maps input layer names to `numpy.ndarray` objects of proper shape with
     #                  input data for the layer
+    #  @param copy: If `False`, returned arrays are views of the output Blobs of the first infer request,
+    #               see `get_output_buffers()` method of the `InferRequest` class
     #  @return A dictionary that maps output layer names to `numpy.ndarray` objects with output data of the layer
     #
     #  Usage example:\n
@@ -866,13 +890,10 @@ cdef class ExecutableNetwork:
     #                  ......
     #                 ]])}
     #  ```
-    def infer(self, inputs=None):
+    def infer(self, inputs=None, copy=True):
         current_request = self.requests[0]
         current_request.infer(inputs)
-        res = {}
-        for name, value in current_request.output_blobs.items():
-            res[name] = deepcopy(value.buffer)
-        return res
+        return current_request.get_output_buffers(copy)
 
     ## Starts asynchronous inference for specified infer request.
     #  Wraps `async_infer()` method of the `InferRequest` class.
@@ -1022,11 +1043,18 @@ cdef class ExecutableNetwork:
     #                  If not specified, `timeout` value is set to -1 by default.
     #  @return Request status code: OK or RESULT_NOT_READY
     cpdef wait(self, num_requests=None, timeout=None):
+        cdef int c_num_requests
+        cdef int64_t c_timeout
+        cdef int status
         if num_requests is None:
             num_requests = len(self.requests)
         if timeout is None:
             timeout = WaitMode.RESULT_READY
-        return deref(self.impl).wait(<int> num_requests, <int64_t> timeout)
+        c_num_requests = <int> num_requests
+        c_timeout = <int64_t> timeout
+        with nogil:
+            status = deref(self.impl).wait(c_num_requests, c_timeout)
+        return status
 
     ## Get idle request ID
     #  @return Request index
@@ -1111,6 +1139,31 @@ cdef class InferRequest:
             output_blobs[output] = deepcopy(blob)
         return output_blobs
 
+    ## Gets output data of the infer request
+    #
+    #  \note Views returned with `copy=False` keep the output Blobs alive, but the data they point to is
+    #        overwritten by the next inference of this request and is undefined while the request is running.
+    #        Copy the data you need before starting the request again. The `ExecutableNetwork` that owns
+    #        the request must outlive the views.
+    #
+    #  @param copy: If `True`, the arrays hold copies of the output data. If `False`, the arrays alias
+    #               memory of the output Blobs, no data is copied.
+    #  @return A dictionary that maps output layer names to `numpy.ndarray` objects with output data of the layer
+    #
+    #  Usage example:\n
+    #  ```python
+    #  request = exec_net.requests[0]
+    #  request.infer({input_blob: image})
+    #  res = request.get_output_buffers(copy=False)['prob']
+    #  top = np.argmax(res)
+    #  ```
+    def get_output_buffers(self, copy=True):
+        outputs = {}
+        for output in self._outputs_list:
+            buffer = self._get_blob_buffer(output.encode()).to_numpy()
+            outputs[output] = buffer.copy() if copy else buffer
+        return outputs
+
     ## Dictionary that maps input layer names to corresponding preprocessing information
     @property
     def preprocess_info(self):
@@ -1178,7 +1231,8 @@ cdef class InferRequest:
         if inputs is not None:
             self._fill_inputs(inputs)
 
-        deref(self.impl).infer()
+        with nogil:
+            deref(self.impl).infer()
 
     ## Starts asynchronous inference of the infer request and fill outputs array
     #
@@ -1213,6 +1267,8 @@ cdef class InferRequest:
     #
     #  Usage example: See `async_infer()` method of the the `InferRequest` class.
     cpdef wait(self, timeout=None):
+        cdef int64_t c_timeout
+        cdef int status
         if self._py_callback_used:
             # check request status to avoid blocking for idle requests
             status = deref(self.impl).wait(WaitMode.STATUS_ONLY)
@@ -1231,7 +1287,10 @@ cdef class InferRequest:
         if timeout is None:
             timeout = WaitMode.RESULT_READY
 
-        return deref(self.impl).wait(<int64_t> timeout)
+        c_timeout = <int64_t> timeout
+        with nogil:
+            status = deref(self.impl).wait(c_timeout)
+        return status
 
     ## Queries performance measures per layer to get feedback of what is the most time consuming layer.
     #
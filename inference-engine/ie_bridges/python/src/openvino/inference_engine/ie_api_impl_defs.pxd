@@ -160,7 +160,7 @@ cdef extern from "ie_api_impl.hpp" namespace "InferenceEnginePython":
         void exportNetwork(const string & model_file) except +
         object getMetric(const string & metric_name) except +
         object getConfig(const string & metric_name) except +
-        int wait(int num_requests, int64_t timeout)
+        int wait(int num_requests, int64_t timeout) nogil
         int getIdleRequestId()
         shared_ptr[CExecutableNetwork] getPluginLink() except +
 
@@ -195,9 +195,9 @@ cdef extern from "ie_api_impl.hpp" namespace "InferenceEnginePython":
         void setBlob(const string &blob_name, const CBlob.Ptr &blob_ptr, CPreProcessInfo& info) except +
         const CPreProcessInfo& getPreProcess(const string& blob_name) except +
         map[string, ProfileInfo] getPerformanceCounts() except +
-        void infer() except +
+        void infer() nogil except +
         void infer_async() except +
-        int wait(int64_t timeout) except +
+        int wait(int64_t timeout) nogil except +
         void setBatch(int size) except +
         void setCyCallback(void (*)(void*, int), void *) except +
         vector[CVariableState] queryState() except +
@@ -206,14 +206,14 @@ cdef extern from "ie_api_impl.hpp" namespace "InferenceEnginePython":
         IECore() except +
         IECore(const string & xml_config_file) except +
         map[string, Version] getVersions(const string & deviceName) except +
-        IENetwork readNetwork(const string& modelPath, const string& binPath) except +
-        IENetwork readNetwork(const string& modelPath,uint8_t*bin, size_t bin_size) except +
+        IENetwork readNetwork(const string& modelPath, const string& binPath) nogil except +
+        IENetwork readNetwork(const string& modelPath,uint8_t*bin, size_t bin_size) nogil except +
         unique_ptr[IEExecNetwork] loadNetwork(IENetwork network, const string deviceName,
-                                              const map[string, string] & config, int num_requests) except +
+                                              const map[string, string] & config, int num_requests) nogil except +
         unique_ptr[IEExecNetwork] loadNetworkFromFile(const string & modelPath, const string & deviceName,
-                                              const map[string, string] & config, int num_requests) except +
+                                              const map[string, string] & config, int num_requests) nogil except +
         unique_ptr[IEExecNetwork] importNetwork(const string & modelFIle, const string & deviceName,
-                                                const map[string, string] & config, int num_requests) except +
+                                                const map[string, string] & config, int num_requests) nogil except +
         map[string, string] queryNetwork(IENetwork network, const string deviceName,
                                          const map[string, string] & config) except +
         void setConfig(const map[string, string] & config, const string & deviceName) except +
@@ -229,4 +229,4 @@ cdef extern from "ie_api_impl.hpp" namespace "InferenceEnginePython":
 
     cdef string get_version()
 
-    cdef IENetwork read_network(string path_to_xml, string path_to_bin)
+    cdef IENetwork read_network(string path_to_xml, string path_to_bin) nogil except +
@@ -181,6 +181,48 @@ def test_infer(device):
     del net
 
 
+def test_get_output_buffers(device):
+    ie_core = ie.IECore()
+    net = ie_core.read_network(test_net_xml, test_net_bin)
+    exec_net = ie_core.load_network(net, device, num_requests=1)
+    img = read_image()
+    request = exec_net.requests[0]
+    request.infer({'data': img})
+    copied = request.get_output_buffers()['fc_out']
+    view = request.get_output_buffers(copy=False)['fc_out']
+    assert np.argmax(copied) == 2
+    assert np.array_equal(copied, view)
+    assert np.shares_memory(view, request.get_output_buffers(copy=False)['fc_out'])
+    assert not np.shares_memory(copied, view)
+    del exec_net
+    del ie_core
+    del net
+
+
+def test_infer_in_threads(device):
+    ie_core = ie.IECore()
+    net = ie_core.read_network(test_net_xml, test_net_bin)
+    exec_net = ie_core.load_network(net, device, num_requests=4)
+    img = read_image()
+    results = [None] * len(exec_net.requests)
+
+    def run(request_id):
+        request = exec_net.requests[request_id]
+        for _ in range(10):
+            request.infer({'data': img})
+        results[request_id] = np.argmax(request.get_output_buffers()['fc_out'])
+
+    threads = [threading.Thread(target=run, args=(i,)) for i in range(len(exec_net.requests))]
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+    assert results == [2] * len(exec_net.requests)
+    del exec_net
+    del ie_core
+    del net
+
+
 def test_async_infer_default_timeout(device):
     ie_core = ie.IECore()
     net = ie_core.read_network(test_net_xml, test_net_bin)
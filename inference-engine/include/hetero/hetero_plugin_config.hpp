@@ -34,5 +34,13 @@ namespace HeteroConfigParams {
  */
 DECLARE_HETERO_CONFIG_KEY(DUMP_GRAPH_DOT);
 
+/**
+ * @brief The key for enabling of pipeline parallel execution of subgraphs. Each subgraph is executed by its own
+ * pool of device infer requests shared by all HETERO infer requests, so subgraphs of different HETERO requests overlap.
+ * Exclusive asynchronous requests are not applied to the devices in this mode.
+ * This option should be used with values: CONFIG_VALUE(NO) (default) or CONFIG_VALUE(YES)
+ */
+DECLARE_HETERO_CONFIG_KEY(PIPELINE_PARALLEL);
+
 }  // namespace HeteroConfigParams
 }  // namespace InferenceEngine
@@ -254,6 +254,21 @@ DECLARE_CONFIG_KEY(CPU_BIND_THREAD);
 DECLARE_CONFIG_VALUE(NUMA);
 DECLARE_CONFIG_VALUE(HYBRID_AWARE);
 
+/**
+ * @brief The key enables automatic batching of asynchronous infer requests on the CPU.
+ *
+ * Concurrent StartAsync() calls of different infer requests of the executable network are collected
+ * and inferred together as one batch. The value is the maximum number of requests in the batch,
+ * 0 or 1 disables the mode. The network must have batch 1 and no states.
+ */
+DECLARE_CONFIG_KEY(CPU_AUTO_BATCH_SIZE);
+
+/**
+ * @brief The key defines how long (in milliseconds) the first collected request waits for other requests
+ * before the incomplete batch is inferred. It is used with KEY_CPU_AUTO_BATCH_SIZE, the default value is 1.
+ */
+DECLARE_CONFIG_KEY(CPU_AUTO_BATCH_TIMEOUT);
+
 /**
  * @brief Optimize CPU execution to maximize throughput.
  *
@@ -268,6 +283,26 @@ DECLARE_CONFIG_KEY(CPU_THROUGHPUT_STREAMS);
 DECLARE_CONFIG_VALUE(CPU_THROUGHPUT_NUMA);
 DECLARE_CONFIG_VALUE(CPU_THROUGHPUT_AUTO);
 
+/**
+ * @brief High-level performance hint, the plugin selects its low-level settings (e.g. the number of streams and threads)
+ * for the given network and the target machine.
+ *
+ * It is passed to Core::SetConfig() or Core::LoadNetwork(), this option should be used with values:
+ * - PluginConfigParams::LATENCY minimizes the time of a single inference
+ * - PluginConfigParams::THROUGHPUT maximizes the number of inferences per second with several infer requests in flight
+ * Explicitly set low-level options (e.g. KEY_CPU_THROUGHPUT_STREAMS) take precedence over the hint.
+ */
+DECLARE_CONFIG_KEY(PERFORMANCE_HINT);
+DECLARE_CONFIG_VALUE(LATENCY);
+DECLARE_CONFIG_VALUE(THROUGHPUT);
+
+/**
+ * @brief The expected number of infer requests the application runs in parallel.
+ *
+ * It is used with PluginConfigParams::THROUGHPUT hint to limit the number of streams, 0 (default) means no limit.
+ */
+DECLARE_CONFIG_KEY(PERFORMANCE_HINT_NUM_REQUESTS);
+
 /**
  * @brief The name for setting performance counters option.
  *
@@ -381,6 +416,33 @@ DECLARE_CONFIG_KEY(ENFORCE_BF16);
  */
 DECLARE_CONFIG_KEY(CACHE_DIR);
 
+/**
+ * @brief This key limits the total size in bytes of compiled network blobs kept in CACHE_DIR by the Core.
+ *
+ * When the limit is exceeded after a new blob is written, least recently used blobs are removed.
+ * Blobs which are still being written count towards the limit, the ones left by crashed processes are removed.
+ * Value "0" (default) means the cache is not limited. The key is set for the Core only:
+ *
+ * @code
+ * ie.SetConfig({{CONFIG_KEY(CACHE_DIR), "cache/"}, {CONFIG_KEY(CACHE_MAX_SIZE), "1073741824"}});
+ * @endcode
+ */
+DECLARE_CONFIG_KEY(CACHE_MAX_SIZE);
+
+/**
+ * @brief This key enables memory mapping of model weights files read by Core::ReadNetwork.
+ * Possible values: CONFIG_VALUE(YES) or CONFIG_VALUE(NO) (default).
+ *
+ * Weights are not copied into a newly allocated buffer: constants of the read network refer to the mapped file,
+ * so its pages are loaded on first access and are shared by all processes reading the same model.
+ * The key is set for the Core only:
+ *
+ * @code
+ * ie.SetConfig({{CONFIG_KEY(ENABLE_MMAP), CONFIG_VALUE(YES)}});
+ * @endcode
+ */
+DECLARE_CONFIG_KEY(ENABLE_MMAP);
+
 }  // namespace PluginConfigParams
 
 /**
@@ -40,6 +40,17 @@ static const char infer_requests_count_message[] = "Optional. Number of infer re
 /// @brief message for execution time
 static const char execution_time_message[] = "Optional. Time in seconds to execute topology.";
 
+/// @brief message for open-loop request rate
+static const char qps_message[] = "Optional. Target number of requests per second. If set, requests are started at this rate "
+                                  "(open loop) instead of being resubmitted as soon as one is idle, and the latency of a request is "
+                                  "counted from its scheduled start time. Default value is 0 (closed loop).";
+/// @brief message for arrival distribution
+static const char arrival_message[] = "Optional. Distribution of request arrivals in the open-loop mode: \"fixed\" intervals or "
+                                      "\"poisson\" process. Default value is \"fixed\".";
+/// @brief message for QPS sweep
+static const char qps_sweep_message[] = "Optional. Runs the open-loop measurement for every rate of \"<start>:<stop>:<step>\" "
+                                        "requests per second and reports the highest rate the device sustains. Each rate is measured "
+                                        "for -t seconds or -niter iterations.";
 /// @brief message for #threads for CPU inference
 static const char infer_num_threads_message[] = "Optional. Number of threads to use for inference on the CPU "
                                                 "(including HETERO and MULTI cases).";
@@ -182,6 +193,12 @@ DEFINE_uint32(t, 0, execution_time_message);
 /// @brief Number of infer requests in parallel
 DEFINE_uint32(nireq, 0, infer_requests_count_message);
 
+/// @brief Target request rate of the open-loop mode, 0 means closed loop
+DEFINE_double(qps, 0.0, qps_message);
+/// @brief Distribution of request arrivals in the open-loop mode
+DEFINE_string(arrival, "fixed", arrival_message);
+/// @brief Range of request rates for the open-loop sweep
+DEFINE_string(qps_sweep, "", qps_sweep_message);
 /// @brief Number of threads to use for inference on the CPU in throughput mode (also affects Hetero
 /// cases)
 DEFINE_uint32(nthreads, 0, infer_num_threads_message);
@@ -273,6 +290,9 @@ static void showUsage() {
     std::cout << "    -b \"<integer>\"            " << batch_size_message << std::endl;
     std::cout << "    -stream_output            " << stream_output_message << std::endl;
     std::cout << "    -t                        " << execution_time_message << std::endl;
+    std::cout << "    -qps \"<double>\"           " << qps_message << std::endl;
+    std::cout << "    -arrival \"fixed\"/\"poisson\" " << arrival_message << std::endl;
+    std::cout << "    -qps_sweep \"<s>:<e>:<d>\"  " << qps_sweep_message << std::endl;
     std::cout << "    -progress                 " << progress_message << std::endl;
     std::cout << "    -shape                    " << shape_message << std::endl;
     std::cout << "    -layout                   " << layout_message << std::endl;
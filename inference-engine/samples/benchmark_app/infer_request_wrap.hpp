@@ -13,6 +13,7 @@
 #include <memory>
 #include <mutex>
 #include <queue>
+#include <random>
 #include <string>
 #include <vector>
 
@@ -39,7 +40,13 @@ public:
     }
 
     void startAsync() {
-        _startTime = Time::now();
+        startAsync(Time::now());
+    }
+
+    /// @brief Starts the request which was scheduled to start at scheduledTime. The latency is counted from
+    /// the scheduled time, so the time spent waiting for an idle request is included.
+    void startAsync(Time::time_point scheduledTime) {
+        _startTime = scheduledTime;
         _request.StartAsync();
     }
 
@@ -48,7 +55,11 @@ public:
     }
 
     void infer() {
-        _startTime = Time::now();
+        infer(Time::now());
+    }
+
+    void infer(Time::time_point scheduledTime) {
+        _startTime = scheduledTime;
         _request.Infer();
         _endTime = Time::now();
         _callbackQueue(_id, getExecutionTimeInMilliseconds());
@@ -144,3 +155,28 @@ private:
     Time::time_point _endTime;
     std::vector<double> _latencies;
 };
+
+/// @brief Generates start times of requests for the open-loop mode: requests arrive at the given rate regardless
+/// of how fast they are processed. Intervals between arrivals are either fixed or exponentially distributed
+/// (Poisson process). The generator is seeded with a constant, so runs are reproducible.
+class ArrivalSchedule final {
+public:
+    ArrivalSchedule(double qps, bool poisson, Time::time_point startTime)
+        : _poisson(poisson), _interval(1.0e9 / qps), _intervals(qps * 1.0e-9), _startTime(startTime) {}
+
+    /// @brief Returns the arrival time of the next request
+    Time::time_point next() {
+        // Time is accumulated in double and counted from the start, so rounding errors don't drift the rate
+        auto arrival = _startTime + ns(static_cast<ns::rep>(_elapsed));
+        _elapsed += _poisson ? _intervals(_generator) : _interval;
+        return arrival;
+    }
+
+private:
+    bool _poisson;
+    double _interval;
+    std::exponential_distribution<double> _intervals;
+    std::mt19937_64 _generator;
+    Time::time_point _startTime;
+    double _elapsed = 0.0;
+};
@@ -13,6 +13,7 @@
 #include <samples/common.hpp>
 #include <samples/slog.hpp>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 #include <vpu/vpu_plugin_config.hpp>
@@ -66,6 +67,21 @@ bool ParseAndCheckCommandLine(int argc, char* argv[]) {
         throw std::logic_error("only " + std::string(detailedCntReport) + " report type is supported for MULTI device");
     }
 
+    if (FLAGS_qps < 0) {
+        throw std::logic_error("Incorrect QPS. Please set -qps option to a positive value or 0 for closed loop.");
+    }
+
+    if (FLAGS_arrival != "fixed" && FLAGS_arrival != "poisson") {
+        throw std::logic_error("Incorrect arrival distribution. Please set -arrival option to `fixed` or `poisson` value.");
+    }
+
+    if (!FLAGS_qps_sweep.empty()) {
+        if (FLAGS_qps > 0) {
+            throw std::logic_error("-qps and -qps_sweep options can't be used together.");
+        }
+        parseQpsSweep(FLAGS_qps_sweep);
+    }
+
     bool isNetworkCompiled = fileExt(FLAGS_m) == "blob";
     bool isPrecisionSet = !(FLAGS_ip.empty() && FLAGS_op.empty() && FLAGS_iop.empty());
     if (isNetworkCompiled && isPrecisionSet) {
@@ -99,12 +115,79 @@ static void next_step(const std::string additional_info = "") {
               << (additional_info.empty() ? "" : " (" + additional_info + ")") << std::endl;
 }
 
-template <typename T>
-T getMedianValue(const std::vector<T>& vec) {
-    std::vector<T> sortedVec(vec);
-    std::sort(sortedVec.begin(), sortedVec.end());
-    return (sortedVec.size() % 2 != 0) ? sortedVec[sortedVec.size() / 2ULL]
-                                       : (sortedVec[sortedVec.size() / 2ULL] + sortedVec[sortedVec.size() / 2ULL - 1ULL]) / static_cast<T>(2.0);
+/**
+ * @brief Runs inference until the iterations or time limit is reached
+ * If qps is 0, an idle request is resubmitted immediately (closed loop). Otherwise requests are started on the arrival
+ * schedule (open loop): when all of them are busy, the next arrival waits for an idle one and the waiting time is
+ * included into its latency.
+ * @return number of executed iterations
+ */
+static size_t runInference(InferRequestsQueue& inferRequestsQueue, uint32_t nireq, uint32_t niter, uint64_t duration_nanoseconds, double qps,
+                           ProgressBar& progressBar, size_t progressBarTotalCount) {
+    const bool openLoop = qps > 0;
+    size_t progressCnt = 0;
+    size_t iteration = 0;
+
+    auto startTime = Time::now();
+    auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
+    std::unique_ptr<ArrivalSchedule> schedule;
+    if (openLoop) {
+        schedule.reset(new ArrivalSchedule(qps, FLAGS_arrival == "poisson", startTime));
+    }
+
+    /** Start inference & calculate performance **/
+    /** to align number if iterations to guarantee that last infer requests are
+     * executed in the same conditions **/
+    while ((niter != 0LL && iteration < niter) || (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
+           (!openLoop && FLAGS_api == "async" && iteration % nireq != 0)) {
+        auto scheduledTime = Time::now();
+        if (openLoop) {
+            scheduledTime = schedule->next();
+            if (duration_nanoseconds != 0LL && niter == 0LL &&
+                (uint64_t)std::chrono::duration_cast<ns>(scheduledTime - startTime).count() >= duration_nanoseconds) {
+                break;
+            }
+            std::this_thread::sleep_until(scheduledTime);
+        }
+
+        auto inferRequest = inferRequestsQueue.getIdleRequest();
+        if (!inferRequest) {
+            IE_THROW() << "No idle Infer Requests!";
+        }
+
+        if (FLAGS_api == "sync") {
+            inferRequest->infer(scheduledTime);
+        } else {
+            // As the inference request is currently idle, the wait() adds no
+            // additional overhead (and should return immediately). The primary
+            // reason for calling the method is exception checking/re-throwing.
+            // Callback, that governs the actual execution can handle errors as
+            // well, but as it uses just error codes it has no details like ‘what()’
+            // method of `std::exception` So, rechecking for any exceptions here.
+            inferRequest->wait();
+            inferRequest->startAsync(scheduledTime);
+        }
+        iteration++;
+
+        execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
+
+        if (niter > 0) {
+            progressBar.addProgress(1);
+        } else {
+            // calculate how many progress intervals are covered by current
+            // iteration. depends on the current iteration time and time of each
+            // progress interval. Previously covered progress intervals must be
+            // skipped.
+            auto progressIntervalTime = duration_nanoseconds / progressBarTotalCount;
+            size_t newProgress = execTime / progressIntervalTime - progressCnt;
+            progressBar.addProgress(newProgress);
+            progressCnt += newProgress;
+        }
+    }
+
+    // wait the latest inference executions
+    inferRequestsQueue.waitAll();
+    return iteration;
 }
 
 /**
@@ -473,7 +556,8 @@ int main(int argc, char* argv[]) {
 
         // Iteration limit
         uint32_t niter = FLAGS_niter;
-        if ((niter > 0) && (FLAGS_api == "async")) {
+        const bool openLoop = FLAGS_qps > 0 || !FLAGS_qps_sweep.empty();
+        if ((niter > 0) && (FLAGS_api == "async") && !openLoop) {
             niter = ((niter + nireq - 1) / nireq) * nireq;
             if (FLAGS_niter != niter) {
                 slog::warn << "Number of iterations was aligned by request number from " << FLAGS_niter << " to " << niter << " using number of requests "
@@ -522,9 +606,9 @@ int main(int argc, char* argv[]) {
 
         // ----------------- 10. Measuring performance
         // ------------------------------------------------------------------
-        size_t progressCnt = 0;
         size_t progressBarTotalCount = progressBarDefaultTotalCount;
         size_t iteration = 0;
+        const std::vector<double> sweepQps = FLAGS_qps_sweep.empty() ? std::vector<double> {FLAGS_qps} : parseQpsSweep(FLAGS_qps_sweep);
 
         std::stringstream ss;
         ss << "Start inference " << FLAGS_api << "hronously";
@@ -557,6 +641,14 @@ int main(int argc, char* argv[]) {
             }
             ss << niter << " iterations";
         }
+        if (openLoop) {
+            ss << ", " << FLAGS_arrival << " arrivals at ";
+            if (FLAGS_qps_sweep.empty()) {
+                ss << FLAGS_qps << " requests per second";
+            } else {
+                ss << FLAGS_qps_sweep << " requests per second sweep";
+            }
+        }
         next_step(ss.str());
 
         // warming up - out of scope
@@ -576,57 +668,38 @@ int main(int argc, char* argv[]) {
             statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS, {{"first inference time (ms)", duration_ms}});
         inferRequestsQueue.resetTimes();
 
-        auto startTime = Time::now();
-        auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
-
-        /** Start inference & calculate performance **/
-        /** to align number if iterations to guarantee that last infer requests are
-         * executed in the same conditions **/
-        ProgressBar progressBar(progressBarTotalCount, FLAGS_stream_output, FLAGS_progress);
-
-        while ((niter != 0LL && iteration < niter) || (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
-               (FLAGS_api == "async" && iteration % nireq != 0)) {
-            inferRequest = inferRequestsQueue.getIdleRequest();
-            if (!inferRequest) {
-                IE_THROW() << "No idle Infer Requests!";
-            }
-
-            if (FLAGS_api == "sync") {
-                inferRequest->infer();
-            } else {
-                // As the inference request is currently idle, the wait() adds no
-                // additional overhead (and should return immediately). The primary
-                // reason for calling the method is exception checking/re-throwing.
-                // Callback, that governs the actual execution can handle errors as
-                // well, but as it uses just error codes it has no details like ‘what()’
-                // method of `std::exception` So, rechecking for any exceptions here.
-                inferRequest->wait();
-                inferRequest->startAsync();
-            }
-            iteration++;
-
-            execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
-
-            if (niter > 0) {
-                progressBar.addProgress(1);
+        double totalDuration = 0.0;
+        LatencyMetrics latency;
+        StatisticsReport::Table sweepTable;
+        double saturationQps = 0.0;
+        bool saturated = false;
+        for (const auto qps : sweepQps) {
+            ProgressBar progressBar(progressBarTotalCount, FLAGS_stream_output, FLAGS_progress);
+            inferRequestsQueue.resetTimes();
+            iteration = runInference(inferRequestsQueue, nireq, niter, duration_nanoseconds, qps, progressBar, progressBarTotalCount);
+            progressBar.finish();
+
+            latency = LatencyMetrics(inferRequestsQueue.getLatencies());
+            totalDuration = inferRequestsQueue.getDurationInMilliseconds();
+            if (FLAGS_qps_sweep.empty())
+                break;
+
+            // The device keeps up with the rate while it completes requests as fast as they arrive,
+            // otherwise the queue grows and the latency is dominated by waiting
+            const double achievedQps = iteration * 1000.0 / totalDuration;
+            if (!saturated && achievedQps >= 0.95 * qps) {
+                saturationQps = qps;
             } else {
-                // calculate how many progress intervals are covered by current
-                // iteration. depends on the current iteration time and time of each
-                // progress interval. Previously covered progress intervals must be
-                // skipped.
-                auto progressIntervalTime = duration_nanoseconds / progressBarTotalCount;
-                size_t newProgress = execTime / progressIntervalTime - progressCnt;
-                progressBar.addProgress(newProgress);
-                progressCnt += newProgress;
+                saturated = true;
             }
+            slog::info << "QPS " << double_to_string(qps) << ": achieved " << double_to_string(achievedQps) << ", latency p50 "
+                       << double_to_string(latency.median) << " ms, p99 " << double_to_string(latency.p99) << " ms, p99.9 "
+                       << double_to_string(latency.p999) << " ms" << slog::endl;
+            sweepTable.push_back({double_to_string(qps), double_to_string(achievedQps), double_to_string(latency.median), double_to_string(latency.p90),
+                                  double_to_string(latency.p99), double_to_string(latency.p999)});
         }
 
-        // wait the latest inference executions
-        inferRequestsQueue.waitAll();
-
-        double latency = getMedianValue<double>(inferRequestsQueue.getLatencies());
-        double totalDuration = inferRequestsQueue.getDurationInMilliseconds();
-        double fps = (FLAGS_api == "sync") ? batchSize * 1000.0 / latency : batchSize * 1000.0 * iteration / totalDuration;
+        double fps = (FLAGS_api == "sync" && !openLoop) ? batchSize * 1000.0 / latency.median : batchSize * 1000.0 * iteration / totalDuration;
 
         if (statistics) {
             statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS, {
@@ -635,14 +708,27 @@ int main(int argc, char* argv[]) {
                                                                                      });
             if (device_name.find("MULTI") == std::string::npos) {
                 statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS, {
-                                                                                             {"latency (ms)", double_to_string(latency)},
+                                                                                             {"latency (ms)", double_to_string(latency.median)},
+                                                                                             {"latency avg (ms)", double_to_string(latency.average)},
+                                                                                             {"latency min (ms)", double_to_string(latency.min)},
+                                                                                             {"latency max (ms)", double_to_string(latency.max)},
+                                                                                             {"latency p90 (ms)", double_to_string(latency.p90)},
+                                                                                             {"latency p99 (ms)", double_to_string(latency.p99)},
+                                                                                             {"latency p99.9 (ms)", double_to_string(latency.p999)},
                                                                                          });
+                StatisticsReport::Table histogram = {{"latency upper bound (ms)", "count"}};
+                for (const auto& bucket : latency.histogram)
+                    histogram.push_back({double_to_string(bucket.first), std::to_string(bucket.second)});
+                statistics->addTableRows(StatisticsReport::Category::LATENCY_HISTOGRAM, histogram);
             }
             statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS, {{"throughput", double_to_string(fps)}});
+            if (!sweepTable.empty()) {
+                statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS, {{"saturation QPS", double_to_string(saturationQps)}});
+                sweepTable.insert(sweepTable.begin(), {"target QPS", "achieved QPS", "p50 (ms)", "p90 (ms)", "p99 (ms)", "p99.9 (ms)"});
+                statistics->addTableRows(StatisticsReport::Category::QPS_SWEEP, sweepTable);
+            }
         }
 
-        progressBar.finish();
-
         // ----------------- 11. Dumping statistics report
         // -------------------------------------------------------------
         next_step();
@@ -684,9 +770,19 @@ int main(int argc, char* argv[]) {
 
         std::cout << "Count:      " << iteration << " iterations" << std::endl;
         std::cout << "Duration:   " << double_to_string(totalDuration) << " ms" << std::endl;
-        if (device_name.find("MULTI") == std::string::npos)
-            std::cout << "Latency:    " << double_to_string(latency) << " ms" << std::endl;
+        if (device_name.find("MULTI") == std::string::npos) {
+            std::cout << "Latency:    " << double_to_string(latency.median) << " ms" << std::endl;
+            std::cout << "Latency percentiles: p90 " << double_to_string(latency.p90) << " ms, p99 " << double_to_string(latency.p99) << " ms, p99.9 "
+                      << double_to_string(latency.p999) << " ms" << std::endl;
+        }
         std::cout << "Throughput: " << double_to_string(fps) << " FPS" << std::endl;
+        if (!sweepTable.empty()) {
+            if (saturationQps > 0) {
+                std::cout << "Saturation: " << double_to_string(saturationQps) << " QPS" << std::endl;
+            } else {
+                std::cout << "Saturation: device doesn't sustain the lowest rate of the sweep" << std::endl;
+            }
+        }
     } catch (const std::exception& ex) {
         slog::err << ex.what() << slog::endl;
 
@@ -5,11 +5,45 @@
 #include "statistics_report.hpp"
 
 #include <algorithm>
+#include <cmath>
 #include <map>
+#include <numeric>
 #include <string>
 #include <utility>
 #include <vector>
 
+LatencyMetrics::LatencyMetrics(const std::vector<double>& latencies) {
+    if (latencies.empty())
+        return;
+    std::vector<double> sorted(latencies);
+    std::sort(sorted.begin(), sorted.end());
+
+    // nearest-rank percentile
+    auto percentile = [&sorted](double p) {
+        auto rank = static_cast<size_t>(std::ceil(p / 100.0 * sorted.size()));
+        return sorted[std::min(std::max<size_t>(rank, 1), sorted.size()) - 1];
+    };
+    min = sorted.front();
+    max = sorted.back();
+    average = std::accumulate(sorted.begin(), sorted.end(), 0.0) / sorted.size();
+    median = (sorted.size() % 2 != 0) ? sorted[sorted.size() / 2] : (sorted[sorted.size() / 2] + sorted[sorted.size() / 2 - 1]) / 2.0;
+    p90 = percentile(90.0);
+    p99 = percentile(99.0);
+    p999 = percentile(99.9);
+
+    const double low = std::max(min, 1.0e-3);
+    const size_t bucketsNum = max > low ? 20 : 1;
+    const double ratio = std::pow(std::max(max, low) / low, 1.0 / bucketsNum);
+    double bound = low;
+    auto it = sorted.begin();
+    for (size_t i = 0; i < bucketsNum && it != sorted.end(); i++) {
+        bound = (i + 1 == bucketsNum) ? max : bound * ratio;
+        auto end = std::upper_bound(it, sorted.end(), bound);
+        histogram.emplace_back(bound, static_cast<size_t>(end - it));
+        it = end;
+    }
+}
+
 void StatisticsReport::addParameters(const Category& category, const Parameters& parameters) {
     if (_parameters.count(category) == 0)
         _parameters[category] = parameters;
@@ -17,6 +51,11 @@ void StatisticsReport::addParameters(const Category& category, const Parameters&
         _parameters[category].insert(_parameters[category].end(), parameters.begin(), parameters.end());
 }
 
+void StatisticsReport::addTableRows(const Category& category, const Table& rows) {
+    auto& table = _tables[category];
+    table.insert(table.end(), rows.begin(), rows.end());
+}
+
 void StatisticsReport::dump() {
     CsvDumper dumper(true, _config.report_folder + _separator + "benchmark_report.csv");
 
@@ -50,6 +89,21 @@ void StatisticsReport::dump() {
         dumper.endLine();
     }
 
+    auto dump_table = [&](const Category& category, const std::string& title) {
+        if (_tables.count(category) == 0)
+            return;
+        dumper << title;
+        dumper.endLine();
+        for (const auto& row : _tables.at(category)) {
+            for (const auto& cell : row)
+                dumper << cell;
+            dumper.endLine();
+        }
+        dumper.endLine();
+    };
+    dump_table(Category::LATENCY_HISTOGRAM, "Latency histogram");
+    dump_table(Category::QPS_SWEEP, "QPS sweep");
+
     slog::info << "Statistics report is stored to " << dumper.getFilename() << slog::endl;
 }
 
@@ -18,11 +18,29 @@ static constexpr char noCntReport[] = "no_counters";
 static constexpr char averageCntReport[] = "average_counters";
 static constexpr char detailedCntReport[] = "detailed_counters";
 
+/// @brief Latency statistics of a measurement, all values are in milliseconds
+struct LatencyMetrics {
+    LatencyMetrics() = default;
+    explicit LatencyMetrics(const std::vector<double>& latencies);
+
+    double min = 0.0;
+    double average = 0.0;
+    double median = 0.0;
+    double max = 0.0;
+    double p90 = 0.0;
+    double p99 = 0.0;
+    double p999 = 0.0;
+    /// @brief Pairs of bucket upper bound and number of latencies in the bucket. Bounds grow geometrically
+    /// from min to max, so both the body and the tail of the distribution are visible.
+    std::vector<std::pair<double, size_t>> histogram;
+};
+
 /// @brief Responsible for collecting of statistics and dumping to .csv file
 class StatisticsReport {
 public:
     typedef std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> PerformaceCounters;
     typedef std::vector<std::pair<std::string, std::string>> Parameters;
+    typedef std::vector<std::vector<std::string>> Table;
 
     struct Config {
         std::string report_type;
@@ -33,6 +51,8 @@ public:
         COMMAND_LINE_PARAMETERS,
         RUNTIME_CONFIG,
         EXECUTION_RESULTS,
+        LATENCY_HISTOGRAM,
+        QPS_SWEEP,
     };
 
     explicit StatisticsReport(Config config): _config(std::move(config)) {
@@ -52,6 +72,9 @@ public:
 
     void addParameters(const Category& category, const Parameters& parameters);
 
+    /// @brief Adds rows of a table section, the first row added to a category is the header
+    void addTableRows(const Category& category, const Table& rows);
+
     void dump();
 
     void dumpPerformanceCounters(const std::vector<PerformaceCounters>& perfCounts);
@@ -65,6 +88,9 @@ private:
     // parameters
     std::map<Category, Parameters> _parameters;
 
+    // tables
+    std::map<Category, Table> _tables;
+
     // csv separator
     std::string _separator;
 };
@@ -88,6 +88,29 @@ std::vector<std::string> split(const std::string& s, char delim) {
     return result;
 }
 
+std::vector<double> parseQpsSweep(const std::string& range_string) {
+    //  Format: <start>:<stop>:<step>
+    auto values = split(range_string, ':');
+    if (values.size() != 3)
+        throw std::logic_error("Incorrect QPS sweep range '" + range_string + "'. Expected <start>:<stop>:<step>");
+    double start, stop, step;
+    try {
+        start = std::stod(values[0]);
+        stop = std::stod(values[1]);
+        step = std::stod(values[2]);
+    } catch (const std::exception&) {
+        throw std::logic_error("Incorrect QPS sweep range '" + range_string + "'. Values must be numbers");
+    }
+    if (start <= 0 || step <= 0 || stop < start)
+        throw std::logic_error("Incorrect QPS sweep range '" + range_string + "'. Expected 0 < start <= stop and step > 0");
+
+    std::vector<double> result;
+    // a small tolerance keeps the stop value when the range is not exactly representable
+    for (size_t i = 0; start + i * step <= stop + step * 1e-6; i++)
+        result.push_back(start + i * step);
+    return result;
+}
+
 std::vector<std::string> parseDevices(const std::string& device_string) {
     std::string comma_separated_devices = device_string;
     if (comma_separated_devices.find(":") != std::string::npos) {
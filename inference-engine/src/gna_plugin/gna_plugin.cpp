@@ -898,9 +898,22 @@ void GNAPlugin::LoadNetwork(CNNNetwork & _network) {
     }
 
     // CreatingLayer primitives
+    // in compact mode memory requests get indexes of layers in execution order, so scratch buffers
+    // of layers which are not executed at the same time can share memory
+    int executionIndex = 0;
     for (auto & layer : sortedNoMem) {
+        if (gnaFlags->compact_mode) {
+            // delayed copies are executed after all other layers
+            gnamem->set_life_index(LayerInfo(layer).isCopyDelayed() ? -1 : executionIndex++);
+        }
         graphCompiler.CreateLayerPrimitive(layer);
     }
+    gnamem->set_life_index(-1);
+
+    // state of memory layers is kept between inferences
+    for (auto && memoryConnection : graphCompiler.memory_connection) {
+        gnamem->keep_alive(&memoryConnection.second.gna_ptr);
+    }
 
     for (auto& inputLayer : inputLayers) {
         auto layerInfo = LayerInfo(inputLayer);
@@ -966,6 +979,10 @@ void GNAPlugin::LoadNetwork(CNNNetwork & _network) {
     }
 
     gnamem->commit();
+    if (gnaFlags->compact_mode) {
+        gnalog() << "GNA memory: " << gnamem->getTotalBytes() << " bytes, "
+                 << gnamem->getReusedBytes() << " bytes saved by sharing memory between layers\n";
+    }
 
     dnn->Init(gnamem->getBasePtr(),
              gnamem->getTotalBytes(),
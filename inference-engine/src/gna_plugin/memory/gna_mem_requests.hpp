@@ -40,6 +40,9 @@ struct MemRequest {
     size_t _offset = 0;
     // expansion in bytes due to large depended layers
     size_t _padding = 0;
+    // execution order indexes of the first and the last access, -1 means the data is accessed till the end of inference
+    int _life_start = 0;
+    int _life_finish = -1;
     MemRequest(rRegion region,
                 rType req,
                 void *ptr_out,
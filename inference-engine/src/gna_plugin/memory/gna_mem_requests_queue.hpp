@@ -8,6 +8,7 @@
 #include <vector>
 #include <algorithm>
 #include <functional>
+#include <utility>
 #include "gna_mem_requests.hpp"
 
 namespace GNAPluginNS {
@@ -52,7 +53,7 @@ public:
      * @param num_bytes
      */
     void reserve_ptr(void *ptr_out, size_t num_bytes, size_t alignment = 1)  {
-        futureHeap().push_back({regionType(), REQUEST_ALLOCATE, ptr_out, nullptr, 1, num_bytes, alignment});
+        push_with_lifetime({regionType(), REQUEST_ALLOCATE, ptr_out, nullptr, 1, num_bytes, alignment});
     }
 
     /**
@@ -64,7 +65,7 @@ public:
      *      if that happens - reserved request parameters will be updated before committing memory
      */
     void bind_ptr(void *source, const void *dest, size_t offset = 0, size_t num_bytes = 0)  {
-        futureHeap().push_back({regionType(), REQUEST_BIND, source, dest, 1, num_bytes, 1, offset});
+        push_with_lifetime({regionType(), REQUEST_BIND, source, dest, 1, num_bytes, 1, offset});
     }
 
     /**
@@ -84,12 +85,44 @@ public:
         futureHeap().push_back({regionType(), ptr_out, value, num_elements, alignment});
     }
 
+    /**
+     * @brief sets execution order index of the layer which accesses memory reserved or bound after that,
+     * -1 means the memory is accessed during the whole inference, that is the default
+     */
+    void set_life_index(int index) {
+        _life_index = index;
+    }
+
+    /**
+     * @brief makes memory reserved or bound to ptr_out alive during the whole inference and between inferences,
+     * ex. state of memory layers
+     */
+    void keep_alive(const void *ptr_out) {
+        for (auto &re : futureHeap()) {
+            if (re._ptr_out == ptr_out) {
+                re._life_start = 0;
+                re._life_finish = -1;
+            }
+        }
+    }
+
     /**
      * @brief interface for actual queue storage
      */
     virtual rRegion regionType() const = 0;
     virtual std::vector<MemRequest> & futureHeap()  = 0;
     virtual std::list<std::vector<char>> &localStorage() = 0;
+
+ private:
+    int _life_index = -1;
+
+    void push_with_lifetime(MemRequest && request) {
+        if (_life_index >= 0) {
+            request._life_start = _life_index;
+            request._life_finish = _life_index;
+        }
+        futureHeap().push_back(std::move(request));
+    }
 };
 }  // namespace memory
 }  // namespace GNAPluginNS
@@ -6,11 +6,13 @@
 
 #include "gna_mem_requests.hpp"
 #include <ie_memcpy.h>
+#include <memory_solver.hpp>
 #include "gna_mem_requests_queue.hpp"
 #include <cstdint>
 #include <memory>
 #include <vector>
 #include <list>
+#include <map>
 #include <algorithm>
 #include <functional>
 #include "gna_lib_ver_selector.hpp"
@@ -29,6 +31,10 @@ class GNAMemory : public GNAMemRequestsQueue {
     size_t _total = 0;
     size_t _rw_section_size = 0;
     size_t _ro_section_size = 0;
+    // read/write requests with limited lifetime share memory at the beginning of read/write section
+    std::map<size_t, size_t> _shared_offsets;
+    size_t _shared_section_size = 0;
+    size_t _shared_requests_size = 0;
     Allocator _allocator;
     std::shared_ptr<uint8_t> heap = nullptr;
     size_t _page_alignment = 1;
@@ -95,10 +101,12 @@ class GNAMemory : public GNAMemRequestsQueue {
                 if (filter(re)) continue;
 
                 auto sz = re._element_size * re._num_elements;
+                auto shared = _shared_offsets.find(&re - _future_heap.data());
+                auto re_offset = shared != _shared_offsets.end() ? shared->second : offset;
 
                 if (re._ptr_out != nullptr) {
-                    auto cptr = heap.get() + offset;
-                    size_t cptr_avail_size = _total - offset;
+                    auto cptr = heap.get() + re_offset;
+                    size_t cptr_avail_size = _total - re_offset;
                     if (re._type & REQUEST_BIND) {
                         cptr = reinterpret_cast<uint8_t*>(*reinterpret_cast<void **>(re._ptr_out));
                         cptr_avail_size = sz;
@@ -135,7 +143,7 @@ class GNAMemory : public GNAMemRequestsQueue {
                         }
                     }
                 }
-                if (!(re._type & REQUEST_BIND)) {
+                if (!(re._type & REQUEST_BIND) && shared == _shared_offsets.end()) {
                     offset += ALIGN(sz + re._padding, re._alignment);
                 }
             }
@@ -144,7 +152,7 @@ class GNAMemory : public GNAMemRequestsQueue {
         setupOffsets([](GNAPluginNS::memory::MemRequest & request) {
             // TODO: consume bind requests separately from storage type
             return !(request._type & REQUEST_BIND) && (request._region != REGION_RW);
-        }, 0);
+        }, _shared_section_size);
 
         setupOffsets([](GNAPluginNS::memory::MemRequest & request) {
             return (request._type & REQUEST_BIND) || request._region != REGION_RO;
@@ -165,6 +173,14 @@ class GNAMemory : public GNAMemRequestsQueue {
         return _total;
     }
 
+    /**
+     * @brief bytes saved by placing read/write requests which are not alive at the same time to the same memory
+     */
+    size_t getReusedBytes() {
+        updateSectionsSizes();
+        return _shared_requests_size - _shared_section_size;
+    }
+
  protected:
     rRegion regionType() const override {
         return REGION_RW;
@@ -191,6 +207,47 @@ class GNAMemory : public GNAMemRequestsQueue {
     }
 
 
+    /**
+     * @brief finds offsets of allocation requests in read/write region which are accessed by a limited range of layers,
+     * the lifetime of such request includes lifetimes of all requests bound to it
+     */
+    void solveSharedOffsets() {
+        _shared_offsets.clear();
+        _shared_section_size = 0;
+        _shared_requests_size = 0;
+
+        std::vector<InferenceEngine::MemorySolver::Box> boxes;
+        size_t unit = 1;
+        for (size_t i = 0; i != _future_heap.size(); i++) {
+            auto &re = _future_heap[i];
+            if (re._type != REQUEST_ALLOCATE || re._region != REGION_RW || re._ptr_out == nullptr) continue;
+
+            int start = re._life_start;
+            int finish = re._life_finish;
+            iterate_binded(re, [&](MemRequest & reference, MemRequest & binded) {
+                start = std::min(start, binded._life_start);
+                finish = (finish == -1 || binded._life_finish == -1) ? -1 : std::max(finish, binded._life_finish);
+            });
+            if (finish == -1) continue;
+
+            auto size = ALIGN(re._num_elements * re._element_size + re._padding, re._alignment);
+            boxes.push_back({start, finish, static_cast<int64_t>(size), static_cast<int64_t>(i)});
+            unit = std::max(unit, re._alignment);
+            _shared_requests_size += size;
+        }
+        if (boxes.empty()) return;
+
+        // offsets are kept aligned by solving in units of the largest alignment
+        for (auto &box : boxes) {
+            box.size = (box.size + unit - 1) / unit;
+        }
+        InferenceEngine::MemorySolver solver(boxes);
+        _shared_section_size = static_cast<size_t>(solver.solve()) * unit;
+        for (auto &box : boxes) {
+            _shared_offsets[box.id] = static_cast<size_t>(solver.getOffset(box.id)) * unit;
+        }
+    }
+
     std::shared_ptr<uint8_t> allocate(size_t bytes) {
         std::shared_ptr<uint8_t> sp(_allocator.allocate(bytes), [=](uint8_t *p) {
             _allocator.deallocate(p, bytes);
@@ -202,7 +259,8 @@ class GNAMemory : public GNAMemRequestsQueue {
  protected:
     void updateSectionsSizes() {
         // count total size and size of read/write regions
-        _rw_section_size = 0;
+        solveSharedOffsets();
+        _rw_section_size = _shared_section_size;
         _ro_section_size = 0;
         for (auto &re : _future_heap) {
             auto current = ALIGN(re._num_elements * re._element_size + re._padding, re._alignment);
@@ -216,6 +274,7 @@ class GNAMemory : public GNAMemRequestsQueue {
                     re._alignment << std::endl;
 #endif
             if (re._type == REQUEST_BIND) continue;
+            if (_shared_offsets.count(&re - _future_heap.data())) continue;
 
             if (re._region == REGION_RW) {
                 _rw_section_size += current;
@@ -6,9 +6,12 @@
 #include <limits>
 #include <cstdint>
 #include <cstdio>
+#include <vector>
 #include <gna_plugin_log.hpp>
+#include <ie_parallel.hpp>
 
 #include "cnn.h"
+#include "float_kernels.hpp"
 #include "backend/dnn_types.h"
 #include "backend/gna_limitations.hpp"
 #include "gna_lib_ver_selector.hpp"
@@ -37,15 +40,25 @@ void CNNFilter32(intel_dnn_component_t *component) {
         THROW_GNA_EXCEPTION << "Bad num_columns_out in CNNFilter32!" << layer_name;
     }
 
-    for (uint32_t j = 0; j < numberOfOutputsPerFilter; j++, input += convolutionStride, output += numberOfFilters) {
-        auto filter = filters;
-        for (uint32_t i = 0; i < numberOfFilters; i++, filter += filterSize) {
-            output[i] = biases[i];
-            for (uint32_t k = 0; k < filterSize; k++) {
-                output[i] += input[k] * filter[k];
+    std::vector<const float *> filterRows(numberOfFilters);
+    for (uint32_t i = 0; i < numberOfFilters; i++) {
+        filterRows[i] = filters + i * filterSize;
+    }
+
+    // Each block of filters stays in cache while it slides over the whole input
+    const auto& kernels = GNAPluginNS::runtime::floatKernels();
+    const uint32_t numBlocks = (numberOfFilters + kernels.rowBlock - 1) / kernels.rowBlock;
+    InferenceEngine::parallel_for(numBlocks, [&](uint32_t block) {
+        const uint32_t first = block * kernels.rowBlock;
+        const uint32_t count = (std::min)(kernels.rowBlock, numberOfFilters - first);
+        for (uint32_t j = 0; j < numberOfOutputsPerFilter; j++) {
+            auto out = output + j * numberOfFilters + first;
+            for (uint32_t i = 0; i < count; i++) {
+                out[i] = biases[first + i];
             }
+            kernels.affine(filterRows.data() + first, count, input + j * convolutionStride, filterSize, 1, 1, out, 1);
         }
-    }
+    });
 }
 
 void CNNMaxPoolLegacy(intel_dnn_component_t *component, intel_dnn_number_type_t number_type, const bool sumPoolingOverRide) {
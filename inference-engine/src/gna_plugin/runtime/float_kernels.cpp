@@ -0,0 +1,307 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+// float_kernels.cpp : kernels of the floating point runtime, compiled once per instruction set
+//
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(HAVE_AVX2)
+#include <immintrin.h>
+#endif
+
+#include "float_kernels.hpp"
+
+namespace GNAPluginNS {
+namespace runtime {
+namespace XARCH {
+namespace {
+
+void affine_ref(const float* const* weights, uint32_t numRows,
+                const float* input, uint32_t numInputs, uint32_t numColumns, uint32_t inputStride,
+                float* output, uint32_t outputStride) {
+    for (uint32_t r = 0; r < numRows; r++) {
+        for (uint32_t j = 0; j < numColumns; j++) {
+            float sum = output[r * outputStride + j];
+            for (uint32_t k = 0; k < numInputs; k++) {
+                sum += weights[r][k] * input[k * inputStride + j];
+            }
+            output[r * outputStride + j] = sum;
+        }
+    }
+}
+
+void axpy_ref(float alpha, const float* x, float* y, uint32_t size) {
+    for (uint32_t j = 0; j < size; j++) {
+        y[j] += alpha * x[j];
+    }
+}
+
+void relu_ref(const float* in, float* out, uint32_t size, float negativeSlope) {
+    for (uint32_t j = 0; j < size; j++) {
+        out[j] = (in[j] < 0.0f) ? in[j] * negativeSlope : in[j];
+    }
+}
+
+void clamp_ref(const float* in, float* out, uint32_t size, float low, float high) {
+    for (uint32_t j = 0; j < size; j++) {
+        if (in[j] > high) {
+            out[j] = high;
+        } else if (in[j] < low) {
+            out[j] = low;
+        } else {
+            out[j] = in[j];
+        }
+    }
+}
+
+void abs_ref(const float* in, float* out, uint32_t size) {
+    for (uint32_t j = 0; j < size; j++) {
+        out[j] = std::fabs(in[j]);
+    }
+}
+
+void sign_ref(const float* in, float* out, uint32_t size) {
+    for (uint32_t j = 0; j < size; j++) {
+        out[j] = (in[j] == 0) ? 0.0f : ((in[j] > 0) ? 1.0f : -1.0f);
+    }
+}
+
+#if defined(HAVE_AVX2)
+
+#if defined(HAVE_AVX512F)
+using vec_t = __m512;
+constexpr uint32_t vec_size = 16;
+
+inline vec_t vec_load(const float* p) { return _mm512_loadu_ps(p); }
+inline void vec_store(float* p, vec_t v) { _mm512_storeu_ps(p, v); }
+inline vec_t vec_set1(float v) { return _mm512_set1_ps(v); }
+inline vec_t vec_add(vec_t a, vec_t b) { return _mm512_add_ps(a, b); }
+inline vec_t vec_mul(vec_t a, vec_t b) { return _mm512_mul_ps(a, b); }
+inline vec_t vec_abs(vec_t a) {
+    return _mm512_castsi512_ps(_mm512_and_epi32(_mm512_castps_si512(a), _mm512_set1_epi32(0x7fffffff)));
+}
+// Takes b where a < b (ordered comparison, false for NaN)
+inline vec_t vec_select_lt(vec_t a, vec_t b, vec_t va, vec_t vb) {
+    return _mm512_mask_blend_ps(_mm512_cmp_ps_mask(a, b, _CMP_LT_OQ), va, vb);
+}
+inline vec_t vec_select_eq(vec_t a, vec_t b, vec_t va, vec_t vb) {
+    return _mm512_mask_blend_ps(_mm512_cmp_ps_mask(a, b, _CMP_EQ_OQ), va, vb);
+}
+#else
+using vec_t = __m256;
+constexpr uint32_t vec_size = 8;
+
+inline vec_t vec_load(const float* p) { return _mm256_loadu_ps(p); }
+inline void vec_store(float* p, vec_t v) { _mm256_storeu_ps(p, v); }
+inline vec_t vec_set1(float v) { return _mm256_set1_ps(v); }
+inline vec_t vec_add(vec_t a, vec_t b) { return _mm256_add_ps(a, b); }
+inline vec_t vec_mul(vec_t a, vec_t b) { return _mm256_mul_ps(a, b); }
+inline vec_t vec_abs(vec_t a) {
+    return _mm256_and_ps(a, _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff)));
+}
+inline vec_t vec_select_lt(vec_t a, vec_t b, vec_t va, vec_t vb) {
+    return _mm256_blendv_ps(va, vb, _mm256_cmp_ps(a, b, _CMP_LT_OQ));
+}
+inline vec_t vec_select_eq(vec_t a, vec_t b, vec_t va, vec_t vb) {
+    return _mm256_blendv_ps(va, vb, _mm256_cmp_ps(a, b, _CMP_EQ_OQ));
+}
+#endif
+
+// Number of output columns accumulated in registers at once
+constexpr uint32_t columns_block = 4;
+
+// Transposes 8 rows of 8 floats in place
+inline void transpose8x8(__m256 (&t)[8]) {
+    const __m256 u0 = _mm256_unpacklo_ps(t[0], t[1]);
+    const __m256 u1 = _mm256_unpackhi_ps(t[0], t[1]);
+    const __m256 u2 = _mm256_unpacklo_ps(t[2], t[3]);
+    const __m256 u3 = _mm256_unpackhi_ps(t[2], t[3]);
+    const __m256 u4 = _mm256_unpacklo_ps(t[4], t[5]);
+    const __m256 u5 = _mm256_unpackhi_ps(t[4], t[5]);
+    const __m256 u6 = _mm256_unpacklo_ps(t[6], t[7]);
+    const __m256 u7 = _mm256_unpackhi_ps(t[6], t[7]);
+    const __m256 s0 = _mm256_shuffle_ps(u0, u2, _MM_SHUFFLE(1, 0, 1, 0));
+    const __m256 s1 = _mm256_shuffle_ps(u0, u2, _MM_SHUFFLE(3, 2, 3, 2));
+    const __m256 s2 = _mm256_shuffle_ps(u1, u3, _MM_SHUFFLE(1, 0, 1, 0));
+    const __m256 s3 = _mm256_shuffle_ps(u1, u3, _MM_SHUFFLE(3, 2, 3, 2));
+    const __m256 s4 = _mm256_shuffle_ps(u4, u6, _MM_SHUFFLE(1, 0, 1, 0));
+    const __m256 s5 = _mm256_shuffle_ps(u4, u6, _MM_SHUFFLE(3, 2, 3, 2));
+    const __m256 s6 = _mm256_shuffle_ps(u5, u7, _MM_SHUFFLE(1, 0, 1, 0));
+    const __m256 s7 = _mm256_shuffle_ps(u5, u7, _MM_SHUFFLE(3, 2, 3, 2));
+    t[0] = _mm256_permute2f128_ps(s0, s4, 0x20);
+    t[1] = _mm256_permute2f128_ps(s1, s5, 0x20);
+    t[2] = _mm256_permute2f128_ps(s2, s6, 0x20);
+    t[3] = _mm256_permute2f128_ps(s3, s7, 0x20);
+    t[4] = _mm256_permute2f128_ps(s0, s4, 0x31);
+    t[5] = _mm256_permute2f128_ps(s1, s5, 0x31);
+    t[6] = _mm256_permute2f128_ps(s2, s6, 0x31);
+    t[7] = _mm256_permute2f128_ps(s3, s7, 0x31);
+}
+
+// Loads 8 consecutive weights of vec_size rows starting from k, so that t[kk] holds weights[0..vec_size)[k + kk]
+inline void load_weights_transposed(const float* const* weights, uint32_t k, vec_t (&t)[8]) {
+    __m256 lo[8];
+    for (uint32_t r = 0; r < 8; r++)
+        lo[r] = _mm256_loadu_ps(weights[r] + k);
+    transpose8x8(lo);
+#if defined(HAVE_AVX512F)
+    __m256 hi[8];
+    for (uint32_t r = 0; r < 8; r++)
+        hi[r] = _mm256_loadu_ps(weights[8 + r] + k);
+    transpose8x8(hi);
+    for (uint32_t kk = 0; kk < 8; kk++) {
+        t[kk] = _mm512_castpd_ps(_mm512_insertf64x4(_mm512_castpd256_pd512(_mm256_castps_pd(lo[kk])),
+                                                    _mm256_castps_pd(hi[kk]), 1));
+    }
+#else
+    for (uint32_t kk = 0; kk < 8; kk++)
+        t[kk] = lo[kk];
+#endif
+}
+
+inline vec_t load_column(const float* p, uint32_t stride) {
+    if (stride == 1)
+        return vec_load(p);
+    float column[vec_size];
+    for (uint32_t r = 0; r < vec_size; r++)
+        column[r] = p[r * stride];
+    return vec_load(column);
+}
+
+inline void store_column(float* p, uint32_t stride, vec_t v) {
+    if (stride == 1) {
+        vec_store(p, v);
+        return;
+    }
+    float column[vec_size];
+    vec_store(column, v);
+    for (uint32_t r = 0; r < vec_size; r++)
+        p[r * stride] = column[r];
+}
+
+/**
+ * Vectorized over output rows: each lane accumulates one row, so every output sees the same
+ * sequence of roundings as in the reference loop. Weights are transposed on the fly in 8x8 blocks.
+ */
+void affine_simd(const float* const* weights, uint32_t numRows,
+                 const float* input, uint32_t numInputs, uint32_t numColumns, uint32_t inputStride,
+                 float* output, uint32_t outputStride) {
+    uint32_t r0 = 0;
+    for (; r0 + vec_size <= numRows; r0 += vec_size) {
+        const float* const* rows = weights + r0;
+        float* out = output + r0 * outputStride;
+        for (uint32_t j0 = 0; j0 < numColumns; j0 += columns_block) {
+            const uint32_t jn = (std::min)(columns_block, numColumns - j0);
+            vec_t acc[columns_block];
+            for (uint32_t jj = 0; jj < jn; jj++)
+                acc[jj] = load_column(out + j0 + jj, outputStride);
+
+            uint32_t k = 0;
+            for (; k + 8 <= numInputs; k += 8) {
+                vec_t t[8];
+                load_weights_transposed(rows, k, t);
+                for (uint32_t kk = 0; kk < 8; kk++) {
+                    const float* in = input + (k + kk) * inputStride + j0;
+                    for (uint32_t jj = 0; jj < jn; jj++)
+                        acc[jj] = vec_add(acc[jj], vec_mul(t[kk], vec_set1(in[jj])));
+                }
+            }
+            for (; k < numInputs; k++) {
+                float column[vec_size];
+                for (uint32_t r = 0; r < vec_size; r++)
+                    column[r] = rows[r][k];
+                const vec_t w = vec_load(column);
+                const float* in = input + k * inputStride + j0;
+                for (uint32_t jj = 0; jj < jn; jj++)
+                    acc[jj] = vec_add(acc[jj], vec_mul(w, vec_set1(in[jj])));
+            }
+
+            for (uint32_t jj = 0; jj < jn; jj++)
+                store_column(out + j0 + jj, outputStride, acc[jj]);
+        }
+    }
+    affine_ref(weights + r0, numRows - r0, input, numInputs, numColumns, inputStride,
+               output + r0 * outputStride, outputStride);
+}
+
+void axpy_simd(float alpha, const float* x, float* y, uint32_t size) {
+    const vec_t a = vec_set1(alpha);
+    uint32_t j = 0;
+    for (; j + vec_size <= size; j += vec_size)
+        vec_store(y + j, vec_add(vec_load(y + j), vec_mul(a, vec_load(x + j))));
+    axpy_ref(alpha, x + j, y + j, size - j);
+}
+
+void relu_simd(const float* in, float* out, uint32_t size, float negativeSlope) {
+    const vec_t zero = vec_set1(0.0f);
+    const vec_t slope = vec_set1(negativeSlope);
+    uint32_t j = 0;
+    for (; j + vec_size <= size; j += vec_size) {
+        const vec_t x = vec_load(in + j);
+        vec_store(out + j, vec_select_lt(x, zero, x, vec_mul(x, slope)));
+    }
+    relu_ref(in + j, out + j, size - j, negativeSlope);
+}
+
+void clamp_simd(const float* in, float* out, uint32_t size, float low, float high) {
+    const vec_t vlow = vec_set1(low);
+    const vec_t vhigh = vec_set1(high);
+    uint32_t j = 0;
+    for (; j + vec_size <= size; j += vec_size) {
+        const vec_t x = vec_load(in + j);
+        // NaN fails both comparisons and passes through as in the reference
+        const vec_t y = vec_select_lt(x, vlow, x, vlow);
+        vec_store(out + j, vec_select_lt(vhigh, x, y, vhigh));
+    }
+    clamp_ref(in + j, out + j, size - j, low, high);
+}
+
+void abs_simd(const float* in, float* out, uint32_t size) {
+    uint32_t j = 0;
+    for (; j + vec_size <= size; j += vec_size)
+        vec_store(out + j, vec_abs(vec_load(in + j)));
+    abs_ref(in + j, out + j, size - j);
+}
+
+void sign_simd(const float* in, float* out, uint32_t size) {
+    const vec_t zero = vec_set1(0.0f);
+    const vec_t one = vec_set1(1.0f);
+    const vec_t minus_one = vec_set1(-1.0f);
+    uint32_t j = 0;
+    for (; j + vec_size <= size; j += vec_size) {
+        const vec_t x = vec_load(in + j);
+        const vec_t y = vec_select_lt(zero, x, minus_one, one);
+        vec_store(out + j, vec_select_eq(x, zero, y, zero));
+    }
+    sign_ref(in + j, out + j, size - j);
+}
+
+#endif  // HAVE_AVX2
+
+}  // namespace
+
+void get_float_kernels(FloatKernels& kernels) {
+#if defined(HAVE_AVX2)
+    kernels.affine = affine_simd;
+    kernels.axpy = axpy_simd;
+    kernels.relu = relu_simd;
+    kernels.clamp = clamp_simd;
+    kernels.abs = abs_simd;
+    kernels.sign = sign_simd;
+    kernels.rowBlock = vec_size;
+#else
+    kernels.affine = affine_ref;
+    kernels.axpy = axpy_ref;
+    kernels.relu = relu_ref;
+    kernels.clamp = clamp_ref;
+    kernels.abs = abs_ref;
+    kernels.sign = sign_ref;
+    kernels.rowBlock = 8;
+#endif
+}
+
+}  // namespace XARCH
+}  // namespace runtime
+}  // namespace GNAPluginNS
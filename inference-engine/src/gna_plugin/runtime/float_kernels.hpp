@@ -0,0 +1,62 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+
+namespace GNAPluginNS {
+namespace runtime {
+
+/**
+ * @brief Compute kernels of the floating point runtime selected for the instruction set of the host CPU.
+ *
+ * All kernels keep the accumulation order of the scalar reference implementation (each output is
+ * accumulated sequentially along its reduction axis, multiplication and addition are not fused), so
+ * their results are bitwise identical to the reference on any CPU.
+ */
+struct FloatKernels {
+    /**
+     * @brief output[r][j] += sum(weights[r][k] * input[k][j]) over k for numRows rows and numColumns columns.
+     * Row r of output starts at output + r * outputStride, row k of input at input + k * inputStride.
+     */
+    void (*affine)(const float* const* weights, uint32_t numRows,
+                   const float* input, uint32_t numInputs, uint32_t numColumns, uint32_t inputStride,
+                   float* output, uint32_t outputStride);
+    /**
+     * @brief y[j] += alpha * x[j]
+     */
+    void (*axpy)(float alpha, const float* x, float* y, uint32_t size);
+    /**
+     * @brief out[j] = in[j] < 0 ? in[j] * negativeSlope : in[j]
+     */
+    void (*relu)(const float* in, float* out, uint32_t size, float negativeSlope);
+    /**
+     * @brief out[j] = in[j] > high ? high : (in[j] < low ? low : in[j])
+     */
+    void (*clamp)(const float* in, float* out, uint32_t size, float low, float high);
+    /**
+     * @brief out[j] = |in[j]|
+     */
+    void (*abs)(const float* in, float* out, uint32_t size);
+    /**
+     * @brief out[j] = in[j] == 0 ? 0 : (in[j] > 0 ? 1 : -1)
+     */
+    void (*sign)(const float* in, float* out, uint32_t size);
+
+    uint32_t rowBlock;  //!< Number of affine rows processed together, row ranges should be split by it
+};
+
+/**
+ * @brief Returns kernels for the host CPU, the selection is done once
+ */
+const FloatKernels& floatKernels();
+
+namespace XARCH {
+
+void get_float_kernels(FloatKernels& kernels);
+
+}  // namespace XARCH
+}  // namespace runtime
+}  // namespace GNAPluginNS
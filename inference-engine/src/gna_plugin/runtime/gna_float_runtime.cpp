@@ -6,10 +6,19 @@
 #include <cstdint>
 #include <backend/dnn_types.h>
 #include "gna_float_runtime.hpp"
+#include "float_kernels.hpp"
 
 using namespace GNAPluginNS;
 using namespace GNAPluginNS::runtime;
 
+const FloatKernels& GNAPluginNS::runtime::floatKernels() {
+    static const FloatKernels kernels = [] {
+        FloatKernels k;
+        XARCH::get_float_kernels(k);
+        return k;
+    }();
+    return kernels;
+}
 
 void FP::infer() {
     if (!dnn) {
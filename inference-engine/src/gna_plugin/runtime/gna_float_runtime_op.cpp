@@ -6,6 +6,12 @@
 #include "pwl.h"
 #include "cnn.h"
 #include "floatmath.h"
+#include "float_kernels.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#include <ie_parallel.hpp>
 
 using namespace GNAPluginNS;
 using namespace GNAPluginNS::runtime;
@@ -27,37 +33,24 @@ void FP::ApplyAffineTransform(intel_dnn_component_t *component, uint32_t *list,
     auto B = reinterpret_cast<float *>(component->ptr_inputs);
     auto C = reinterpret_cast<float *>(component->ptr_outputs);
     auto bias = reinterpret_cast<float *>(transform->ptr_biases);
-    if (list == nullptr) {
-        for (uint32_t i = 0; i < m; i++) {
-            for (uint32_t j = 0; j < n; j++) {
-                C[i * ldc + j] = bias[i];
-            }
-        }
-        cblas_sgemm1(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k, 1.0, A, lda, B, ldb, 1.0, C, ldc);
-    } else {
-        for (int l = 0; l < listsize; l++) {
-            int i = list[l];
-            for (uint32_t j = 0; j < n; j++) {
-                C[l * ldc + j] = bias[i];
-            }
+    const uint32_t numRows = (list == nullptr) ? m : listsize;
+    // Output row l is computed from the weights row list[l] when the active list is given
+    std::vector<const float *> rows(numRows);
+    for (uint32_t l = 0; l < numRows; l++) {
+        uint32_t i = (list == nullptr) ? l : list[l];
+        rows[l] = A + i * lda;
+        for (uint32_t j = 0; j < n; j++) {
+            C[l * ldc + j] = bias[i];
         }
-        cblas_sgemm_subset(CblasRowMajor,
-                           CblasNoTrans,
-                           CblasNoTrans,
-                           m,
-                           n,
-                           k,
-                           1.0,
-                           A,
-                           lda,
-                           B,
-                           ldb,
-                           1.0,
-                           C,
-                           ldc,
-                           list,
-                           listsize);
     }
+
+    const auto& kernels = floatKernels();
+    const uint32_t numBlocks = (numRows + kernels.rowBlock - 1) / kernels.rowBlock;
+    InferenceEngine::parallel_for(numBlocks, [&](uint32_t block) {
+        const uint32_t first = block * kernels.rowBlock;
+        const uint32_t count = (std::min)(kernels.rowBlock, numRows - first);
+        kernels.affine(rows.data() + first, count, B, k, n, ldb, C + first * ldc, ldc);
+    });
 }
 
 void FP::ApplyDiagonalTransform(intel_dnn_component_t *component) {
@@ -74,18 +67,15 @@ void FP::ApplyDiagonalTransform(intel_dnn_component_t *component) {
     auto B = reinterpret_cast<float *>(component->ptr_inputs);
     auto C = reinterpret_cast<float *>(component->ptr_outputs);
     auto bias = reinterpret_cast<float *>(transform->ptr_biases);
-    for (uint32_t i = 0; i < m; i++) {
-        for (uint32_t j = 0; j < n; j++) {
-            C[i * ldc + j] = bias[i];
-        }
-    }
-    std::vector<float> Arow(n);
-    for (uint32_t i = 0; i < m; i++) {
+    const auto& kernels = floatKernels();
+    InferenceEngine::parallel_for(m, [&](uint32_t i) {
         float *Brow = B + i * n;
         float *Crow = C + i * ldc;
-        std::fill(std::begin(Arow), std::end(Arow), A[i]);
-        cblas_ssbmv1(CblasRowMajor, CblasLower, n, 0, 1.0, Arow.data(), 1, Brow, 1, 1.0, Crow, 1);
-    }
+        for (uint32_t j = 0; j < n; j++) {
+            Crow[j] = bias[i];
+        }
+        kernels.axpy(A[i], Brow, Crow, n);
+    });
 }
 
 void FP::ApplyRecurrentTransform(intel_dnn_component_t *component, uint32_t row, void *ptr_feedbacks) {
@@ -9,6 +9,9 @@
 #include <limits>
 #include <cstdint>
 #include <algorithm>
+#include <functional>
+
+#include <ie_parallel.hpp>
 
 #ifdef _NO_MKL_
 #include <cmath>
@@ -25,6 +28,7 @@
 #endif
 
 #include "pwl.h"
+#include "float_kernels.hpp"
 #include "gna_plugin_log.hpp"
 #include "gna_slope_scale.h"
 #include "round_float_define.hpp"
@@ -944,6 +948,30 @@ void PwlApply16(intel_dnn_component_t *component,
     }
 }
 
+namespace {
+// Calls func(offset, size) for chunks of consecutive elements of the range, chunks are processed in parallel
+template <typename F>
+void PwlParallelApply(uint32_t num_row_start,
+                      uint32_t num_row_end,
+                      uint32_t num_col_start,
+                      uint32_t num_col_end,
+                      uint32_t num_columns,
+                      const F &func) {
+    const uint32_t chunk_size = 1024;
+    uint32_t num_rows = num_row_end - num_row_start + 1;
+    uint32_t row_size = num_col_end - num_col_start + 1;
+    if (row_size == num_columns) {  // whole rows make a single contiguous range
+        row_size *= num_rows;
+        num_rows = 1;
+    }
+    const uint32_t num_chunks = (row_size + chunk_size - 1) / chunk_size;
+    InferenceEngine::parallel_for2d(num_rows, num_chunks, [&](uint32_t row, uint32_t chunk) {
+        const uint32_t offset = (num_row_start + row) * num_columns + num_col_start + chunk * chunk_size;
+        func(offset, (std::min)(chunk_size, row_size - chunk * chunk_size));
+    });
+}
+}  // namespace
+
 void PwlApply32(intel_dnn_component_t *component, uint32_t num_subset_size) {
     if (component->orientation_in == kDnnInterleavedOrientation) {  // subsets only supported in interleaved orientation
         PwlApply32(component, 0, num_subset_size - 1, 0, component->num_columns_in - 1);
@@ -961,120 +989,109 @@ void PwlApply32(intel_dnn_component_t *component,
     float *ptr_in = reinterpret_cast<float *>(component->ptr_inputs);
     float *ptr_out = reinterpret_cast<float *>(component->ptr_outputs);
     uint32_t num_columns = component->num_columns_in;
+    const auto &kernels = GNAPluginNS::runtime::floatKernels();
+    auto apply = [&](const std::function<void(uint32_t, uint32_t)> &func) {
+        PwlParallelApply(num_row_start, num_row_end, num_col_start, num_col_end, num_columns, func);
+    };
     switch (transform->func_id.type) {
         case kActSigmoid:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = 0.5 * (1.0 + tanh(0.5 * ptr_in[i * num_columns + j]));
+            apply([&](uint32_t offset, uint32_t size) {
+                for (uint32_t j = offset; j < offset + size; j++) {
+                    ptr_out[j] = 0.5 * (1.0 + tanh(0.5 * ptr_in[j]));
                 }
-            }
+            });
             break;
         case kActTanh:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = tanh(ptr_in[i * num_columns + j]);
+            apply([&](uint32_t offset, uint32_t size) {
+                for (uint32_t j = offset; j < offset + size; j++) {
+                    ptr_out[j] = tanh(ptr_in[j]);
                 }
-            }
+            });
             break;
         case kActSoftSign:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = ptr_in[i * num_columns + j] / (1.0 + fabs(ptr_in[i * num_columns + j]));
+            apply([&](uint32_t offset, uint32_t size) {
+                for (uint32_t j = offset; j < offset + size; j++) {
+                    ptr_out[j] = ptr_in[j] / (1.0 + fabs(ptr_in[j]));
                 }
-            }
+            });
             break;
-        case kActRelu:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] =
-                        (ptr_in[i * num_columns + j] < 0.0f) ?
-                            ptr_in[i * num_columns + j] * transform->func_id.args.lrelu.negative_slope :
-                            ptr_in[i * num_columns + j];
-                }
-            }
+        case kActRelu: {
+            float negative_slope = transform->func_id.args.lrelu.negative_slope;
+            apply([&](uint32_t offset, uint32_t size) {
+                kernels.relu(ptr_in + offset, ptr_out + offset, size, negative_slope);
+            });
             break;
+        }
         case kActIdentity:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = ptr_in[i * num_columns + j];
+            apply([&](uint32_t offset, uint32_t size) {
+                for (uint32_t j = offset; j < offset + size; j++) {
+                    ptr_out[j] = ptr_in[j];
                 }
-            }
+            });
             break;
         case kActKaldiLstmClipping: {
             float upper_limit = component->op.pwl.func_id.args.clamp.high;
             float lower_limit = component->op.pwl.func_id.args.clamp.low;
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    float val = ptr_in[i * num_columns + j];
-                    if (val > upper_limit) {
-                        ptr_out[i * num_columns + j] = upper_limit;
-                    } else if (val < lower_limit) {
-                        ptr_out[i * num_columns + j] = lower_limit;
-                    } else {
-                        ptr_out[i * num_columns + j] = val;
-                    }
-                }
-            }
+            apply([&](uint32_t offset, uint32_t size) {
+                kernels.clamp(ptr_in + offset, ptr_out + offset, size, lower_limit, upper_limit);
+            });
             break;
         }
         case kActExp:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = exp(ptr_in[i * num_columns + j]);
+            apply([&](uint32_t offset, uint32_t size) {
+                for (uint32_t j = offset; j < offset + size; j++) {
+                    ptr_out[j] = exp(ptr_in[j]);
                 }
-            }
+            });
             break;
         case kActLog:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = log(ptr_in[i * num_columns + j]);
+            apply([&](uint32_t offset, uint32_t size) {
+                for (uint32_t j = offset; j < offset + size; j++) {
+                    ptr_out[j] = log(ptr_in[j]);
                 }
-            }
+            });
             break;
         case kActAbs:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = fabs(ptr_in[i * num_columns + j]);
-                }
-            }
+            apply([&](uint32_t offset, uint32_t size) {
+                kernels.abs(ptr_in + offset, ptr_out + offset, size);
+            });
             break;
         case kActSign:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = (ptr_in[i * num_columns + j] == 0) ? 0.0 : ((ptr_in[i * num_columns + j] > 0) ? 1.0 : -1.0);
-                }
-            }
+            apply([&](uint32_t offset, uint32_t size) {
+                kernels.sign(ptr_in + offset, ptr_out + offset, size);
+            });
             break;
         case kActNegLog:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = -1.0 * log(ptr_in[i * num_columns + j]);
+            apply([&](uint32_t offset, uint32_t size) {
+                for (uint32_t j = offset; j < offset + size; j++) {
+                    ptr_out[j] = -1.0 * log(ptr_in[j]);
                 }
-            }
+            });
             break;
         case kActNegHalfLog:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = -0.5 * log(ptr_in[i * num_columns + j]);
+            apply([&](uint32_t offset, uint32_t size) {
+                for (uint32_t j = offset; j < offset + size; j++) {
+                    ptr_out[j] = -0.5 * log(ptr_in[j]);
                 }
-            }
+            });
             break;
         case kActPow: {
                 float exponent = transform->func_id.args.pow.exponent;
                 float scale = transform->func_id.args.pow.scale;
                 float offset = transform->func_id.args.pow.offset;
-                for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                    for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                        ptr_out[i * num_columns + j] = pow(offset + scale * ptr_in[i * num_columns + j], exponent);
+                apply([&](uint32_t first, uint32_t size) {
+                    for (uint32_t j = first; j < first + size; j++) {
+                        ptr_out[j] = pow(offset + scale * ptr_in[j], exponent);
                     }
-                }
+                });
             }
             break;
         case kActFakeQuantize: {
             bool clamping = true;
             double levels  = transform->func_id.fqParams.levels;
 
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
+            InferenceEngine::parallel_for(num_row_end - num_row_start + 1, [&](uint32_t row) {
+                auto i = num_row_start + row;
                 auto inputChannel  = transform->func_id.fqParams.inputPerChannel ? i : 0;
                 auto outputChannel = transform->func_id.fqParams.outputPerChannel ? i : 0;
 
@@ -1103,7 +1120,7 @@ void PwlApply32(intel_dnn_component_t *component,
                             (levels - 1) * (output_high - output_low) + output_low;
                     }
                 }
-            }
+            });
             break;
         }
         case kActCustom:
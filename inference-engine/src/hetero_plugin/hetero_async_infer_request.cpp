@@ -4,6 +4,8 @@
 
 #include <utility>
 #include <memory>
+#include <mutex>
+#include <vector>
 #include "hetero_async_infer_request.hpp"
 
 using namespace HeteroPlugin;
@@ -14,33 +16,128 @@ HeteroAsyncInferRequest::HeteroAsyncInferRequest(const IInferRequestInternal::Pt
                                                  const ITaskExecutor::Ptr&          callbackExecutor) :
     AsyncInferRequestThreadSafeDefault(request, taskExecutor, callbackExecutor),
     _heteroInferRequest(std::static_pointer_cast<HeteroInferRequest>(request)) {
-    _pipeline.clear();
-    for (std::size_t requestId = 0; requestId < _heteroInferRequest->_inferRequests.size(); ++requestId) {
-        struct RequestExecutor : ITaskExecutor {
-            explicit RequestExecutor(SoIInferRequestInternal & inferRequest) : _inferRequest(inferRequest) {
-                _inferRequest->SetCallback(
-                [this] (std::exception_ptr exceptionPtr) mutable {
-                    _exceptionPtr = exceptionPtr;
-                    auto capturedTask = std::move(_task);
-                    capturedTask();
+    // Subgraph requests are started as soon as all subgraphs they depend on are inferred,
+    // so independent branches of the network are executed concurrently.
+    // In the pipeline parallel mode every subgraph takes a subnetwork request from the pool of its subgraph,
+    // so subgraphs of different HETERO requests are executed concurrently too
+    struct SubgraphsExecutor : ITaskExecutor {
+        explicit SubgraphsExecutor(HeteroInferRequest& heteroInferRequest) :
+            _heteroInferRequest(heteroInferRequest),
+            _inferRequests(heteroInferRequest._inferRequests),
+            _successors(_inferRequests.size()),
+            _notReadyDependencies(_inferRequests.size()) {
+            for (std::size_t requestId = 0; requestId < _inferRequests.size(); ++requestId) {
+                for (auto&& dependency : _inferRequests[requestId]._dependencies) {
+                    _successors[dependency].push_back(requestId);
+                }
+                if (_inferRequests[requestId]._pool) {
+                    continue;
+                }
+                _inferRequests[requestId]._request->SetCallback(
+                [this, requestId] (std::exception_ptr exceptionPtr) {
+                    OnDone(requestId, exceptionPtr);
                 });
             }
-            void run(Task task) override {
+        }
+        void run(Task task) override {
+            std::vector<std::size_t> ready;
+            {
+                std::lock_guard<std::mutex> lock{_mutex};
                 _task = std::move(task);
-                _inferRequest->StartAsync();
-            };
-            SoIInferRequestInternal &  _inferRequest;
-            std::exception_ptr         _exceptionPtr;
-            Task                       _task;
-        };
+                _exceptionPtr = nullptr;
+                _notFinished = _inferRequests.size();
+                for (std::size_t requestId = 0; requestId < _inferRequests.size(); ++requestId) {
+                    _notReadyDependencies[requestId] = _inferRequests[requestId]._dependencies.size();
+                    if (_inferRequests[requestId]._dependencies.empty()) {
+                        ready.push_back(requestId);
+                    }
+                }
+            }
+            Start(ready);
+        }
+        void Start(const std::vector<std::size_t>& requestIds) {
+            for (auto&& requestId : requestIds) {
+                if (_inferRequests[requestId]._pool) {
+                    StartPooled(requestId);
+                    continue;
+                }
+                try {
+                    _inferRequests[requestId]._request->StartAsync();
+                } catch (...) {
+                    OnDone(requestId, std::current_exception());
+                }
+            }
+        }
+        void StartPooled(std::size_t requestId) {
+            auto pool = _inferRequests[requestId]._pool;
+            pool->Acquire([this, pool, requestId] (std::size_t pooledId) {
+                try {
+                    _heteroInferRequest.bindSubRequest(requestId, (*pool)[pooledId]);
+                    pool->StartAsync(pooledId, [this, pool, requestId, pooledId] (std::exception_ptr exceptionPtr) {
+                        // counters are taken before the request is passed to another HETERO request
+                        if (nullptr == exceptionPtr && pool->PerfCountEnabled()) {
+                            try {
+                                _inferRequests[requestId]._perfCounts = (*pool)[pooledId]->GetPerformanceCounts();
+                            } catch (...) {
+                                exceptionPtr = std::current_exception();
+                            }
+                        }
+                        pool->Release(pooledId);
+                        OnDone(requestId, exceptionPtr);
+                    });
+                } catch (...) {
+                    pool->Release(pooledId);
+                    OnDone(requestId, std::current_exception());
+                }
+            });
+        }
+        void OnDone(std::size_t requestId, std::exception_ptr exceptionPtr) {
+            std::vector<std::size_t> ready;
+            Task task;
+            {
+                std::lock_guard<std::mutex> lock{_mutex};
+                if (nullptr != exceptionPtr && nullptr == _exceptionPtr) {
+                    _exceptionPtr = exceptionPtr;
+                }
+                // After a failure the rest of subgraphs are not started, but still are counted as finished
+                std::vector<std::size_t> finished{requestId};
+                while (!finished.empty()) {
+                    auto finishedId = finished.back();
+                    finished.pop_back();
+                    --_notFinished;
+                    for (auto&& successor : _successors[finishedId]) {
+                        if (0 == --_notReadyDependencies[successor]) {
+                            (nullptr == _exceptionPtr ? ready : finished).push_back(successor);
+                        }
+                    }
+                }
+                if (0 == _notFinished) {
+                    task = std::move(_task);
+                }
+            }
+            Start(ready);
+            if (task) {
+                task();
+            }
+        }
+        HeteroInferRequest&                     _heteroInferRequest;
+        HeteroInferRequest::SubRequestsList&    _inferRequests;
+        std::vector<std::vector<std::size_t>>   _successors;
+        std::vector<std::size_t>                _notReadyDependencies;
+        std::size_t                             _notFinished = 0;
+        std::mutex                              _mutex;
+        std::exception_ptr                      _exceptionPtr;
+        Task                                    _task;
+    };
 
-        auto requestExecutor = std::make_shared<RequestExecutor>(_heteroInferRequest->_inferRequests[requestId]._request);
-        _pipeline.emplace_back(requestExecutor, [requestExecutor] {
-            if (nullptr != requestExecutor->_exceptionPtr) {
-                std::rethrow_exception(requestExecutor->_exceptionPtr);
+    auto subgraphsExecutor = std::make_shared<SubgraphsExecutor>(*_heteroInferRequest);
+    _pipeline = {
+        {subgraphsExecutor, [subgraphsExecutor] {
+            if (nullptr != subgraphsExecutor->_exceptionPtr) {
+                std::rethrow_exception(subgraphsExecutor->_exceptionPtr);
             }
-        });
-    }
+        }}
+    };
 }
 
 void HeteroAsyncInferRequest::StartAsync_ThreadUnsafe() {
@@ -48,13 +145,20 @@ void HeteroAsyncInferRequest::StartAsync_ThreadUnsafe() {
     RunFirstStage(_pipeline.begin(), _pipeline.end());
 }
 
+void HeteroAsyncInferRequest::Infer_ThreadUnsafe() {
+    InferUsingAsync();
+}
+
 StatusCode HeteroAsyncInferRequest::Wait(int64_t millis_timeout) {
     auto waitStatus = StatusCode::OK;
     try {
         waitStatus = AsyncInferRequestThreadSafeDefault::Wait(millis_timeout);
     } catch(...) {
         for (auto&& requestDesc : _heteroInferRequest->_inferRequests) {
-            requestDesc._request->Wait(InferRequest::RESULT_READY);
+            // pooled requests are never left running after a failed stage
+            if (!requestDesc._pool) {
+                requestDesc._request->Wait(InferRequest::RESULT_READY);
+            }
         }
         throw;
     }
@@ -19,6 +19,7 @@ public:
                             const InferenceEngine::ITaskExecutor::Ptr&        callbackExecutor);
     ~HeteroAsyncInferRequest();
     void StartAsync_ThreadUnsafe() override;
+    void Infer_ThreadUnsafe() override;
     InferenceEngine::StatusCode Wait(int64_t millis_timeout) override;
 
 private:
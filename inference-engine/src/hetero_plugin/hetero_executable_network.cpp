@@ -47,6 +47,57 @@ using namespace InferenceEngine::HeteroConfigParams;
 template<typename T>
 using NodeMap = std::unordered_map<ngraph::Node*, T>;
 
+namespace {
+
+bool isPipelineParallel(const std::map<std::string, std::string>& config) {
+    auto it = config.find(HETERO_CONFIG_KEY(PIPELINE_PARALLEL));
+    return it != config.end() && it->second == YES;
+}
+
+// Stages of the pipeline and independent subgraphs share the device executor if requests are exclusive
+void disableExclusiveAsyncRequests(std::map<std::string, std::string>& deviceConfig) {
+    auto it = deviceConfig.find(CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS));
+    if (it != deviceConfig.end()) {
+        it->second = NO;
+    }
+}
+
+// Devices which infer subgraphs concurrently: all the devices in the pipeline mode, otherwise the devices of
+// the subgraphs which are neither ancestors nor descendants of some other subgraph. Other devices keep
+// the exclusive mode, so a linear split doesn't start a separate executor for every subgraph.
+std::unordered_set<std::string> getConcurrentDevices(const std::vector<std::string>&               devices,
+                                                     const std::vector<std::vector<std::size_t>>&  dependencies,
+                                                     bool                                          pipelineParallel) {
+    if (pipelineParallel) {
+        return {devices.begin(), devices.end()};
+    }
+    std::unordered_set<std::string> concurrentDevices;
+    const auto count = devices.size();
+    // Subgraphs are topologically sorted, so ancestors of every dependency are already known
+    std::vector<std::vector<bool>> ancestors(count, std::vector<bool>(count, false));
+    for (std::size_t id = 0; id < count; ++id) {
+        for (auto&& dependency : dependencies[id]) {
+            ancestors[id][dependency] = true;
+            for (std::size_t ancestor = 0; ancestor < dependency; ++ancestor) {
+                if (ancestors[dependency][ancestor]) {
+                    ancestors[id][ancestor] = true;
+                }
+            }
+        }
+    }
+    for (std::size_t id = 0; id < count; ++id) {
+        for (std::size_t previous = 0; previous < id; ++previous) {
+            if (!ancestors[id][previous]) {
+                concurrentDevices.insert(devices[id]);
+                concurrentDevices.insert(devices[previous]);
+            }
+        }
+    }
+    return concurrentDevices;
+}
+
+}  // namespace
+
 HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwork&     network,
                                                  const Engine::Configs&                 config,
                                                  Engine*                                plugin):
@@ -421,12 +472,31 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwo
                 }
             }}.run_on_function(ngraph::clone_function(*function));
     }
+    std::vector<std::string> subgraphDevices;
+    std::vector<std::vector<std::string>> subgraphInputNames, subgraphOutputNames;
+    for (auto&& network : _networks) {
+        subgraphDevices.push_back(network._device);
+        subgraphInputNames.emplace_back();
+        for (auto&& input : network._clonedNetwork.getInputsInfo()) {
+            subgraphInputNames.back().push_back(input.first);
+        }
+        subgraphOutputNames.emplace_back();
+        for (auto&& output : network._clonedNetwork.getOutputsInfo()) {
+            subgraphOutputNames.back().push_back(output.first);
+        }
+    }
+    InitSubgraphDependencies(subgraphInputNames, subgraphOutputNames);
+    auto concurrentDevices = getConcurrentDevices(subgraphDevices, _subgraphDependencies, isPipelineParallel(_config));
     for (auto&& network : _networks) {
         auto metaDevices = _heteroPlugin->GetDevicePlugins(network._device, _config);
         metaDevices[network._device].emplace(CONFIG_KEY_INTERNAL(FORCE_DISABLE_CACHE), "");
+        if (concurrentDevices.count(network._device) != 0) {
+            disableExclusiveAsyncRequests(metaDevices[network._device]);
+        }
         network._network = _heteroPlugin->GetCore()->LoadNetwork(network._clonedNetwork,
             network._device, metaDevices[network._device]);
     }
+    InitRequestPools();
 }
 
 HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream&                               heteroModel,
@@ -475,14 +545,35 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream&
         importedConfigs[config.first] = config.second;
     }
 
-    std::vector<NetworkDesc> descs;
+    // Dependencies are known from the header, before any subnetwork is loaded
+    std::vector<std::string> subgraphDevices;
+    std::vector<std::vector<std::string>> subgraphInputNames, subgraphOutputNames;
     pugi::xml_node subnetworksNode = heteroNode.child("subnetworks");
+    FOREACH_CHILD(subnetworkNode, subnetworksNode, "subnetwork") {
+        subgraphDevices.push_back(GetStrAttr(subnetworkNode, "device"));
+        subgraphInputNames.emplace_back();
+        FOREACH_CHILD(inputNode, subnetworkNode.child("inputs"), "input") {
+            subgraphInputNames.back().push_back(GetStrAttr(inputNode, "name"));
+        }
+        subgraphOutputNames.emplace_back();
+        FOREACH_CHILD(outputNode, subnetworkNode.child("outputs"), "output") {
+            subgraphOutputNames.back().push_back(GetStrAttr(outputNode, "name"));
+        }
+    }
+    InitSubgraphDependencies(subgraphInputNames, subgraphOutputNames);
+    auto concurrentDevices = getConcurrentDevices(subgraphDevices, _subgraphDependencies,
+                                                  isPipelineParallel(importedConfigs));
+
+    std::vector<NetworkDesc> descs;
     FOREACH_CHILD(subnetworkNode, subnetworksNode, "subnetwork") {
         auto deviceName = GetStrAttr(subnetworkNode, "device");
 
         auto metaDevices = _heteroPlugin->GetDevicePlugins(deviceName, importedConfigs);
         assert(metaDevices.size() == 1);
         auto& loadConfig = metaDevices[deviceName];
+        if (concurrentDevices.count(deviceName) != 0) {
+            disableExclusiveAsyncRequests(loadConfig);
+        }
 
         InferenceEngine::SoExecutableNetworkInternal executableNetwork;
         CNNNetwork cnnnetwork;
@@ -551,6 +642,7 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream&
     // save state
     this->_config = importedConfigs;
     this->_networks = std::move(descs);
+    InitRequestPools();
     this->SetPointerToPlugin(_heteroPlugin->shared_from_this());
 }
 
@@ -643,6 +735,49 @@ void HeteroExecutableNetwork::Export(std::ostream& heteroModel) {
     }
 }
 
+void HeteroExecutableNetwork::InitSubgraphDependencies(const std::vector<std::vector<std::string>>& inputs,
+                                                       const std::vector<std::vector<std::string>>& outputs) {
+    // Subgraph depends on the subgraphs which produce its inputs. Subgraphs are topologically sorted,
+    // so the producer is always found among the previous ones.
+    std::unordered_map<std::string, std::size_t> producers;
+    _subgraphDependencies.assign(inputs.size(), {});
+    for (std::size_t id = 0; id < inputs.size(); ++id) {
+        for (auto&& input : inputs[id]) {
+            auto itName = _blobNameMap.find(input);
+            if (itName == _blobNameMap.end()) {
+                continue;
+            }
+            auto itProducer = producers.find(itName->second);
+            if (itProducer != producers.end() &&
+                std::find(_subgraphDependencies[id].begin(), _subgraphDependencies[id].end(), itProducer->second)
+                    == _subgraphDependencies[id].end()) {
+                _subgraphDependencies[id].push_back(itProducer->second);
+            }
+        }
+        for (auto&& output : outputs[id]) {
+            producers.emplace(output, id);
+        }
+    }
+}
+
+void HeteroExecutableNetwork::InitRequestPools() {
+    _requestPools.clear();
+    if (!isPipelineParallel(_config)) {
+        return;
+    }
+    auto itPerfCount = _config.find(CONFIG_KEY(PERF_COUNT));
+    const bool perfCount = itPerfCount != _config.end() && itPerfCount->second == YES;
+    // Every stage gets as many requests as its device needs to be fully loaded
+    for (auto&& network : _networks) {
+        unsigned int optimalNumberOfRequests = 1u;
+        try {
+            optimalNumberOfRequests = std::max(1u,
+                network._network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>());
+        } catch (const InferenceEngine::Exception&) {}
+        _requestPools.push_back(std::make_shared<HeteroRequestPool>(network._network, optimalNumberOfRequests, perfCount));
+    }
+}
+
 IInferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(
         InputsDataMap networkInputs,
         OutputsDataMap networkOutputs) {
@@ -651,7 +786,12 @@ IInferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(
     for (auto&& subnetwork : _networks) {
         HeteroInferRequest::SubRequestDesc desc;
         desc._network = subnetwork._network;
-        desc._profilingTask = openvino::itt::handle("Infer" + std::to_string(index++));
+        desc._profilingTask = openvino::itt::handle("Infer" + std::to_string(index));
+        desc._dependencies = _subgraphDependencies[index];
+        if (!_requestPools.empty()) {
+            desc._pool = _requestPools[index];
+        }
+        ++index;
         inferRequests.push_back(desc);
     }
     return std::make_shared<HeteroInferRequest>(networkInputs,
@@ -674,6 +814,7 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetConfig(const std::string
             result = std::string{};
         }
     } else if (name == HETERO_CONFIG_KEY(DUMP_GRAPH_DOT) ||
+               name == HETERO_CONFIG_KEY(PIPELINE_PARALLEL) ||
                name == CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)) {
         auto it = _config.find(name);
         IE_ASSERT(it != _config.end());
@@ -762,6 +903,7 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string
         std::vector<std::string> heteroConfigKeys = {
             "TARGET_FALLBACK",
             HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+            HETERO_CONFIG_KEY(PIPELINE_PARALLEL),
             CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)
         };
 
@@ -786,7 +928,9 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string
     } else if (EXEC_NETWORK_METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS) == name) {
         unsigned int value = 0u;
         for (auto&& desc : _networks) {
-            value = std::max(value, desc._network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>());
+            auto networkValue = desc._network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+            // all stages of the pipeline should be busy at once
+            value = _requestPools.empty() ? std::max(value, networkValue) : value + networkValue;
         }
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, value);
     } else {
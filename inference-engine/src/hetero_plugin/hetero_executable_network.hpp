@@ -61,6 +61,9 @@ public:
 private:
     void InitCNNImpl(const InferenceEngine::CNNNetwork&    network);
     void InitNgraph(const InferenceEngine::CNNNetwork&     network);
+    void InitSubgraphDependencies(const std::vector<std::vector<std::string>>& inputs,
+                                  const std::vector<std::vector<std::string>>& outputs);
+    void InitRequestPools();
 
     struct NetworkDesc {
         std::string                                   _device;
@@ -73,6 +76,8 @@ private:
     std::string                                  _name;
     std::map<std::string, std::string>           _config;
     std::unordered_map<std::string, std::string> _blobNameMap;
+    std::vector<std::vector<std::size_t>>        _subgraphDependencies;
+    std::vector<HeteroRequestPool::Ptr>          _requestPools;
 };
 
 }  // namespace HeteroPlugin
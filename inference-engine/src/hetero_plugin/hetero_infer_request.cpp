@@ -5,6 +5,7 @@
 #include "hetero_infer_request.hpp"
 #include "hetero_itt.hpp"
 #include <ie_blob.h>
+#include <blob_factory.hpp>
 #include <description_buffer.hpp>
 #include <ie_layouts.h>
 #include <ie_algorithm.hpp>
@@ -21,12 +22,15 @@ HeteroInferRequest::HeteroInferRequest(InferenceEngine::InputsDataMap networkInp
                                        const SubRequestsList& inferRequests,
                                        const std::unordered_map<std::string, std::string>& subgraphInputToOutputBlobNames) :
     IInferRequestInternal(networkInputs, networkOutputs),
-    _inferRequests(inferRequests) {
+    _inferRequests(inferRequests),
+    _subgraphInputToOutputBlobNames(subgraphInputToOutputBlobNames) {
     if (_networkOutputs.empty() || _networkInputs.empty()) {
         IE_THROW() << "Internal error: no information about network's output/input";
     }
 
-    auto requestBlob([&](const std::string& blobName, InferenceEngine::SoIInferRequestInternal& r) {
+    // Subnetwork requests from the pool are bound to the blobs of this request before each run,
+    // so the blobs are allocated here
+    auto requestBlob([&](const std::string& blobName, const TensorDesc& desc, InferenceEngine::SoIInferRequestInternal& r) {
         std::string intermediateBlobName = blobName;
         auto itName = subgraphInputToOutputBlobNames.find(blobName);
         if (itName != subgraphInputToOutputBlobNames.end()) {
@@ -36,30 +40,37 @@ HeteroInferRequest::HeteroInferRequest(InferenceEngine::InputsDataMap networkInp
         bool emplaced = false;
         std::tie(itBlob, emplaced) = _blobs.emplace(intermediateBlobName, Blob::Ptr{});
         if (emplaced) {
-            itBlob->second = r->GetBlob(blobName);
+            if (r) {
+                itBlob->second = r->GetBlob(blobName);
+            } else {
+                itBlob->second = make_blob_with_precision(desc);
+                itBlob->second->allocate();
+            }
             if (InferenceEngine::details::contains(networkInputs, blobName)) {
                 _inputs[blobName] = itBlob->second;
             } else if (InferenceEngine::details::contains(networkOutputs, blobName)) {
                 _outputs[blobName] = itBlob->second;
             }
-        } else {
+        } else if (r) {
             r->SetBlob(blobName, itBlob->second);
         }
     });
 
     // go over all subnet and create requests
     for (auto&& desc : _inferRequests) {
-        desc._request = { desc._network, desc._network->CreateInferRequest() };
+        if (!desc._pool) {
+            desc._request = { desc._network, desc._network->CreateInferRequest() };
+        }
         // go over all inputs and get blobs from subnet infer requests
         for (auto&& outputInfo : desc._network->GetOutputsInfo()) {
-            requestBlob(outputInfo.first, desc._request);
+            requestBlob(outputInfo.first, outputInfo.second->getTensorDesc(), desc._request);
         }
     }
 
     // go over all outputs and get blobs from subnet infer requests
     for (auto&& desc : _inferRequests) {
         for (auto&& inputInfo : desc._network->GetInputsInfo()) {
-            requestBlob(inputInfo.first, desc._request);
+            requestBlob(inputInfo.first, inputInfo.second->getTensorDesc(), desc._request);
         }
     }
 }
@@ -68,6 +79,9 @@ void HeteroInferRequest::SetBlob(const std::string& name, const InferenceEngine:
     InferenceEngine::IInferRequestInternal::SetBlob(name, data);
     assert(!_inferRequests.empty());
     for (auto &&desc : _inferRequests) {
+        if (desc._pool) {
+            continue;
+        }
         auto &r = desc._request;
         assert(r);
         InputInfo::Ptr foundInput;
@@ -82,9 +96,12 @@ void HeteroInferRequest::SetBlob(const std::string& name, const InferenceEngine:
 }
 
 void HeteroInferRequest::InferImpl() {
+    // HeteroAsyncInferRequest infers subgraphs itself, including the ones served by request pools,
+    // so only a request created without the pipeline parallel mode can be inferred here
     updateInOutIfNeeded();
     for (auto &&desc : _inferRequests) {
         OV_ITT_SCOPED_TASK(itt::domains::HeteroPlugin, desc._profilingTask);
+        IE_ASSERT(!desc._pool);
         auto &r = desc._request;
         assert(r);
         r->Infer();
@@ -94,7 +111,10 @@ void HeteroInferRequest::InferImpl() {
 std::map<std::string, InferenceEngineProfileInfo> HeteroInferRequest::GetPerformanceCounts() const {
     std::map<std::string, InferenceEngineProfileInfo> perfMap;
     for (size_t i = 0; i < _inferRequests.size(); i++) {
-        auto perfMapRequest = _inferRequests[i]._request->GetPerformanceCounts();
+        // in the pipeline parallel mode the shared request may be used by another HETERO request,
+        // so counters taken right after its run are reported
+        auto perfMapRequest = _inferRequests[i]._pool ? _inferRequests[i]._perfCounts
+                                                      : _inferRequests[i]._request->GetPerformanceCounts();
         for (auto &&r : perfMapRequest) {
             perfMap[std::string("subgraph") + std::to_string(i) + ": " + r.first] = r.second;
         }
@@ -106,6 +126,9 @@ void HeteroInferRequest::updateInOutIfNeeded() {
     OV_ITT_SCOPED_TASK(itt::domains::HeteroPlugin, "updateInOutIfNeeded");
     assert(!_inferRequests.empty());
     for (auto &&desc : _inferRequests) {
+        if (desc._pool) {
+            continue;
+        }
         auto &r = desc._request;
         assert(r);
         for (auto&& inputInfo : desc._network->GetInputsInfo()) {
@@ -138,3 +161,28 @@ void HeteroInferRequest::updateInOutIfNeeded() {
         }
     }
 }
+
+void HeteroInferRequest::bindSubRequest(std::size_t subgraphId, InferenceEngine::SoIInferRequestInternal& request) {
+    auto& desc = _inferRequests[subgraphId];
+    for (auto&& inputInfo : desc._network->GetInputsInfo()) {
+        auto& ioname = inputInfo.first;
+        auto iti = _inputs.find(ioname);
+        if (iti != _inputs.end()) {
+            // pre-processing is done by the subnetwork request as in the default mode
+            auto it = _preProcData.find(ioname);
+            auto blob = (it != _preProcData.end()) ? it->second->getRoiBlob() : iti->second;
+            request->SetBlob(ioname, blob, _networkInputs[ioname]->getPreProcess());
+        } else {
+            // intermediate blob may also be a network output replaced by the user
+            auto itName = _subgraphInputToOutputBlobNames.find(ioname);
+            auto& blobName = (itName != _subgraphInputToOutputBlobNames.end()) ? itName->second : ioname;
+            auto ito = _outputs.find(blobName);
+            request->SetBlob(ioname, (ito != _outputs.end()) ? ito->second : _blobs.at(blobName));
+        }
+    }
+    for (auto&& outputInfo : desc._network->GetOutputsInfo()) {
+        auto& ioname = outputInfo.first;
+        auto ito = _outputs.find(ioname);
+        request->SetBlob(ioname, (ito != _outputs.end()) ? ito->second : _blobs.at(ioname));
+    }
+}
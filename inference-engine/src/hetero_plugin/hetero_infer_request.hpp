@@ -13,6 +13,7 @@
 #include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
 #include <cpp_interfaces/interface/ie_iexecutable_network_internal.hpp>
 #include <openvino/itt.hpp>
+#include "hetero_request_pool.hpp"
 
 namespace HeteroPlugin {
 
@@ -24,6 +25,9 @@ public:
         InferenceEngine::SoExecutableNetworkInternal  _network;
         InferenceEngine::SoIInferRequestInternal      _request;
         openvino::itt::handle_t                       _profilingTask;
+        std::vector<std::size_t>                      _dependencies;  //!< Subgraphs which outputs are inputs of this one
+        HeteroRequestPool::Ptr                        _pool;          //!< Shared requests, set in the pipeline parallel mode
+        std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> _perfCounts;  //!< Counters of the last run of a shared request
     };
     using SubRequestsList = std::vector<SubRequestDesc>;
 
@@ -40,8 +44,14 @@ public:
 
     void updateInOutIfNeeded();
 
+    /**
+     * @brief Sets blobs of this request to the subnetwork request taken from the pool of the subgraph
+     */
+    void bindSubRequest(std::size_t subgraphId, InferenceEngine::SoIInferRequestInternal& request);
+
     SubRequestsList _inferRequests;
     std::map<std::string, InferenceEngine::Blob::Ptr>   _blobs;
+    std::unordered_map<std::string, std::string>        _subgraphInputToOutputBlobNames;
 };
 
 }  // namespace HeteroPlugin
@@ -22,8 +22,10 @@ using namespace HeteroPlugin;
 
 Engine::Engine() {
     _pluginName = "HETERO";
+    // The devices which infer independent subgraphs or pipeline stages concurrently don't get the exclusive mode
     _config[KEY_EXCLUSIVE_ASYNC_REQUESTS] = YES;
     _config[HETERO_CONFIG_KEY(DUMP_GRAPH_DOT)] = NO;
+    _config[HETERO_CONFIG_KEY(PIPELINE_PARALLEL)] = NO;
 }
 
 namespace {
@@ -36,6 +38,7 @@ Engine::Configs mergeConfigs(Engine::Configs config, const Engine::Configs & loc
 }
 std::vector<std::string> supported_configKeys {
     HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+    HETERO_CONFIG_KEY(PIPELINE_PARALLEL),
     "TARGET_FALLBACK",
     CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)
 };
@@ -207,6 +210,11 @@ Parameter Engine::GetConfig(const std::string& name, const std::map<std::string,
         IE_ASSERT(it != _config.end());
         bool dump = it->second == YES;
         return { dump };
+    } else if (name == HETERO_CONFIG_KEY(PIPELINE_PARALLEL)) {
+        auto it = _config.find(HETERO_CONFIG_KEY(PIPELINE_PARALLEL));
+        IE_ASSERT(it != _config.end());
+        bool pipelineParallel = it->second == YES;
+        return { pipelineParallel };
     } else if (name == "TARGET_FALLBACK") {
         auto it = _config.find("TARGET_FALLBACK");
         if (it == _config.end()) {
@@ -0,0 +1,75 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "hetero_request_pool.hpp"
+
+#include <threading/ie_cpu_streams_executor.hpp>
+
+#include <utility>
+
+using namespace HeteroPlugin;
+using namespace InferenceEngine;
+
+HeteroRequestPool::HeteroRequestPool(const SoExecutableNetworkInternal& network, std::size_t size, bool perfCount) :
+    _callbacks(size),
+    // Every pool has its own executor, so stages of the pipeline don't wait for each other to pass requests
+    _executor(std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"HeteroRequestPool"})),
+    _perfCount(perfCount) {
+    IE_ASSERT(size > 0);
+    _requests.reserve(size);
+    for (std::size_t requestId = 0; requestId < size; ++requestId) {
+        _requests.push_back({network, network->CreateInferRequest()});
+        _requests.back()->SetCallback([this, requestId] (std::exception_ptr exceptionPtr) {
+            OnDone(requestId, exceptionPtr);
+        });
+        _idleRequests.push_back(requestId);
+    }
+}
+
+void HeteroRequestPool::Acquire(Consumer consumer) {
+    std::size_t requestId = 0;
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        if (_idleRequests.empty()) {
+            _consumers.push(std::move(consumer));
+            return;
+        }
+        requestId = _idleRequests.back();
+        _idleRequests.pop_back();
+    }
+    consumer(requestId);
+}
+
+void HeteroRequestPool::Release(std::size_t requestId) {
+    Consumer consumer;
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        if (_consumers.empty()) {
+            _idleRequests.push_back(requestId);
+            return;
+        }
+        consumer = std::move(_consumers.front());
+        _consumers.pop();
+    }
+    _executor->run([consumer, requestId] {
+        consumer(requestId);
+    });
+}
+
+void HeteroRequestPool::StartAsync(std::size_t requestId, Callback callback) {
+    // The request is owned by the caller until it is released, so the callback is not accessed concurrently
+    _callbacks[requestId] = std::move(callback);
+    try {
+        _requests[requestId]->StartAsync();
+    } catch (...) {
+        _callbacks[requestId] = {};
+        throw;
+    }
+}
+
+void HeteroRequestPool::OnDone(std::size_t requestId, std::exception_ptr exceptionPtr) {
+    auto callback = std::move(_callbacks[requestId]);
+    _callbacks[requestId] = {};
+    callback(exceptionPtr);
+}
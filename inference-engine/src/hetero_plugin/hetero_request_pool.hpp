@@ -0,0 +1,80 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief a header file for the pool of subnetwork infer requests
+ * @file hetero_request_pool.hpp
+ */
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <vector>
+
+#include <cpp_interfaces/interface/ie_iexecutable_network_internal.hpp>
+#include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
+#include <threading/ie_itask_executor.hpp>
+
+namespace HeteroPlugin {
+
+/**
+ * @brief Infer requests of a single subnetwork shared by all HETERO infer requests in the pipeline parallel mode.
+ *
+ * Consumers which find no idle request are queued and served in order as soon as requests are released.
+ * The number of queued consumers is bounded by the number of subgraph runs in flight. Released requests are passed
+ * to queued consumers through the own executor of the pool, so a consumer never runs inside the completion callback
+ * of the request and pools of different stages pass requests independently.
+ * Completion callbacks of the pooled requests are set once, users of the pool start requests with StartAsync().
+ */
+class HeteroRequestPool {
+public:
+    using Ptr = std::shared_ptr<HeteroRequestPool>;
+    using Consumer = std::function<void(std::size_t)>;
+    using Callback = std::function<void(std::exception_ptr)>;
+
+    /**
+     * @param network   Subnetwork to create requests of
+     * @param size      Number of requests
+     * @param perfCount Whether users of the pool collect performance counters of the requests
+     */
+    HeteroRequestPool(const InferenceEngine::SoExecutableNetworkInternal& network, std::size_t size, bool perfCount);
+
+    /**
+     * @brief Passes the index of an idle request to the consumer immediately or once some request is released
+     */
+    void Acquire(Consumer consumer);
+
+    /**
+     * @brief Returns the request to the pool or passes it to the first queued consumer
+     */
+    void Release(std::size_t requestId);
+
+    /**
+     * @brief Starts the acquired request, the callback is called once the request is done
+     */
+    void StartAsync(std::size_t requestId, Callback callback);
+
+    bool PerfCountEnabled() const {
+        return _perfCount;
+    }
+
+    InferenceEngine::SoIInferRequestInternal& operator[](std::size_t requestId) {
+        return _requests[requestId];
+    }
+
+private:
+    void OnDone(std::size_t requestId, std::exception_ptr exceptionPtr);
+
+    std::vector<InferenceEngine::SoIInferRequestInternal>   _requests;
+    std::vector<Callback>                                   _callbacks;
+    InferenceEngine::ITaskExecutor::Ptr                     _executor;
+    bool                                                    _perfCount = false;
+    std::mutex                                              _mutex;
+    std::vector<std::size_t>                                _idleRequests;
+    std::queue<Consumer>                                    _consumers;
+};
+
+}  // namespace HeteroPlugin
@@ -0,0 +1,138 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace InferenceEngine {
+
+/**
+ * @brief Advisory lock of a file which works across threads and processes.
+ *
+ * The file is created if it doesn't exist. Every FileLock object opens its own handle, so two objects
+ * locking the same file exclude each other even inside one process. The lock is released on destruction.
+ */
+class FileLock final {
+public:
+    /**
+     * @brief Locks the file, throws if the file can't be created or locked
+     * @param path Path to the lock file
+     * @param exclusive Exclusive lock if true, shared lock otherwise
+     */
+    FileLock(const std::string& path, bool exclusive);
+    FileLock(const FileLock&) = delete;
+    FileLock& operator=(const FileLock&) = delete;
+    ~FileLock();
+
+private:
+    intptr_t _handle;
+};
+
+/**
+ * @brief Identifies a file independently of its name, e.g. device and inode numbers
+ */
+struct FileIdentity {
+    uint64_t device = 0;
+    uint64_t index = 0;
+
+    bool operator==(const FileIdentity& other) const {
+        return device == other.device && index == other.index;
+    }
+};
+
+/**
+ * @brief File opened for reading at arbitrary offsets.
+ *
+ * The file may be renamed over or removed while it is open, the object keeps reading the original content.
+ */
+class ReadOnlyFile final {
+public:
+    /**
+     * @brief Opens the file, isOpen() tells whether it succeeded
+     * @param path Path to the file
+     */
+    explicit ReadOnlyFile(const std::string& path);
+    ReadOnlyFile(const ReadOnlyFile&) = delete;
+    ReadOnlyFile& operator=(const ReadOnlyFile&) = delete;
+    ~ReadOnlyFile();
+
+    bool isOpen() const {
+        return _open;
+    }
+
+    uint64_t size() const {
+        return _size;
+    }
+
+    const FileIdentity& identity() const {
+        return _identity;
+    }
+
+    /**
+     * @brief Reads up to size bytes starting at the offset
+     * @return Number of bytes read, less than size only at the end of the file or on error
+     */
+    size_t read(uint64_t offset, char* data, size_t size) const;
+
+private:
+    intptr_t _handle;
+    bool _open = false;
+    uint64_t _size = 0;
+    FileIdentity _identity;
+};
+
+/**
+ * @brief Gets identity of the file the path refers to
+ * @return false if the file doesn't exist or can't be accessed
+ */
+bool getFileIdentity(const std::string& path, FileIdentity& identity);
+
+/**
+ * @brief Description of a file in a directory listing
+ */
+struct FileEntry {
+    std::string name;       //!< Name of the file without directory
+    uint64_t size;          //!< Size of the file in bytes
+    int64_t lastWriteTime;  //!< Modification time, units are platform specific but comparable between entries
+};
+
+/**
+ * @brief Lists regular files of a directory with the given name suffix. Subdirectories are not visited.
+ * @param dirPath Path to the directory
+ * @param suffix Required end of the file name (e.g. ".blob")
+ * @return Files found; empty if the directory can't be read
+ */
+std::vector<FileEntry> listFiles(const std::string& dirPath, const std::string& suffix);
+
+/**
+ * @brief Sets modification time of the file to the current time
+ * @param path Path to the file
+ */
+void touchFile(const std::string& path);
+
+/**
+ * @brief Atomically renames the file, an existing destination file is replaced
+ * @param from Source path
+ * @param to Destination path
+ * @return true on success
+ */
+bool replaceFile(const std::string& from, const std::string& to);
+
+/**
+ * @brief Returns identifier of the current process
+ */
+uint64_t getProcessId();
+
+/**
+ * @brief Checks whether a process with the given identifier is running
+ * @param pid Identifier returned by getProcessId() in that process
+ * @return false if the process doesn't exist
+ */
+bool isProcessAlive(uint64_t pid);
+
+}  // namespace InferenceEngine
@@ -23,6 +23,13 @@
 #include "transformations/rt_info/fused_names_attribute.hpp"
 #include "transformations/rt_info/primitives_priority_attribute.hpp"
 #include "file_utils.h"
+#include "ie_parallel.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <set>
+#include <sstream>
+#include <unordered_map>
 
 #ifdef WIN32
 #define stat _stat
@@ -62,6 +69,226 @@ public:
     }
 };
 
+// MurmurHash64A: processes 8 bytes per step and mixes every word, so unlike a plain sum
+// it is sensitive to the order of values
+static uint64_t hashBytes(const char* data, size_t size, uint64_t seed) {
+    const uint64_t m = 0xc6a4a7935bd1e995ULL;
+    const int r = 47;
+    uint64_t h = seed ^ (size * m);
+
+    const size_t n64 = size / sizeof(uint64_t);
+    for (size_t i = 0; i < n64; i++) {
+        uint64_t k;
+        std::memcpy(&k, data + i * sizeof(uint64_t), sizeof(k));
+        k *= m;
+        k ^= k >> r;
+        k *= m;
+        h ^= k;
+        h *= m;
+    }
+
+    const size_t rest = size % sizeof(uint64_t);
+    if (rest != 0) {
+        uint64_t k = 0;
+        std::memcpy(&k, data + n64 * sizeof(uint64_t), rest);
+        h ^= k;
+        h *= m;
+    }
+
+    h ^= h >> r;
+    h *= m;
+    h ^= h >> r;
+    return h;
+}
+
+// Hashes operation attributes without serialization to XML. Attributes which can't be hashed reliably
+// (sub-graph bodies, references to nodes, custom structures) make the whole network unsupported
+class AttributesHasher final : public ngraph::AttributeVisitor {
+    size_t m_seed = 0;
+    bool m_supported = true;
+
+    template <typename T>
+    void add(const std::string& name, const T& value) {
+        m_seed = hash_combine(m_seed, name);
+        m_seed = hash_combine(m_seed, value);
+    }
+
+    template <typename T>
+    void addVector(const std::string& name, const std::vector<T>& values) {
+        m_seed = hash_combine(m_seed, name);
+        m_seed = hash_combine(m_seed, values.size());
+        for (const auto& value : values)
+            m_seed = hash_combine(m_seed, value);
+    }
+
+public:
+    explicit AttributesHasher(size_t seed) : m_seed(seed) {}
+
+    size_t getResult() const { return m_seed; }
+    bool isSupported() const { return m_supported; }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) override {
+        if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<std::shared_ptr<ngraph::Variable>>>(&adapter)) {
+            const auto& info = a->get()->get_info();
+            add(name, info.variable_id);
+            m_seed = hash_combine(m_seed, info.data_type.get_type_name());
+            std::ostringstream shape;
+            shape << info.data_shape;
+            m_seed = hash_combine(m_seed, shape.str());
+        } else {
+            m_supported = false;
+        }
+    }
+
+    void on_adapter(const std::string& name, ngraph::VisitorAdapter& adapter) override {
+        if (ngraph::is_type<ngraph::AttributeAdapter<ngraph::op::AutoBroadcastSpec>>(&adapter) ||
+            ngraph::is_type<ngraph::AttributeAdapter<ngraph::op::BroadcastModeSpec>>(&adapter)) {
+            m_seed = hash_combine(m_seed, name);
+            adapter.visit_attributes(*this);
+        } else {
+            m_supported = false;
+        }
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::shared_ptr<ngraph::Function>>& adapter) override {
+        m_supported = false;
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::string>& adapter) override { add(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<bool>& adapter) override { add(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int8_t>& adapter) override { add(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int16_t>& adapter) override { add(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int32_t>& adapter) override { add(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int64_t>& adapter) override { add(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint8_t>& adapter) override { add(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint16_t>& adapter) override { add(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint32_t>& adapter) override { add(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint64_t>& adapter) override { add(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<float>& adapter) override { add(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<double>& adapter) override { add(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int8_t>>& adapter) override { addVector(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int16_t>>& adapter) override { addVector(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int32_t>>& adapter) override { addVector(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int64_t>>& adapter) override { addVector(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint8_t>>& adapter) override { addVector(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint16_t>>& adapter) override { addVector(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint32_t>>& adapter) override { addVector(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint64_t>>& adapter) override { addVector(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<float>>& adapter) override { addVector(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<double>>& adapter) override { addVector(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::string>>& adapter) override { addVector(name, adapter.get()); }
+};
+
+// Hashes constants data in parallel. Large constants are split into chunks, so a few huge weights
+// are spread over all the threads as well
+static size_t hashConstants(const std::vector<std::shared_ptr<ngraph::opset6::Constant>>& constants) {
+    constexpr size_t chunkSize = 1 << 20;
+
+    struct Chunk {
+        const char* data;
+        size_t size;
+    };
+    std::vector<Chunk> chunks;
+    for (const auto& constant : constants) {
+        const auto byteSize = (ngraph::shape_size(constant->get_shape()) * constant->get_element_type().bitwidth() + 7) / 8;
+        const auto data = constant->get_data_ptr<char>();
+        for (size_t offset = 0; offset < byteSize; offset += chunkSize) {
+            chunks.push_back({data + offset, std::min(chunkSize, byteSize - offset)});
+        }
+    }
+
+    std::vector<uint64_t> chunkHashes(chunks.size());
+    parallel_for(chunks.size(), [&](size_t i) {
+        chunkHashes[i] = hashBytes(chunks[i].data, chunks[i].size, i);
+    });
+
+    return static_cast<size_t>(hashBytes(reinterpret_cast<const char*>(chunkHashes.data()),
+                                         chunkHashes.size() * sizeof(uint64_t), chunkHashes.size()));
+}
+
+// Structural hash of the function: operations in topological order with their attributes,
+// connections and names. Returns false if the function contains attributes which can't be hashed
+// without serialization.
+static bool computeStructuralHash(const ngraph::Function& function, size_t& seed) {
+    const auto orderedOps = function.get_ordered_ops();
+    std::unordered_map<const ngraph::Node*, size_t> opIds;
+    std::vector<std::shared_ptr<ngraph::opset6::Constant>> constants;
+
+    for (const auto& op : orderedOps) {
+        const auto opId = opIds.size();
+        opIds[op.get()] = opId;
+
+        const auto& typeInfo = op->get_type_info();
+        seed = hash_combine(seed, std::string(typeInfo.name));
+        seed = hash_combine(seed, typeInfo.version);
+        seed = hash_combine(seed, op->get_friendly_name());
+
+        for (const auto& input : op->input_values()) {
+            seed = hash_combine(seed, opIds.at(input.get_node()));
+            seed = hash_combine(seed, input.get_index());
+        }
+        for (const auto& dependency : op->get_control_dependencies()) {
+            seed = hash_combine(seed, opIds.at(dependency.get()));
+        }
+
+        for (const auto& output : op->outputs()) {
+            seed = hash_combine(seed, output.get_element_type().get_type_name());
+            std::ostringstream shape;
+            shape << output.get_partial_shape();
+            seed = hash_combine(seed, shape.str());
+            const auto& tensorNames = output.get_tensor().get_names();
+            std::set<std::string> names(tensorNames.begin(), tensorNames.end());
+            for (const auto& name : names) {
+                seed = hash_combine(seed, name);
+            }
+        }
+
+        if (auto constant = std::dynamic_pointer_cast<ngraph::opset6::Constant>(op)) {
+            // data is hashed separately, type and shape are already taken from the output
+            constants.push_back(constant);
+            continue;
+        }
+
+        AttributesHasher attributes(seed);
+        if (!op->visit_attributes(attributes) || !attributes.isSupported()) {
+            return false;
+        }
+        seed = attributes.getResult();
+    }
+
+    // Order of parameters and results defines the network inputs and outputs
+    for (const auto& parameter : function.get_parameters()) {
+        seed = hash_combine(seed, opIds.at(parameter.get()));
+    }
+    for (const auto& result : function.get_results()) {
+        seed = hash_combine(seed, opIds.at(result.get()));
+    }
+    for (const auto& sink : function.get_sinks()) {
+        seed = hash_combine(seed, opIds.at(sink.get()));
+    }
+
+    seed = hash_combine(seed, hashConstants(constants));
+    return true;
+}
+
+// Fallback for networks with attributes which can't be hashed structurally
+static size_t computeSerializedHash(const CNNNetwork& network) {
+    OstreamHashWrapper xmlHash;
+    OstreamHashWrapper binHash;
+    std::ostream xml(&xmlHash);
+    std::ostream bin(&binHash);
+
+    CNNNetwork net(network);
+    ngraph::pass::Serialize serializer(xml, bin,
+        ngraph::pass::Serialize::Version::IR_V10);
+    serializer.run_on_function(net.getFunction());
+
+    size_t seed = 0;
+    seed = hash_combine(seed, xmlHash.getResult());
+    seed = hash_combine(seed, binHash.getResult());
+    return seed;
+}
+
 //////////////////////////////////////////////////
 
 std::string NetworkCompilationContext::calculateFileInfo(const std::string& filePath) {
@@ -87,24 +314,17 @@ std::string NetworkCompilationContext::calculateFileInfo(const std::string& file
 std::string NetworkCompilationContext::computeHash(const CNNNetwork& network,
                                const std::map<std::string, std::string>& compileOptions) {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::IE_LT, "NetworkCompilationContext::computeHash - CNN");
-    OstreamHashWrapper xmlHash;
-    OstreamHashWrapper binHash;
-    std::ostream xml(&xmlHash);
-    std::ostream bin(&binHash);
 
     IE_ASSERT(network.getFunction());
 
-    // 1. Serialize
-    CNNNetwork net(network);
-    ngraph::pass::Serialize serializer(xml, bin,
-        ngraph::pass::Serialize::Version::IR_V10);
-    serializer.run_on_function(net.getFunction());
-
-    // 2. Compute hash on serialized data and options
+    // 1. Compute hash of the network structure and weights, serialization is used only when
+    //    some of the attributes can't be hashed directly
     size_t seed = 0;
-    seed = hash_combine(seed, xmlHash.getResult());
-    seed = hash_combine(seed, binHash.getResult());
+    if (!computeStructuralHash(*network.getFunction(), seed)) {
+        seed = computeSerializedHash(network);
+    }
 
+    // 2. Add compilation options
     for (const auto& kvp : compileOptions) {
         seed = hash_combine(seed, kvp.first + kvp.second);
     }
@@ -0,0 +1,365 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_cache_manager.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "cache_file_utils.hpp"
+#include "ie_common.h"
+
+namespace InferenceEngine {
+
+namespace {
+
+const char kBlobExtension[] = ".blob";
+const char kTmpExtension[] = ".tmp";
+const char kEntryMagic[8] = {'I', 'E', 'C', 'A', 'C', 'H', 'E', '1'};
+constexpr size_t kChunkSize = 1 << 20;
+constexpr uint64_t kChecksumSeed = 14695981039346656037ull;
+
+struct EntryHeader {
+    char magic[sizeof(kEntryMagic)];
+    uint64_t payloadSize;
+    uint64_t checksum;
+};
+
+uint64_t updateChecksum(uint64_t hash, const char* data, size_t size) {
+    // FNV-1a over 8 byte words, the tail is processed byte by byte
+    const uint64_t prime = 1099511628211ull;
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+        uint64_t word;
+        std::memcpy(&word, data + i, sizeof(word));
+        hash = (hash ^ word) * prime;
+    }
+    for (; i < size; i++)
+        hash = (hash ^ static_cast<uint8_t>(data[i])) * prime;
+    return hash;
+}
+
+/**
+ * Passes written data to the file stream and computes the checksum on the way. Data is hashed in chunks
+ * of kChunkSize bytes, so the checksum doesn't depend on how the writer splits its output or flushes the stream.
+ */
+class ChecksumStreamBuf : public std::streambuf {
+public:
+    explicit ChecksumStreamBuf(std::ostream& sink) : _sink(sink), _buffer(kChunkSize) {
+        setp(_buffer.data(), _buffer.data() + _buffer.size());
+    }
+
+    // Writes the buffered tail, returns false if the file stream failed
+    bool finish() {
+        return flushChunk();
+    }
+
+    uint64_t checksum() const {
+        return _checksum;
+    }
+
+    uint64_t size() const {
+        return _size;
+    }
+
+protected:
+    int_type overflow(int_type ch) override {
+        if (!flushChunk())
+            return traits_type::eof();
+        if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+            *pptr() = traits_type::to_char_type(ch);
+            pbump(1);
+        }
+        return traits_type::not_eof(ch);
+    }
+
+    // The incomplete chunk stays in the buffer until it is filled or the entry is finished
+    int sync() override {
+        return 0;
+    }
+
+    // Only position queries (tellp) are supported
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override {
+        if (off == 0 && dir == std::ios_base::cur && (which & std::ios_base::out))
+            return pos_type(static_cast<off_type>(_size + (pptr() - pbase())));
+        return pos_type(off_type(-1));
+    }
+
+private:
+    bool flushChunk() {
+        const auto count = pptr() - pbase();
+        if (count != 0) {
+            _checksum = updateChecksum(_checksum, pbase(), count);
+            _sink.write(pbase(), count);
+            _size += count;
+            setp(_buffer.data(), _buffer.data() + _buffer.size());
+        }
+        return _sink.good();
+    }
+
+    std::ostream& _sink;
+    std::vector<char> _buffer;
+    uint64_t _checksum = kChecksumSeed;
+    uint64_t _size = 0;
+};
+
+uint64_t computeChecksum(const ReadOnlyFile& file, uint64_t offset, uint64_t size, bool& failed) {
+    std::vector<char> buffer(kChunkSize);
+    uint64_t checksum = kChecksumSeed;
+    for (uint64_t start = 0; start < size; start += kChunkSize) {
+        const auto count = static_cast<size_t>(std::min<uint64_t>(size - start, kChunkSize));
+        if (file.read(offset + start, buffer.data(), count) != count) {
+            failed = true;
+            break;
+        }
+        checksum = updateChecksum(checksum, buffer.data(), count);
+    }
+    return checksum;
+}
+
+/**
+ * Reads the payload of an entry in chunks. Positions are relative to the beginning of the payload.
+ */
+class EntryIStreamBuf : public std::streambuf {
+public:
+    EntryIStreamBuf(const ReadOnlyFile& file, uint64_t offset, uint64_t size) :
+        _file(file), _offset(offset), _size(size), _buffer(kChunkSize) {}
+
+protected:
+    int_type underflow() override {
+        if (gptr() < egptr())
+            return traits_type::to_int_type(*gptr());
+        const auto pos = position();
+        if (pos >= _size || !loadChunk(pos / kChunkSize))
+            return traits_type::eof();
+        setg(eback(), eback() + (pos - _chunkStart), egptr());
+        return traits_type::to_int_type(*gptr());
+    }
+
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override {
+        if (!(which & std::ios_base::in))
+            return pos_type(off_type(-1));
+        off_type base = 0;
+        if (dir == std::ios_base::cur)
+            base = static_cast<off_type>(position());
+        else if (dir == std::ios_base::end)
+            base = static_cast<off_type>(_size);
+        return seekpos(pos_type(base + off), which);
+    }
+
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which) override {
+        const auto target = static_cast<off_type>(pos);
+        if (!(which & std::ios_base::in) || target < 0 || static_cast<uint64_t>(target) > _size)
+            return pos_type(off_type(-1));
+        const auto offset = static_cast<uint64_t>(target);
+        if (offset >= _chunkStart && offset < _chunkStart + (egptr() - eback())) {
+            setg(eback(), eback() + (offset - _chunkStart), egptr());
+        } else {
+            // The chunk is loaded by the next underflow()
+            setg(nullptr, nullptr, nullptr);
+            _chunkStart = offset;
+        }
+        return pos;
+    }
+
+private:
+    uint64_t position() const {
+        return _chunkStart + (gptr() - eback());
+    }
+
+    bool loadChunk(uint64_t index) {
+        const auto start = index * kChunkSize;
+        const auto count = static_cast<size_t>(std::min<uint64_t>(_size - start, kChunkSize));
+        if (_file.read(_offset + start, _buffer.data(), count) != count)
+            return false;
+        _chunkStart = start;
+        setg(_buffer.data(), _buffer.data(), _buffer.data() + count);
+        return true;
+    }
+
+    const ReadOnlyFile& _file;
+    const uint64_t _offset;
+    const uint64_t _size;
+    std::vector<char> _buffer;
+    uint64_t _chunkStart = 0;
+};
+
+// Temporary files are named <id>.blob.<pid>_<counter>.tmp, see writeCacheEntry()
+bool getWriterProcessId(const std::string& tmpFileName, uint64_t& pid) {
+    const std::string prefix = std::string(kBlobExtension) + ".";
+    const auto begin = tmpFileName.rfind(prefix);
+    if (begin == std::string::npos)
+        return false;
+    const auto digits = begin + prefix.size();
+    const auto end = tmpFileName.find('_', digits);
+    if (end == std::string::npos || end == digits)
+        return false;
+    pid = 0;
+    for (auto i = digits; i < end; i++) {
+        if (tmpFileName[i] < '0' || tmpFileName[i] > '9')
+            return false;
+        pid = pid * 10 + static_cast<uint64_t>(tmpFileName[i] - '0');
+    }
+    return true;
+}
+
+}  // namespace
+
+void FileStorageCacheManager::writeCacheEntry(const std::string& id, StreamWriter writer) {
+    // Temporary file names are unique, so writers of the same entry don't need a lock
+    static std::atomic<uint64_t> tmpFileCounter{0};
+    const auto blobFileName = getBlobFile(id);
+    const auto tmpFileName = blobFileName + "." + std::to_string(getProcessId()) + "_" +
+                             std::to_string(tmpFileCounter++) + kTmpExtension;
+    bool written = false;
+    try {
+        std::ofstream file(tmpFileName, std::ios_base::binary | std::ios_base::out | std::ios_base::trunc);
+        if (!file.is_open())
+            return;
+
+        EntryHeader header = {};
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+        ChecksumStreamBuf buffer(file);
+        std::ostream stream(&buffer);
+        writer(stream);
+        written = stream.good() && buffer.finish();
+
+        std::memcpy(header.magic, kEntryMagic, sizeof(kEntryMagic));
+        header.payloadSize = buffer.size();
+        header.checksum = buffer.checksum();
+        file.seekp(0, std::ios_base::beg);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.close();
+        written = written && !file.fail();
+    } catch (...) {
+        std::remove(tmpFileName.c_str());
+        throw;
+    }
+
+    try {
+        if (!written)
+            IE_THROW() << "Cannot write cache file " << tmpFileName;
+        FileLock lock(getLockFile(), true);
+        if (!replaceFile(tmpFileName, blobFileName))
+            IE_THROW() << "Cannot rename cache file " << tmpFileName << " to " << blobFileName;
+        if (m_maxSize != 0)
+            evictEntries(id);
+    } catch (const std::exception&) {
+        // The network is just not cached
+        std::remove(tmpFileName.c_str());
+    }
+}
+
+void FileStorageCacheManager::readCacheEntry(const std::string& id, StreamReader reader) {
+    const auto blobFileName = getBlobFile(id);
+    // The file stays readable even if another process replaces or evicts the entry meanwhile
+    ReadOnlyFile file(blobFileName);
+    if (!file.isOpen())
+        return;
+
+    EntryHeader header;
+    if (file.size() < sizeof(header) ||
+        file.read(0, reinterpret_cast<char*>(&header), sizeof(header)) != sizeof(header) ||
+        std::memcmp(header.magic, kEntryMagic, sizeof(kEntryMagic)) != 0 ||
+        header.payloadSize != file.size() - sizeof(header)) {
+        removeEntry(id, &file.identity());
+        return;
+    }
+
+    // The whole entry is verified before the plugin parses it. The second pass is mostly served by the page cache
+    bool failed = false;
+    if (computeChecksum(file, sizeof(header), header.payloadSize, failed) != header.checksum || failed) {
+        removeEntry(id, &file.identity());
+        return;
+    }
+
+    touchFile(blobFileName);
+    {
+        std::lock_guard<std::mutex> lock(m_readEntriesMutex);
+        m_readEntries[id] = file.identity();
+    }
+
+    EntryIStreamBuf buffer(file, sizeof(header), header.payloadSize);
+    std::istream stream(&buffer);
+    reader(stream);
+
+    std::lock_guard<std::mutex> lock(m_readEntriesMutex);
+    m_readEntries.erase(id);
+}
+
+void FileStorageCacheManager::removeCacheEntry(const std::string& id) {
+    FileIdentity identity;
+    bool wasRead = false;
+    {
+        std::lock_guard<std::mutex> lock(m_readEntriesMutex);
+        auto it = m_readEntries.find(id);
+        if (it != m_readEntries.end()) {
+            identity = it->second;
+            wasRead = true;
+            m_readEntries.erase(it);
+        }
+    }
+    removeEntry(id, wasRead ? &identity : nullptr);
+}
+
+void FileStorageCacheManager::removeEntry(const std::string& id, const FileIdentity* expected) {
+    const auto blobFileName = getBlobFile(id);
+    try {
+        FileLock lock(getLockFile(), true);
+        FileIdentity current;
+        if (!getFileIdentity(blobFileName, current))
+            return;
+        // The entry was rewritten by somebody else after it had been read, the new one is kept
+        if (expected != nullptr && !(current == *expected))
+            return;
+        if (std::remove(blobFileName.c_str()) != 0)
+            IE_THROW() << "Cannot remove cache file " << blobFileName;
+    } catch (const std::exception&) {
+        // The entry stays in the cache, it is verified again by the next reader
+    }
+}
+
+void FileStorageCacheManager::evictEntries(const std::string& keepId) {
+    // Called under the cache lock
+    uint64_t totalSize = 0;
+    // Files of writers which crashed are never renamed, they are removed once their process is gone.
+    // Files being written by live processes are counted, but only complete entries are evicted
+    for (const auto& tmpFile : listFiles(m_cachePath, kTmpExtension)) {
+        uint64_t pid = 0;
+        if (getWriterProcessId(tmpFile.name, pid) && !isProcessAlive(pid) &&
+            std::remove(FileUtils::makePath(m_cachePath, tmpFile.name).c_str()) == 0)
+            continue;
+        totalSize += tmpFile.size;
+    }
+
+    auto entries = listFiles(m_cachePath, kBlobExtension);
+    for (const auto& entry : entries)
+        totalSize += entry.size;
+    if (totalSize <= m_maxSize)
+        return;
+
+    std::sort(entries.begin(), entries.end(), [](const FileEntry& a, const FileEntry& b) {
+        return a.lastWriteTime < b.lastWriteTime;
+    });
+
+    const auto extensionSize = sizeof(kBlobExtension) - 1;
+    for (const auto& entry : entries) {
+        if (totalSize <= m_maxSize)
+            break;
+        const auto id = entry.name.substr(0, entry.name.size() - extensionSize);
+        if (id == keepId)
+            continue;
+        // Readers of the entry keep their open file
+        if (std::remove(getBlobFile(id).c_str()) == 0)
+            totalSize -= entry.size;
+    }
+}
+
+}  // namespace InferenceEngine
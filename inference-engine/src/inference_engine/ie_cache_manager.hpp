@@ -9,12 +9,16 @@
  */
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <fstream>
 #include <string>
 #include <functional>
+#include <mutex>
+#include <unordered_map>
 #include "ie_api.h"
 #include "file_utils.h"
+#include "cache_file_utils.hpp"
 
 namespace InferenceEngine {
 
@@ -74,22 +78,49 @@ public:
 /**
  * @brief File storage-based Implementation of ICacheManager
  *
- * Uses simple file for read/write cached models.
+ * Every entry is stored in a separate `<id>.blob` file, so one cache directory can be shared by several processes:
+ *  - an entry is written to a temporary file which is renamed to the blob file when complete,
+ *    readers never see a partially written blob and don't take any locks;
+ *  - `cache.lock` file serializes renames and removals of blobs, so an entry which turned out to be damaged
+ *    is removed only if it wasn't replaced by another process in the meantime;
+ *  - the blob starts with a header holding payload size and checksum. Both are verified before the entry
+ *    is passed to a plugin, a truncated or damaged entry is removed and the reader is not called;
+ *  - if the maximum cache size is set, least recently used entries are evicted after each write.
+ *    Last use time is the modification time of the blob file which is updated on every read.
+ *    Temporary files count towards the size, the ones left by crashed writers are removed.
  *
+ * The cache is an optimization only: if the directory can't be written or locked, entries are not stored
+ * or removed, networks are compiled as if there were no cache.
  */
 class FileStorageCacheManager final : public ICacheManager {
     std::string m_cachePath;
+    uint64_t m_maxSize;
+    // Blob files passed to readers, so that removeCacheEntry() called after a failed import
+    // removes the same file and not a new entry written by another process
+    std::mutex m_readEntriesMutex;
+    std::unordered_map<std::string, FileIdentity> m_readEntries;
 
     std::string getBlobFile(const std::string& blobHash) const {
         return FileUtils::makePath(m_cachePath, blobHash + ".blob");
     }
 
+    std::string getLockFile() const {
+        return FileUtils::makePath(m_cachePath, std::string("cache.lock"));
+    }
+
+    void removeEntry(const std::string& id, const FileIdentity* expected);
+
+    void evictEntries(const std::string& keepId);
+
 public:
     /**
      * @brief Constructor
      *
+     * @param cachePath Path to the cache directory
+     * @param maxSize Maximum total size of blobs and temporary files in bytes, 0 means the cache is not limited
      */
-    FileStorageCacheManager(std::string&& cachePath) : m_cachePath(std::move(cachePath)) {}
+    FileStorageCacheManager(std::string&& cachePath, uint64_t maxSize = 0) :
+        m_cachePath(std::move(cachePath)), m_maxSize(maxSize) {}
 
     /**
      * @brief Destructor
@@ -98,24 +129,11 @@ public:
     ~FileStorageCacheManager() override = default;
 
 private:
-    void writeCacheEntry(const std::string& id, StreamWriter writer) override {
-        std::ofstream stream(getBlobFile(id), std::ios_base::binary | std::ofstream::out);
-        writer(stream);
-    }
+    void writeCacheEntry(const std::string& id, StreamWriter writer) override;
 
-    void readCacheEntry(const std::string& id, StreamReader reader) override {
-        auto blobFileName = getBlobFile(id);
-        if (FileUtils::fileExist(blobFileName)) {
-            std::ifstream stream(blobFileName, std::ios_base::binary);
-            reader(stream);
-        }
-    }
+    void readCacheEntry(const std::string& id, StreamReader reader) override;
 
-    void removeCacheEntry(const std::string& id) override {
-        auto blobFileName = getBlobFile(id);
-        if (FileUtils::fileExist(blobFileName))
-            std::remove(blobFileName.c_str());
-    }
+    void removeCacheEntry(const std::string& id) override;
 };
 
 }  // namespace InferenceEngine
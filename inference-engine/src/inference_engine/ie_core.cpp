@@ -7,6 +7,7 @@
 #include <string>
 #include <vector>
 #include <mutex>
+#include <atomic>
 #include <sys/stat.h>
 
 #include <ie_core.hpp>
@@ -15,6 +16,7 @@
 #include <ngraph/ngraph.hpp>
 #include <ngraph/graph_util.hpp>
 #include <ngraph/pass/constant_folding.hpp>
+#include <ngraph/runtime/parallel.hpp>
 
 #include "compilation_context.hpp"
 #include "cpp/ie_plugin.hpp"
@@ -22,6 +24,7 @@
 #include "ie_cache_manager.hpp"
 #include "ie_cache_guard.hpp"
 #include "ie_itt.hpp"
+#include "ie_parallel.hpp"
 #include "file_utils.h"
 #include "ie_network_reader.hpp"
 #include "xml_parse_utils.h"
@@ -103,6 +106,52 @@ Parameter copyParameterValue(const Parameter & value) {
     return std::move(value);
 }
 
+// Threading backend of the nGraph reference kernels used by constant folding and plugin fallbacks
+void parallelForReference(size_t workAmount, const ngraph::runtime::parallel_body_t& body) {
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(workAmount, nthr, ithr, start, end);
+        body(start, end);
+    });
+}
+
+// Installs parallelForReference while at least one Core exists. The backend which was installed before the first
+// Core is created is restored when the last one is destroyed
+class ParallelForReferenceGuard final {
+public:
+    ParallelForReferenceGuard() {
+        auto& state = getState();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        if (0 == state.users++) {
+            state.previous = ngraph::runtime::get_parallel_for();
+            ngraph::runtime::set_parallel_for(parallelForReference);
+        }
+    }
+
+    ~ParallelForReferenceGuard() {
+        auto& state = getState();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        if (0 == --state.users) {
+            ngraph::runtime::set_parallel_for(state.previous);
+        }
+    }
+
+    ParallelForReferenceGuard(const ParallelForReferenceGuard&) = delete;
+    ParallelForReferenceGuard& operator=(const ParallelForReferenceGuard&) = delete;
+
+private:
+    struct State {
+        std::mutex                       mutex;
+        size_t                           users = 0;
+        ngraph::runtime::parallel_for_t  previous = nullptr;
+    };
+
+    static State& getState() {
+        static State state;
+        return state;
+    }
+};
+
 template <typename F>
 void allowNotImplemented(F && f) {
     try {
@@ -171,6 +220,8 @@ std::vector<std::string> DeviceIDParser::getMultiDevices(std::string devicesList
 
 class Core::Impl : public ICore, public std::enable_shared_from_this<ICore> {
     // Fields are ordered by deletion order
+    ParallelForReferenceGuard _parallelForGuard;
+
     ITaskExecutor::Ptr _taskExecutor = nullptr;
 
     mutable std::map<std::string, InferencePlugin> plugins;
@@ -179,25 +230,63 @@ class Core::Impl : public ICore, public std::enable_shared_from_this<ICore> {
     public:
         struct CacheConfig {
             std::string                    _cacheDir;
+            uint64_t                       _cacheMaxSize = 0;
             std::shared_ptr<ICacheManager> _cacheManager;
         };
 
         void setAndUpdate(std::map<std::string, std::string>& config) {
-            auto it = config.find(CONFIG_KEY(CACHE_DIR));
-            if (it != config.end()) {
+            auto dirIt = config.find(CONFIG_KEY(CACHE_DIR));
+            auto sizeIt = config.find(CONFIG_KEY(CACHE_MAX_SIZE));
+            if (dirIt != config.end() || sizeIt != config.end()) {
                 std::lock_guard<std::mutex> lock(_cacheConfigMutex);
-                _cacheConfig._cacheDir = it->second;
-                if (!it->second.empty()) {
-                    FileUtils::createDirectoryRecursive(it->second);
-                    _cacheConfig._cacheManager = std::make_shared<FileStorageCacheManager>(std::move(it->second));
+                if (sizeIt != config.end()) {
+                    size_t pos = 0;
+                    uint64_t maxSize = 0;
+                    try {
+                        maxSize = std::stoull(sizeIt->second, &pos);
+                    } catch (const std::exception&) {
+                        pos = 0;
+                    }
+                    if (pos == 0 || pos != sizeIt->second.size() || sizeIt->second.find('-') != std::string::npos) {
+                        IE_THROW() << "Wrong value " << sizeIt->second << " for property key "
+                                   << CONFIG_KEY(CACHE_MAX_SIZE) << ". Expected non-negative number of bytes";
+                    }
+                    _cacheConfig._cacheMaxSize = maxSize;
+                    config.erase(sizeIt);
+                }
+                if (dirIt != config.end()) {
+                    _cacheConfig._cacheDir = dirIt->second;
+                    config.erase(dirIt);
+                }
+
+                if (!_cacheConfig._cacheDir.empty()) {
+                    FileUtils::createDirectoryRecursive(_cacheConfig._cacheDir);
+                    _cacheConfig._cacheManager = std::make_shared<FileStorageCacheManager>(
+                        std::string(_cacheConfig._cacheDir), _cacheConfig._cacheMaxSize);
                 } else {
                     _cacheConfig._cacheManager = nullptr;
                 }
+            }
+
+            auto it = config.find(CONFIG_KEY(ENABLE_MMAP));
+            if (it != config.end()) {
+                if (it->second == CONFIG_VALUE(YES)) {
+                    _enableMmap = true;
+                } else if (it->second == CONFIG_VALUE(NO)) {
+                    _enableMmap = false;
+                } else {
+                    IE_THROW() << "Wrong value " << it->second << " for property key " << CONFIG_KEY(ENABLE_MMAP)
+                               << ". Expected only YES/NO";
+                }
 
                 config.erase(it);
             }
         }
 
+        bool isMmapEnabled() const {
+            return _enableMmap;
+        }
+
         // Creating thread-safe copy of config including shared_ptr to ICacheManager
         CacheConfig getCacheConfig() const {
             std::lock_guard<std::mutex> lock(_cacheConfigMutex);
@@ -207,6 +296,7 @@ class Core::Impl : public ICore, public std::enable_shared_from_this<ICore> {
     private:
         mutable std::mutex _cacheConfigMutex;
         CacheConfig _cacheConfig;
+        std::atomic_bool _enableMmap = {false};
     };
 
     // Core settings (cache config, etc)
@@ -275,18 +365,17 @@ class Core::Impl : public ICore, public std::enable_shared_from_this<ICore> {
                                 plugin.LoadNetwork(network, parsedConfig);
         auto cacheManager = coreConfig.getCacheConfig()._cacheManager;
         if (!forceDisableCache && cacheManager && DeviceSupportsImportExport(plugin)) {
-            try {
-                // need to export network for further import from "cache"
-                OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::IE_LT, "Core::LoadNetwork::Export");
+            // need to export network for further import from "cache"
+            // a failed export leaves no entry: the cache manager publishes only completely written entries
+            // the network which can't be exported by the plugin is just not cached
+            OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::IE_LT, "Core::LoadNetwork::Export");
+            allowNotImplemented([&]() {
                 cacheManager->writeCacheEntry(blobID, [&](std::ostream& networkStream) {
                     networkStream << CompiledBlobHeader(GetInferenceEngineVersion()->buildNumber,
                                                         NetworkCompilationContext::calculateFileInfo(modelPath));
                     execNetwork->Export(networkStream);
                 });
-            } catch (...) {
-                cacheManager->removeCacheEntry(blobID);
-                throw;
-            }
+            });
         }
         return execNetwork;
     }
@@ -330,6 +419,8 @@ class Core::Impl : public ICore, public std::enable_shared_from_this<ICore> {
             cacheManager->removeCacheEntry(blobId);
             networkIsImported = false;
         } catch (...) {
+            // The network may be imported from a damaged entry, it is compiled again
+            execNetwork = {};
             cacheManager->removeCacheEntry(blobId);
             networkIsImported = false;
             // TODO: temporary disabled by #54335. In future don't throw only for new 'blob_outdated' exception
@@ -477,7 +568,7 @@ public:
 
     CNNNetwork ReadNetwork(const std::string& modelPath, const std::string& binPath) const override {
         OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::IE_RT, "Core::Impl::ReadNetwork from file");
-        return details::ReadNetwork(modelPath, binPath, extensions);
+        return details::ReadNetwork(modelPath, binPath, extensions, coreConfig.isMmapEnabled());
     }
 
     CNNNetwork ReadNetwork(const std::string& model, const Blob::CPtr& weights) const override {
@@ -4,6 +4,7 @@
 
 #include "ie_network_reader.hpp"
 #include "ie_itt.hpp"
+#include "mmap_allocator.hpp"
 
 #include <details/ie_so_pointer.hpp>
 #include <file_utils.h>
@@ -151,7 +152,8 @@ void assertIfIRv7LikeModel(std::istream & modelStream) {
 
 }  // namespace
 
-CNNNetwork details::ReadNetwork(const std::string& modelPath, const std::string& binPath, const std::vector<IExtensionPtr>& exts) {
+CNNNetwork details::ReadNetwork(const std::string& modelPath, const std::string& binPath, const std::vector<IExtensionPtr>& exts,
+                                bool enableMmap) {
     // Register readers if it is needed
     registerReaders();
 
@@ -193,7 +195,25 @@ CNNNetwork details::ReadNetwork(const std::string& modelPath, const std::string&
                     }
                 }
             }
-            if (!bPath.empty()) {
+            // An empty weights file can't be mapped, it is read as usual. A missing one is reported there too.
+            const auto mappedSize = !bPath.empty() && enableMmap ? FileUtils::fileSize(bPath) : 0;
+            if (mappedSize > 0) {
+                Blob::Ptr weights;
+                {
+                    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::IE_RT, "ReadNetworkWeights");
+                    const auto fileSize = static_cast<size_t>(mappedSize);
+                    // Constants are created over the mapped blob, so pages are loaded only when they are accessed
+                    weights = make_shared_blob<uint8_t>({Precision::U8, { fileSize }, C },
+                                                        CreateMmapAllocator(bPath));
+                    weights->allocate();
+                    if (!weights->buffer())
+                        IE_THROW() << "Weights file " << bPath << " cannot be mapped to memory!";
+                }
+
+                auto network = reader->read(modelStream, weights, exts);
+                modelStream.close();
+                return network;
+            } else if (!bPath.empty()) {
                 // Open weights file
 #if defined(ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
                 std::wstring weights_path = FileUtils::multiByteCharToWString(bPath.c_str());
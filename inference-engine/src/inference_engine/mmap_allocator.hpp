@@ -0,0 +1,25 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "ie_allocator.hpp"
+
+#include <memory>
+#include <string>
+
+namespace InferenceEngine {
+
+/**
+ * @brief Creates an allocator which maps the file into memory instead of allocating a new buffer.
+ *
+ * The file is opened read-only and mapped privately, so pages are loaded lazily and stay shared with
+ * the page cache (and with other processes mapping the same file) until somebody writes to them.
+ * The size passed to alloc() must not exceed the file size.
+ * @param path Path to the file to map
+ * @return An allocator object
+ */
+std::shared_ptr<IAllocator> CreateMmapAllocator(const std::string& path);
+
+}  // namespace InferenceEngine
@@ -0,0 +1,134 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/file.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdio>
+#include <limits>
+
+#include "cache_file_utils.hpp"
+#include "file_utils.h"
+#include "ie_common.h"
+
+namespace InferenceEngine {
+
+FileLock::FileLock(const std::string& path, bool exclusive) {
+    int fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0666);
+    if (fd == -1)
+        IE_THROW() << "Cannot open lock file " << path;
+    _handle = fd;
+
+    // flock() locks belong to the open file description, so separate handles of one process don't share the lock
+    int res;
+    do {
+        res = ::flock(fd, exclusive ? LOCK_EX : LOCK_SH);
+    } while (res == -1 && errno == EINTR);
+    if (res != 0) {
+        ::close(fd);
+        IE_THROW() << "Cannot lock file " << path;
+    }
+}
+
+FileLock::~FileLock() {
+    ::flock(static_cast<int>(_handle), LOCK_UN);
+    ::close(static_cast<int>(_handle));
+}
+
+ReadOnlyFile::ReadOnlyFile(const std::string& path) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd == -1)
+        return;
+    _handle = fd;
+    struct stat st;
+    if (::fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+        ::close(fd);
+        return;
+    }
+    _open = true;
+    _size = static_cast<uint64_t>(st.st_size);
+    _identity.device = static_cast<uint64_t>(st.st_dev);
+    _identity.index = static_cast<uint64_t>(st.st_ino);
+}
+
+ReadOnlyFile::~ReadOnlyFile() {
+    if (_open)
+        ::close(static_cast<int>(_handle));
+}
+
+size_t ReadOnlyFile::read(uint64_t offset, char* data, size_t size) const {
+    size_t done = 0;
+    while (done < size) {
+        auto res = ::pread(static_cast<int>(_handle), data + done, size - done, static_cast<off_t>(offset + done));
+        if (res == -1 && errno == EINTR)
+            continue;
+        if (res <= 0)
+            break;
+        done += static_cast<size_t>(res);
+    }
+    return done;
+}
+
+bool getFileIdentity(const std::string& path, FileIdentity& identity) {
+    struct stat st;
+    if (::stat(path.c_str(), &st) != 0)
+        return false;
+    identity.device = static_cast<uint64_t>(st.st_dev);
+    identity.index = static_cast<uint64_t>(st.st_ino);
+    return true;
+}
+
+std::vector<FileEntry> listFiles(const std::string& dirPath, const std::string& suffix) {
+    std::vector<FileEntry> files;
+    DIR* dir = ::opendir(dirPath.c_str());
+    if (dir == nullptr)
+        return files;
+    while (struct dirent* entry = ::readdir(dir)) {
+        std::string name = entry->d_name;
+        if (name.size() < suffix.size() || name.compare(name.size() - suffix.size(), suffix.size(), suffix) != 0)
+            continue;
+        auto path = FileUtils::makePath(dirPath, name);
+        struct stat st;
+        if (::stat(path.c_str(), &st) != 0 || !S_ISREG(st.st_mode))
+            continue;
+#ifdef __APPLE__
+        const auto& mtime = st.st_mtimespec;
+#else
+        const auto& mtime = st.st_mtim;
+#endif
+        const int64_t lastWriteTime = static_cast<int64_t>(mtime.tv_sec) * 1000000000 + mtime.tv_nsec;
+        files.push_back({name, static_cast<uint64_t>(st.st_size), lastWriteTime});
+    }
+    ::closedir(dir);
+    return files;
+}
+
+void touchFile(const std::string& path) {
+    ::utimes(path.c_str(), nullptr);
+}
+
+bool replaceFile(const std::string& from, const std::string& to) {
+    // rename() replaces the destination atomically, readers see either the old or the new file
+    return std::rename(from.c_str(), to.c_str()) == 0;
+}
+
+uint64_t getProcessId() {
+    return static_cast<uint64_t>(::getpid());
+}
+
+bool isProcessAlive(uint64_t pid) {
+    // kill() treats zero and negative values as process groups
+    if (pid == 0 || pid > static_cast<uint64_t>(std::numeric_limits<pid_t>::max()))
+        return false;
+    // EPERM means the process exists but belongs to another user
+    return ::kill(static_cast<pid_t>(pid), 0) == 0 || errno == EPERM;
+}
+
+}  // namespace InferenceEngine
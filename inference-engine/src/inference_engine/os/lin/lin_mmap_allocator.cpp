@@ -0,0 +1,72 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <mutex>
+#include <unordered_map>
+
+#include "mmap_allocator.hpp"
+#include "ie_common.h"
+
+namespace InferenceEngine {
+
+class MmapAllocator : public IAllocator {
+public:
+    explicit MmapAllocator(const std::string& path) {
+        _fd = ::open(path.c_str(), O_RDONLY);
+        if (_fd == -1)
+            IE_THROW() << "Cannot open file " << path << " for memory mapping";
+    }
+
+    ~MmapAllocator() {
+        ::close(_fd);
+    }
+
+    void* lock(void* handle, LockOp = LOCK_FOR_WRITE) noexcept override {
+        return handle;
+    }
+
+    void unlock(void*) noexcept override {}
+
+    void* alloc(size_t size) noexcept override {
+        struct stat st;
+        if (size == 0 || ::fstat(_fd, &st) != 0 || static_cast<size_t>(st.st_size) < size)
+            return nullptr;
+        // Private mapping keeps pages shared with the page cache, a write copies only the touched page
+        void* data = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, _fd, 0);
+        if (data == MAP_FAILED)
+            return nullptr;
+        std::lock_guard<std::mutex> lock(_mutex);
+        _sizes[data] = size;
+        return data;
+    }
+
+    bool free(void* handle) noexcept override {
+        size_t size = 0;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            auto it = _sizes.find(handle);
+            if (it == _sizes.end())
+                return false;
+            size = it->second;
+            _sizes.erase(it);
+        }
+        return ::munmap(handle, size) == 0;
+    }
+
+private:
+    int _fd = -1;
+    std::mutex _mutex;
+    std::unordered_map<void*, size_t> _sizes;
+};
+
+std::shared_ptr<IAllocator> CreateMmapAllocator(const std::string& path) {
+    return std::make_shared<MmapAllocator>(path);
+}
+
+}  // namespace InferenceEngine
@@ -0,0 +1,154 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cache_file_utils.hpp"
+#include "ie_common.h"
+#include "file_utils.h"
+
+#ifndef NOMINMAX
+# define NOMINMAX
+#endif
+
+#include <windows.h>
+
+namespace InferenceEngine {
+
+namespace {
+
+// Files are opened with all sharing modes, so a blob being read can still be replaced or removed
+HANDLE openShared(const std::string& path, DWORD access, DWORD disposition) {
+    return ::CreateFileA(path.c_str(), access, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                         nullptr, disposition, FILE_ATTRIBUTE_NORMAL, nullptr);
+}
+
+FileIdentity toIdentity(const BY_HANDLE_FILE_INFORMATION& info) {
+    FileIdentity identity;
+    identity.device = info.dwVolumeSerialNumber;
+    identity.index = (static_cast<uint64_t>(info.nFileIndexHigh) << 32) | info.nFileIndexLow;
+    return identity;
+}
+
+}  // namespace
+
+FileLock::FileLock(const std::string& path, bool exclusive) {
+    HANDLE file = openShared(path, GENERIC_READ | GENERIC_WRITE, OPEN_ALWAYS);
+    if (file == INVALID_HANDLE_VALUE)
+        IE_THROW() << "Cannot open lock file " << path;
+    _handle = reinterpret_cast<intptr_t>(file);
+
+    OVERLAPPED overlapped = {};
+    if (!::LockFileEx(file, exclusive ? LOCKFILE_EXCLUSIVE_LOCK : 0, 0, MAXDWORD, MAXDWORD, &overlapped)) {
+        ::CloseHandle(file);
+        IE_THROW() << "Cannot lock file " << path;
+    }
+}
+
+FileLock::~FileLock() {
+    HANDLE file = reinterpret_cast<HANDLE>(_handle);
+    OVERLAPPED overlapped = {};
+    ::UnlockFileEx(file, 0, MAXDWORD, MAXDWORD, &overlapped);
+    ::CloseHandle(file);
+}
+
+ReadOnlyFile::ReadOnlyFile(const std::string& path) {
+    HANDLE file = openShared(path, GENERIC_READ, OPEN_EXISTING);
+    if (file == INVALID_HANDLE_VALUE)
+        return;
+    _handle = reinterpret_cast<intptr_t>(file);
+    BY_HANDLE_FILE_INFORMATION info;
+    if (!::GetFileInformationByHandle(file, &info) || (info.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)) {
+        ::CloseHandle(file);
+        return;
+    }
+    _open = true;
+    _size = (static_cast<uint64_t>(info.nFileSizeHigh) << 32) | info.nFileSizeLow;
+    _identity = toIdentity(info);
+}
+
+ReadOnlyFile::~ReadOnlyFile() {
+    if (_open)
+        ::CloseHandle(reinterpret_cast<HANDLE>(_handle));
+}
+
+size_t ReadOnlyFile::read(uint64_t offset, char* data, size_t size) const {
+    size_t done = 0;
+    while (done < size) {
+        OVERLAPPED overlapped = {};
+        const uint64_t position = offset + done;
+        overlapped.Offset = static_cast<DWORD>(position);
+        overlapped.OffsetHigh = static_cast<DWORD>(position >> 32);
+        const auto count = static_cast<DWORD>((std::min<size_t>)(size - done, MAXDWORD));
+        DWORD res = 0;
+        if (!::ReadFile(reinterpret_cast<HANDLE>(_handle), data + done, count, &res, &overlapped) || res == 0)
+            break;
+        done += res;
+    }
+    return done;
+}
+
+bool getFileIdentity(const std::string& path, FileIdentity& identity) {
+    HANDLE file = openShared(path, 0, OPEN_EXISTING);
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+    BY_HANDLE_FILE_INFORMATION info;
+    const bool res = ::GetFileInformationByHandle(file, &info) != FALSE;
+    ::CloseHandle(file);
+    if (res)
+        identity = toIdentity(info);
+    return res;
+}
+
+std::vector<FileEntry> listFiles(const std::string& dirPath, const std::string& suffix) {
+    std::vector<FileEntry> files;
+    WIN32_FIND_DATAA data;
+    HANDLE find = ::FindFirstFileA(FileUtils::makePath(dirPath, std::string("*") + suffix).c_str(), &data);
+    if (find == INVALID_HANDLE_VALUE)
+        return files;
+    do {
+        if (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+            continue;
+        ULARGE_INTEGER size, time;
+        size.LowPart = data.nFileSizeLow;
+        size.HighPart = data.nFileSizeHigh;
+        time.LowPart = data.ftLastWriteTime.dwLowDateTime;
+        time.HighPart = data.ftLastWriteTime.dwHighDateTime;
+        files.push_back({std::string(data.cFileName), static_cast<uint64_t>(size.QuadPart),
+                         static_cast<int64_t>(time.QuadPart)});
+    } while (::FindNextFileA(find, &data));
+    ::FindClose(find);
+    return files;
+}
+
+void touchFile(const std::string& path) {
+    HANDLE file = openShared(path, FILE_WRITE_ATTRIBUTES, OPEN_EXISTING);
+    if (file == INVALID_HANDLE_VALUE)
+        return;
+    FILETIME now;
+    ::GetSystemTimeAsFileTime(&now);
+    ::SetFileTime(file, nullptr, nullptr, &now);
+    ::CloseHandle(file);
+}
+
+bool replaceFile(const std::string& from, const std::string& to) {
+    return ::MoveFileExA(from.c_str(), to.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != FALSE;
+}
+
+uint64_t getProcessId() {
+    return ::GetCurrentProcessId();
+}
+
+bool isProcessAlive(uint64_t pid) {
+    if (pid > MAXDWORD)
+        return false;
+    HANDLE process = ::OpenProcess(PROCESS_QUERY_LIMITED_INFORMATION, FALSE, static_cast<DWORD>(pid));
+    if (process == nullptr)
+        // The process exists but can't be queried by this user
+        return ::GetLastError() == ERROR_ACCESS_DENIED;
+    DWORD exitCode = 0;
+    const bool alive = ::GetExitCodeProcess(process, &exitCode) && exitCode == STILL_ACTIVE;
+    ::CloseHandle(process);
+    return alive;
+}
+
+}  // namespace InferenceEngine
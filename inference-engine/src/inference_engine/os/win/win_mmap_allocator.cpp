@@ -0,0 +1,68 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mmap_allocator.hpp"
+#include "ie_common.h"
+#include "file_utils.h"
+
+#ifndef NOMINMAX
+# define NOMINMAX
+#endif
+
+#include <windows.h>
+
+namespace InferenceEngine {
+
+class MmapAllocator : public IAllocator {
+public:
+    explicit MmapAllocator(const std::string& path) {
+#ifdef ENABLE_UNICODE_PATH_SUPPORT
+        _file = ::CreateFileW(FileUtils::multiByteCharToWString(path.c_str()).c_str(), GENERIC_READ, FILE_SHARE_READ,
+                              nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+#else
+        _file = ::CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                              nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+#endif
+        if (_file == INVALID_HANDLE_VALUE)
+            IE_THROW() << "Cannot open file " << path << " for memory mapping";
+        // Copy-on-write mapping: pages are shared with the file cache until somebody writes to them
+        _mapping = ::CreateFileMapping(_file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+        if (_mapping == nullptr) {
+            ::CloseHandle(_file);
+            IE_THROW() << "Cannot create file mapping for " << path;
+        }
+    }
+
+    ~MmapAllocator() {
+        ::CloseHandle(_mapping);
+        ::CloseHandle(_file);
+    }
+
+    void* lock(void* handle, LockOp = LOCK_FOR_WRITE) noexcept override {
+        return handle;
+    }
+
+    void unlock(void*) noexcept override {}
+
+    void* alloc(size_t size) noexcept override {
+        LARGE_INTEGER fileSize;
+        if (size == 0 || !::GetFileSizeEx(_file, &fileSize) || static_cast<size_t>(fileSize.QuadPart) < size)
+            return nullptr;
+        return ::MapViewOfFile(_mapping, FILE_MAP_COPY, 0, 0, size);
+    }
+
+    bool free(void* handle) noexcept override {
+        return ::UnmapViewOfFile(handle) != 0;
+    }
+
+private:
+    HANDLE _file = INVALID_HANDLE_VALUE;
+    HANDLE _mapping = nullptr;
+};
+
+std::shared_ptr<IAllocator> CreateMmapAllocator(const std::string& path) {
+    return std::make_shared<MmapAllocator>(path);
+}
+
+}  // namespace InferenceEngine
@@ -13,6 +13,7 @@
 #include <climits>
 #include <cassert>
 #include <utility>
+#include <cstdint>
 
 #include "threading/ie_thread_local.hpp"
 #include "ie_parallel_custom_arena.hpp"
@@ -25,6 +26,83 @@ using namespace openvino;
 
 namespace InferenceEngine {
 struct CPUStreamsExecutor::Impl {
+    /**
+     * @brief Bounded multi-producer multi-consumer lock-free queue.
+     * Each cell has a sequence number which tells whether the cell is ready for the producer or the consumer
+     * at the current position, so the task is moved in or out by the thread which reserved the position only.
+     */
+    struct TaskQueue {
+        static constexpr std::size_t cacheLineSize = 64;
+
+        struct Cell {
+            std::atomic<std::size_t>    _sequence;
+            Task                        _task;
+        };
+
+        explicit TaskQueue(std::size_t capacity) :
+            _mask{capacity - 1},
+            _cells{new Cell[capacity]} {
+            assert((capacity & _mask) == 0);
+            for (std::size_t i = 0; i < capacity; ++i) {
+                _cells[i]._sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        bool TryPush(Task& task) {
+            Cell* cell = nullptr;
+            auto position = _enqueuePosition.load(std::memory_order_relaxed);
+            for (;;) {
+                cell = &_cells[position & _mask];
+                auto sequence = cell->_sequence.load(std::memory_order_acquire);
+                auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position);
+                if (diff == 0) {
+                    if (_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                        break;
+                    }
+                } else if (diff < 0) {
+                    return false;  // the queue is full
+                } else {
+                    position = _enqueuePosition.load(std::memory_order_relaxed);
+                }
+            }
+            cell->_task = std::move(task);
+            cell->_sequence.store(position + 1, std::memory_order_release);
+            return true;
+        }
+
+        bool TryPop(Task& task) {
+            Cell* cell = nullptr;
+            auto position = _dequeuePosition.load(std::memory_order_relaxed);
+            for (;;) {
+                cell = &_cells[position & _mask];
+                auto sequence = cell->_sequence.load(std::memory_order_acquire);
+                auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position + 1);
+                if (diff == 0) {
+                    if (_dequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                        break;
+                    }
+                } else if (diff < 0) {
+                    return false;  // the queue is empty
+                } else {
+                    position = _dequeuePosition.load(std::memory_order_relaxed);
+                }
+            }
+            task = std::move(cell->_task);
+            cell->_task = nullptr;
+            cell->_sequence.store(position + _mask + 1, std::memory_order_release);
+            return true;
+        }
+
+        const std::size_t           _mask;
+        std::unique_ptr<Cell[]>     _cells;
+        // producers and consumers modify different cache lines
+        char                        _padding0[cacheLineSize];
+        std::atomic<std::size_t>    _enqueuePosition{0};
+        char                        _padding1[cacheLineSize];
+        std::atomic<std::size_t>    _dequeuePosition{0};
+        char                        _padding2[cacheLineSize];
+    };
+
     struct Stream {
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
         struct Observer: public custom::task_scheduler_observer {
@@ -194,33 +272,79 @@ struct CPUStreamsExecutor::Impl {
             }
         }
         #endif
+        for (auto streamId = 0; streamId < _config._streams; ++streamId) {
+            _taskQueues.emplace_back(new TaskQueue{taskQueueCapacity});
+        }
         for (auto streamId = 0; streamId < _config._streams; ++streamId) {
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config._name + "_" + std::to_string(streamId));
-                for (bool stopped = false; !stopped;) {
+                for (;;) {
                     Task task;
-                    {
-                        std::unique_lock<std::mutex> lock(_mutex);
-                        _queueCondVar.wait(lock, [&] { return !_taskQueue.empty() || (stopped = _isStopped); });
-                        if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
-                        }
+                    for (int i = 0; !TryPop(streamId, task) && i < _config._threadSpinWaitIterations; ++i) {
+                        std::this_thread::yield();
                     }
                     if (task) {
                         Execute(task, *(_streams.local()));
+                        continue;
+                    }
+                    std::unique_lock<std::mutex> lock(_mutex);
+                    ++_sleepingThreads;
+                    _queueCondVar.wait(lock, [&] { return _pendingTasks > 0 || _isStopped; });
+                    --_sleepingThreads;
+                    // all enqueued tasks are executed before the executor is destroyed
+                    if (_isStopped && _pendingTasks <= 0) {
+                        break;
                     }
                 }
             });
         }
     }
 
+    bool TryPop(int streamId, Task& task) {
+        // the own queue of the stream is checked first, then tasks are stolen from other streams
+        for (int i = 0; i < _config._streams; ++i) {
+            if (_taskQueues[(streamId + i) % _config._streams]->TryPop(task)) {
+                --_pendingTasks;
+                return true;
+            }
+        }
+        if (0 == _overflowTasks) {
+            return false;
+        }
+        std::lock_guard<std::mutex> lock(_overflowMutex);
+        if (!_overflowQueue.empty()) {
+            task = std::move(_overflowQueue.front());
+            _overflowQueue.pop();
+            --_overflowTasks;
+            --_pendingTasks;
+            return true;
+        }
+        return false;
+    }
+
     void Enqueue(Task task) {
-        {
-            std::lock_guard<std::mutex> lock(_mutex);
-            _taskQueue.emplace(std::move(task));
+        // external threads distribute tasks between streams in the round-robin fashion
+        // Tasks are passed to the overflow queue while it is not empty, so they are never overtaken by newer tasks
+        // and a single stream executor stays FIFO
+        bool pushed = false;
+        if (0 == _overflowTasks) {
+            const auto first = _nextQueue++;
+            for (int i = 0; !pushed && i < _config._streams; ++i) {
+                pushed = _taskQueues[(first + i) % _config._streams]->TryPush(task);
+            }
+        }
+        if (!pushed) {
+            std::lock_guard<std::mutex> lock(_overflowMutex);
+            _overflowQueue.emplace(std::move(task));
+            ++_overflowTasks;
+        }
+        ++_pendingTasks;
+        // Sleeping threads are woken only if there are any. The thread which is about to sleep holds the mutex
+        // and checks _pendingTasks after it is counted as sleeping, so the notification can not be lost.
+        if (_sleepingThreads > 0) {
+            { std::lock_guard<std::mutex> lock(_mutex); }
+            _queueCondVar.notify_one();
         }
-        _queueCondVar.notify_one();
     }
 
     void Execute(const Task& task, Stream& stream) {
@@ -256,9 +380,16 @@ struct CPUStreamsExecutor::Impl {
     int                                     _streamId = 0;
     std::queue<int>                         _streamIdQueue;
     std::vector<std::thread>                _threads;
+    static constexpr std::size_t            taskQueueCapacity = 1024;
+    std::vector<std::unique_ptr<TaskQueue>> _taskQueues;
+    std::atomic<unsigned>                   _nextQueue{0};
+    std::mutex                              _overflowMutex;
+    std::queue<Task>                        _overflowQueue;
+    std::atomic<int>                        _overflowTasks{0};
+    std::atomic<int>                        _pendingTasks{0};
+    std::atomic<int>                        _sleepingThreads{0};
     std::mutex                              _mutex;
     std::condition_variable                 _queueCondVar;
-    std::queue<Task>                        _taskQueue;
     bool                                    _isStopped = false;
     std::vector<int>                        _usedNumaNodes;
     ThreadLocal<std::shared_ptr<Stream>>    _streams;
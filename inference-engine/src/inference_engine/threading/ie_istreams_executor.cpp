@@ -24,6 +24,7 @@ std::vector<std::string> IStreamsExecutor::Config::SupportedKeys() {
         CONFIG_KEY(CPU_BIND_THREAD),
         CONFIG_KEY(CPU_THREADS_NUM),
         CONFIG_KEY_INTERNAL(CPU_THREADS_PER_STREAM),
+        CONFIG_KEY_INTERNAL(CPU_SPIN_WAIT_ITERATIONS),
     };
 }
 
@@ -101,6 +102,19 @@ void IStreamsExecutor::Config::SetConfig(const std::string& key, const std::stri
                                    << ". Expected only non negative numbers (#threads)";
             }
             _threadsPerStream = val_i;
+        } else if (key == CONFIG_KEY_INTERNAL(CPU_SPIN_WAIT_ITERATIONS)) {
+            int val_i;
+            try {
+                val_i = std::stoi(value);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << CONFIG_KEY_INTERNAL(CPU_SPIN_WAIT_ITERATIONS)
+                                   << ". Expected only non negative numbers (#iterations)";
+            }
+            if (val_i < 0) {
+                IE_THROW() << "Wrong value for property key " << CONFIG_KEY_INTERNAL(CPU_SPIN_WAIT_ITERATIONS)
+                                   << ". Expected only non negative numbers (#iterations)";
+            }
+            _threadSpinWaitIterations = val_i;
         } else {
             IE_THROW() << "Wrong value for property key " << key;
         }
@@ -128,6 +142,8 @@ Parameter IStreamsExecutor::Config::GetConfig(const std::string& key) {
         return {_threads};
     } else if (key == CONFIG_KEY_INTERNAL(CPU_THREADS_PER_STREAM)) {
         return {_threadsPerStream};
+    } else if (key == CONFIG_KEY_INTERNAL(CPU_SPIN_WAIT_ITERATIONS)) {
+        return {_threadSpinWaitIterations};
     } else {
         IE_THROW() << "Wrong value for property key " << key;
     }
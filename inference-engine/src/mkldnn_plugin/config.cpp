@@ -51,6 +51,25 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
         if (streamExecutorConfigKeys.end() !=
             std::find(std::begin(streamExecutorConfigKeys), std::end(streamExecutorConfigKeys), key)) {
             streamExecutorConfig.SetConfig(key, val);
+            if (key == PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS)
+                streamsExplicitlySet = true;
+        } else if (key == PluginConfigParams::KEY_PERFORMANCE_HINT) {
+            if (val != PluginConfigParams::LATENCY && val != PluginConfigParams::THROUGHPUT)
+                IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_PERFORMANCE_HINT
+                                   << ". Expected only LATENCY/THROUGHPUT";
+            perfHint = val;
+        } else if (key == PluginConfigParams::KEY_PERFORMANCE_HINT_NUM_REQUESTS) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_PERFORMANCE_HINT_NUM_REQUESTS
+                                    << ". Expected only integer numbers";
+            }
+            if (val_i < 0)
+                IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_PERFORMANCE_HINT_NUM_REQUESTS
+                                   << ". Expected only non negative numbers";
+            perfHintNumRequests = val_i;
         } else if (key == PluginConfigParams::KEY_DYN_BATCH_LIMIT) {
             int val_i = -1;
             try {
@@ -62,6 +81,30 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             // zero and any negative value will be treated
             // as default batch size
             batchLimit = std::max(val_i, 0);
+        } else if (key == PluginConfigParams::KEY_CPU_AUTO_BATCH_SIZE) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_CPU_AUTO_BATCH_SIZE
+                                    << ". Expected only integer numbers";
+            }
+            if (val_i < 0)
+                IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_CPU_AUTO_BATCH_SIZE
+                                   << ". Expected only non negative numbers";
+            autoBatchSize = val_i;
+        } else if (key == PluginConfigParams::KEY_CPU_AUTO_BATCH_TIMEOUT) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_CPU_AUTO_BATCH_TIMEOUT
+                                    << ". Expected only integer numbers";
+            }
+            if (val_i < 0)
+                IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_CPU_AUTO_BATCH_TIMEOUT
+                                   << ". Expected only non negative numbers";
+            autoBatchTimeout = val_i;
         } else if (key == PluginConfigParams::KEY_PERF_COUNT) {
             if (val == PluginConfigParams::YES) collectPerfCounters = true;
             else if (val == PluginConfigParams::NO) collectPerfCounters = false;
@@ -94,6 +137,14 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
                 lpTransformsMode = LPTransformsMode::On;
             else
                 IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_LP_TRANSFORMS_MODE;
+        } else if (key == PluginConfigInternalParams::KEY_SNIPPETS_MODE) {
+            if (val == PluginConfigParams::YES)
+                enableSnippets = true;
+            else if (val == PluginConfigParams::NO)
+                enableSnippets = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_SNIPPETS_MODE
+                                   << ". Expected only YES/NO";
         } else if (key == PluginConfigParams::KEY_ENFORCE_BF16) {
             if (val == PluginConfigParams::YES) {
                 if (with_cpu_x86_avx512_core()) {
@@ -149,6 +200,10 @@ void Config::updateProperties() {
             _config.insert({ PluginConfigParams::KEY_DYN_BATCH_ENABLED, PluginConfigParams::NO });
 
         _config.insert({ PluginConfigParams::KEY_DYN_BATCH_LIMIT, std::to_string(batchLimit) });
+        _config.insert({ PluginConfigParams::KEY_PERFORMANCE_HINT, perfHint });
+        _config.insert({ PluginConfigParams::KEY_PERFORMANCE_HINT_NUM_REQUESTS, std::to_string(perfHintNumRequests) });
+        _config.insert({ PluginConfigParams::KEY_CPU_AUTO_BATCH_SIZE, std::to_string(autoBatchSize) });
+        _config.insert({ PluginConfigParams::KEY_CPU_AUTO_BATCH_TIMEOUT, std::to_string(autoBatchTimeout) });
         _config.insert({ PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, std::to_string(streamExecutorConfig._streams) });
         _config.insert({ PluginConfigParams::KEY_CPU_THREADS_NUM, std::to_string(streamExecutorConfig._threads) });
         IE_SUPPRESS_DEPRECATED_START
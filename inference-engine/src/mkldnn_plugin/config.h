@@ -25,6 +25,12 @@ struct Config {
     bool enableDynamicBatch = false;
     std::string dumpToDot = "";
     int batchLimit = 0;
+    int autoBatchSize = 0;
+    int autoBatchTimeout = 1;
+    std::string perfHint = "";
+    int perfHintNumRequests = 0;
+    bool streamsExplicitlySet = false;
+    bool enableSnippets = false;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
 
 #if defined(__arm__) || defined(__aarch64__)
@@ -85,7 +85,9 @@ enum Type {
     ExperimentalDetectronPriorGridGenerator,
     ExperimentalDetectronGenerateProposalsSingleImage,
     ExtractImagePatches,
-    NonMaxSuppression
+    NonMaxSuppression,
+    Subgraph,
+    ScaledDotProductAttention
 };
 
 enum Algorithm {
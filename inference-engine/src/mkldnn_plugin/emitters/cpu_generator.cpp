@@ -0,0 +1,120 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cpu_generator.hpp"
+
+#include <snippets/snippets_isa.hpp>
+#include <snippets/op/kernel.hpp>
+#include <snippets/op/tile.hpp>
+
+#include "jit_snippets_emitters.hpp"
+#include "jit_eltwise_emitters.hpp"
+#include "jit_mkldnn_emitters.hpp"
+
+#include <ngraph/opsets/opset1.hpp>
+
+using namespace mkldnn::impl::cpu::x64;
+
+namespace MKLDNNPlugin {
+
+#define CREATE_EMITTER(e_type) [this](const std::shared_ptr<ngraph::Node>& n) \
+    -> std::shared_ptr<ngraph::snippets::Emitter> { return std::make_shared<e_type>(h.get(), isa, n); };
+
+namespace {
+
+class jit_snippet : public jit_generator {
+public:
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_snippet)
+
+    jit_snippet() : jit_generator() {}
+
+    // the code is emitted by the snippet emitters directly, see CPUTargetMachine::get_snippet
+    void generate() override {}
+};
+
+}  // namespace
+
+CPUTargetMachine::CPUTargetMachine(cpu_isa_t host_isa)
+    : TargetMachine(), h(new jit_snippet()), isa(host_isa) {
+    // data movement
+    jitters[ngraph::opset1::Parameter::type_info] = CREATE_EMITTER(NopEmitter);
+    jitters[ngraph::snippets::op::BlockedParameter::type_info] = CREATE_EMITTER(NopEmitter);
+    jitters[ngraph::opset1::Result::type_info] = CREATE_EMITTER(NopEmitter);
+
+    jitters[ngraph::snippets::op::Load::type_info] = CREATE_EMITTER(LoadEmitter);
+    jitters[ngraph::snippets::op::VectorLoad::type_info] = CREATE_EMITTER(LoadEmitter);
+    jitters[ngraph::snippets::op::ScalarLoad::type_info] = CREATE_EMITTER(ScalarLoadEmitter);
+    jitters[ngraph::snippets::op::BroadcastLoad::type_info] = CREATE_EMITTER(BroadcastLoadEmitter);
+
+    jitters[ngraph::snippets::op::Store::type_info] = CREATE_EMITTER(StoreEmitter);
+    jitters[ngraph::snippets::op::VectorStore::type_info] = CREATE_EMITTER(StoreEmitter);
+    jitters[ngraph::snippets::op::ScalarStore::type_info] = CREATE_EMITTER(ScalarStoreEmitter);
+
+    jitters[ngraph::snippets::op::Scalar::type_info] = CREATE_EMITTER(ScalarEmitter);
+    jitters[ngraph::snippets::op::BroadcastMove::type_info] = CREATE_EMITTER(FakeBroadcastEmitter);
+
+    // binary
+    jitters[ngraph::opset1::Add::type_info] = CREATE_EMITTER(jit_add_emitter);
+    jitters[ngraph::opset1::Divide::type_info] = CREATE_EMITTER(jit_divide_emitter);
+    jitters[ngraph::opset1::Equal::type_info] = CREATE_EMITTER(jit_equal_emitter);
+    jitters[ngraph::opset1::FloorMod::type_info] = CREATE_EMITTER(jit_floor_mod_emitter);
+    jitters[ngraph::opset1::Greater::type_info] = CREATE_EMITTER(jit_greater_emitter);
+    jitters[ngraph::opset1::GreaterEqual::type_info] = CREATE_EMITTER(jit_greater_equal_emitter);
+    jitters[ngraph::opset1::Less::type_info] = CREATE_EMITTER(jit_less_emitter);
+    jitters[ngraph::opset1::LessEqual::type_info] = CREATE_EMITTER(jit_less_equal_emitter);
+    jitters[ngraph::opset1::LogicalAnd::type_info] = CREATE_EMITTER(jit_logical_and_emitter);
+    jitters[ngraph::opset1::LogicalOr::type_info] = CREATE_EMITTER(jit_logical_or_emitter);
+    jitters[ngraph::opset1::LogicalXor::type_info] = CREATE_EMITTER(jit_logical_xor_emitter);
+    jitters[ngraph::opset1::Maximum::type_info] = CREATE_EMITTER(jit_maximum_emitter);
+    jitters[ngraph::opset1::Minimum::type_info] = CREATE_EMITTER(jit_minimum_emitter);
+    jitters[ngraph::opset1::Mod::type_info] = CREATE_EMITTER(jit_mod_emitter);
+    jitters[ngraph::opset1::Multiply::type_info] = CREATE_EMITTER(jit_multiply_emitter);
+    jitters[ngraph::opset1::NotEqual::type_info] = CREATE_EMITTER(jit_not_equal_emitter);
+    jitters[ngraph::snippets::op::PowerStatic::type_info] = CREATE_EMITTER(jit_power_static_emitter);
+    jitters[ngraph::opset1::Power::type_info] = CREATE_EMITTER(jit_power_dynamic_emitter);
+    jitters[ngraph::opset1::PRelu::type_info] = CREATE_EMITTER(jit_prelu_emitter);
+    jitters[ngraph::opset1::SquaredDifference::type_info] = CREATE_EMITTER(jit_squared_difference_emitter);
+    jitters[ngraph::opset1::Subtract::type_info] = CREATE_EMITTER(jit_subtract_emitter);
+    jitters[ngraph::op::v0::Xor::type_info] = CREATE_EMITTER(jit_logical_xor_emitter);
+
+    // unary
+    jitters[ngraph::opset1::Abs::type_info] = CREATE_EMITTER(jit_abs_emitter);
+    jitters[ngraph::opset1::Clamp::type_info] = CREATE_EMITTER(jit_clamp_emitter);
+    jitters[ngraph::opset1::Elu::type_info] = CREATE_EMITTER(jit_elu_emitter);
+    jitters[ngraph::opset1::Erf::type_info] = CREATE_EMITTER(jit_erf_emitter);
+    jitters[ngraph::opset1::Exp::type_info] = CREATE_EMITTER(jit_exp_emitter);
+    jitters[ngraph::opset1::LogicalNot::type_info] = CREATE_EMITTER(jit_logical_not_emitter);
+    jitters[ngraph::opset1::Negative::type_info] = CREATE_EMITTER(jit_negative_emitter);
+    jitters[ngraph::opset1::Relu::type_info] = CREATE_EMITTER(jit_relu_emitter);
+    jitters[ngraph::opset1::Sigmoid::type_info] = CREATE_EMITTER(jit_sigmoid_emitter);
+    jitters[ngraph::opset1::Sqrt::type_info] = CREATE_EMITTER(jit_sqrt_emitter);
+    jitters[ngraph::opset1::Tanh::type_info] = CREATE_EMITTER(jit_tanh_emitter);
+
+    // control flow
+    jitters[ngraph::snippets::op::Kernel::type_info] = CREATE_EMITTER(KernelEmitter);
+    jitters[ngraph::snippets::op::Tile::type_info] = CREATE_EMITTER(TileEmitter);
+}
+
+size_t CPUTargetMachine::get_lanes() const {
+    switch (isa) {
+        case avx2 : return cpu_isa_traits<avx2>::vlen / sizeof(float);
+        case sse41 : return cpu_isa_traits<sse41>::vlen / sizeof(float);
+        case avx512_common : return cpu_isa_traits<avx512_common>::vlen / sizeof(float);
+        default : IE_THROW() << "unknown isa " << isa;
+    }
+}
+
+bool CPUTargetMachine::is_supported() const {
+    return mayiuse(isa);
+}
+
+ngraph::snippets::code CPUTargetMachine::get_snippet() const {
+    h->create_kernel();
+    return h->jit_ker();
+}
+
+CPUGenerator::CPUGenerator(cpu_isa_t isa) : Generator(std::make_shared<CPUTargetMachine>(isa)) {
+}
+
+}  // namespace MKLDNNPlugin
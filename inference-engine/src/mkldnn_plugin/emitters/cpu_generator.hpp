@@ -0,0 +1,37 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cpu/x64/jit_generator.hpp>
+#include "snippets/generator.hpp"
+
+#include <memory>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Describes the host CPU for the snippets generator: maps snippets dialect and elementwise operations
+ * to the JIT emitters of the plugin, the whole snippet is emitted into a single jit_generator
+ */
+class CPUTargetMachine : public ngraph::snippets::TargetMachine {
+public:
+    CPUTargetMachine(mkldnn::impl::cpu::x64::cpu_isa_t host_isa);
+
+    bool is_supported() const override;
+    ngraph::snippets::code get_snippet() const override;
+    size_t get_lanes() const override;
+
+private:
+    std::unique_ptr<mkldnn::impl::cpu::x64::jit_generator> h;
+    mkldnn::impl::cpu::x64::cpu_isa_t isa;
+};
+
+class CPUGenerator : public ngraph::snippets::Generator {
+public:
+    CPUGenerator(mkldnn::impl::cpu::x64::cpu_isa_t isa);
+    ~CPUGenerator() = default;
+};
+
+}  // namespace MKLDNNPlugin
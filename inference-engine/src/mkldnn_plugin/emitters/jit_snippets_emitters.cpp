@@ -0,0 +1,269 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "jit_snippets_emitters.hpp"
+
+#include <snippets/op/kernel.hpp>
+#include <snippets/op/tile.hpp>
+#include <snippets/op/scalar.hpp>
+
+#include <cstddef>
+
+using namespace mkldnn::impl::utils;
+using namespace mkldnn::impl;
+using namespace mkldnn::impl::cpu::x64;
+using namespace Xbyak;
+
+#define GET_OFF(field) offsetof(jit_snippets_call_args, field)
+
+namespace MKLDNNPlugin {
+
+/// KERNEL ///
+KernelEmitter::KernelEmitter(jit_generator* h, cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+    : jit_emitter(h, isa, n) {
+    auto kernel = ngraph::as_type_ptr<ngraph::snippets::op::Kernel>(n);
+    if (!kernel)
+        IE_THROW() << "KernelEmitter is expected to be created for Kernel operation, got " << n->get_type_name();
+    code = kernel->region;
+}
+
+void KernelEmitter::emit_code(const std::vector<size_t> &in, const std::vector<size_t> &out,
+                              const std::vector<size_t> &pool, const std::vector<size_t> &gpr) const {
+    // Kernel owns all the registers, so nothing has to be preserved here
+    emit_impl(in, out, pool, gpr, nullptr);
+}
+
+void KernelEmitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                              const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                              const MKLDNNPlugin::emitter_context *emit_context) const {
+    if (in.size() != 2)
+        IE_THROW() << "KernelEmitter expects the number of inputs and outputs, got " << in.size() << " arguments";
+
+    const size_t nptrs = in[0] + in[1];
+    if (nptrs > SNIPPETS_MAX_SNIPPETS_DIMS)
+        IE_THROW() << "KernelEmitter supports up to " << SNIPPETS_MAX_SNIPPETS_DIMS << " inputs and outputs, got " << nptrs;
+
+    h->preamble();
+
+    Reg64 reg_params = abi_param1;
+    for (size_t i = 0; i < nptrs; i++)
+        h->mov(Reg64(snippets_reg64_tmp_start + i), h->ptr[reg_params + GET_OFF(ptrs) + i * sizeof(void*)]);
+    h->mov(Reg64(snippets_reg64_tmp_start + nptrs), h->ptr[reg_params + GET_OFF(work_amount)]);
+
+    for (auto& c : code) {
+        c.first->emit_code(c.second.first, c.second.second, pool, gpr);
+    }
+
+    h->postamble();
+}
+
+/// TILE ///
+TileEmitter::TileEmitter(jit_generator* h, cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+    : jit_emitter(h, isa, n) {
+    auto tile = ngraph::as_type_ptr<ngraph::snippets::op::Tile>(n);
+    if (!tile)
+        IE_THROW() << "TileEmitter is expected to be created for Tile operation, got " << n->get_type_name();
+    code = tile->region;
+}
+
+void TileEmitter::emit_code(const std::vector<size_t> &in, const std::vector<size_t> &out,
+                            const std::vector<size_t> &pool, const std::vector<size_t> &gpr) const {
+    emit_impl(in, out, pool, gpr, nullptr);
+}
+
+void TileEmitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                            const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                            const MKLDNNPlugin::emitter_context *emit_context) const {
+    if (in.size() != 2)
+        IE_THROW() << "TileEmitter expects the increment and the number of kernel arguments, got " << in.size() << " arguments";
+
+    const size_t inc = in[0];
+    const size_t nptrs = in[1];
+    Reg64 amount = Reg64(snippets_reg64_tmp_start + nptrs);
+
+    // Tiles of a kernel are executed one by one: the vector one processes as many elements as possible
+    // and leaves the tail for the scalar one, pointers are advanced by loads and stores inside the body
+    Label for_body;
+    Label for_end;
+
+    h->cmp(amount, inc);
+    h->jl(for_end, CodeGenerator::T_NEAR);
+
+    h->L(for_body);
+    {
+        for (auto& c : code) {
+            c.first->emit_code(c.second.first, c.second.second, pool, gpr);
+        }
+
+        h->sub(amount, inc);
+        h->cmp(amount, inc);
+        h->jge(for_body, CodeGenerator::T_NEAR);
+    }
+
+    h->L(for_end);
+}
+
+/// BROADCAST MOVE ///
+void FakeBroadcastEmitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                                     const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                                     const MKLDNNPlugin::emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(in, out);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in, out);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in, out);
+    } else {
+        assert(!"unsupported isa");
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void FakeBroadcastEmitter::emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Vmm vmm_src0 = Vmm(in[0]);
+    Vmm vmm_dst  = Vmm(out[0]);
+
+    h->uni_vbroadcastss(vmm_dst, Xmm(vmm_src0.getIdx()));
+}
+
+/// SCALAR ///
+ScalarEmitter::ScalarEmitter(jit_generator* h, cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+    : jit_emitter(h, isa, n) {
+    auto scalar = ngraph::as_type_ptr<ngraph::snippets::op::Scalar>(n);
+    if (!scalar)
+        IE_THROW() << "ScalarEmitter is expected to be created for Scalar operation, got " << n->get_type_name();
+    value = float2int(scalar->cast_vector<float>()[0]);
+    prepare_table();
+}
+
+void ScalarEmitter::register_table_entries() {
+    push_arg_entry_of("scalar", value, true);
+}
+
+void ScalarEmitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                              const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                              const MKLDNNPlugin::emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(in, out);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in, out);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in, out);
+    } else {
+        assert(!"unsupported isa");
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void ScalarEmitter::emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Vmm vmm_dst = Vmm(out[0]);
+
+    h->uni_vmovups(vmm_dst, table_val("scalar"));
+}
+
+/// MEMORY ///
+MemoryEmitter::MemoryEmitter(jit_generator* h, cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+    : jit_emitter(h, isa, n) {
+    auto& rt = n->get_rt_info();
+    auto it = rt.find("effectiveAddress");
+    if (it == rt.end())
+        IE_THROW() << "Effective address is not assigned for " << n->get_friendly_name() << " operation";
+    ea = static_cast<int>(ngraph::as_type_ptr<ngraph::VariantWrapper<int64_t>>(it->second)->get());
+}
+
+void StoreEmitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                             const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                             const MKLDNNPlugin::emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(in, out);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in, out);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in, out);
+    } else {
+        assert(!"unsupported isa");
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void StoreEmitter::emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Reg64 out_reg(ea);
+    Vmm vmm_src0 = Vmm(in[0]);
+
+    h->uni_vmovups(h->ptr[out_reg], vmm_src0);
+    h->add(out_reg, get_vec_length());
+}
+
+void ScalarStoreEmitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                                   const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                                   const MKLDNNPlugin::emitter_context *emit_context) const {
+    Reg64 out_reg(ea);
+    Xmm xmm_src0 = Xmm(in[0]);
+
+    h->uni_vmovss(h->ptr[out_reg], xmm_src0);
+    h->add(out_reg, sizeof(float));
+}
+
+void LoadEmitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                            const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                            const MKLDNNPlugin::emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(in, out);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in, out);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in, out);
+    } else {
+        assert(!"unsupported isa");
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void LoadEmitter::emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Reg64 in_reg(ea);
+    Vmm vmm_dst = Vmm(out[0]);
+
+    h->uni_vmovups(vmm_dst, h->ptr[in_reg]);
+    h->add(in_reg, get_vec_length());
+}
+
+void BroadcastLoadEmitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                                     const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                                     const MKLDNNPlugin::emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(in, out);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in, out);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in, out);
+    } else {
+        assert(!"unsupported isa");
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void BroadcastLoadEmitter::emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Reg64 in_reg(ea);
+    Vmm vmm_dst = Vmm(out[0]);
+
+    // the same value is used for every element of the tile, so the pointer is not advanced
+    h->uni_vbroadcastss(vmm_dst, h->ptr[in_reg]);
+}
+
+void ScalarLoadEmitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                                  const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                                  const MKLDNNPlugin::emitter_context *emit_context) const {
+    Reg64 in_reg(ea);
+    Xmm xmm_dst = Xmm(out[0]);
+
+    h->uni_vmovss(xmm_dst, h->ptr[in_reg]);
+    h->add(in_reg, sizeof(float));
+}
+
+} // namespace MKLDNNPlugin
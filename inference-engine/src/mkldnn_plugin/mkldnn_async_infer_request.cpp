@@ -5,11 +5,50 @@
 #include "mkldnn_async_infer_request.h"
 #include <memory>
 
+namespace {
+
+// Passes the next pipeline stage to the batch collector, the stage is run once the batch with the request is inferred
+struct BatchStageExecutor : public InferenceEngine::ITaskExecutor {
+    BatchStageExecutor(const MKLDNNPlugin::MKLDNNBatchCollector::Ptr& batchCollector,
+                       MKLDNNPlugin::MKLDNNInferRequest* request, std::exception_ptr& batchException) :
+        _batchCollector{batchCollector}, _request{request}, _batchException(batchException) {}
+
+    void run(InferenceEngine::Task task) override {
+        _batchCollector->Submit(_request, [this, task](std::exception_ptr exception) {
+            _batchException = exception;
+            task();
+        });
+    }
+
+    MKLDNNPlugin::MKLDNNBatchCollector::Ptr _batchCollector;
+    MKLDNNPlugin::MKLDNNInferRequest* _request;
+    std::exception_ptr& _batchException;
+};
+
+}  // namespace
+
 MKLDNNPlugin::MKLDNNAsyncInferRequest::MKLDNNAsyncInferRequest(const InferenceEngine::IInferRequestInternal::Ptr& inferRequest,
                                                                const InferenceEngine::ITaskExecutor::Ptr& taskExecutor,
-                                                               const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor)
+                                                               const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor,
+                                                               const MKLDNNBatchCollector::Ptr& batchCollector)
     : InferenceEngine::AsyncInferRequestThreadSafeDefault(inferRequest, taskExecutor, callbackExecutor) {
-    static_cast<MKLDNNInferRequest*>(inferRequest.get())->SetAsyncRequest(this);
+    auto request = static_cast<MKLDNNInferRequest*>(inferRequest.get());
+    request->SetAsyncRequest(this);
+
+    // Inputs are prepared by the request itself, while the inference is done by the collector for the whole batch
+    if (batchCollector != nullptr) {
+        _pipeline = {
+            {taskExecutor, [request] {
+                request->PrepareBatchInputData();
+            }},
+            {std::make_shared<BatchStageExecutor>(batchCollector, request, _batchException), [this] {
+                auto exception = _batchException;
+                _batchException = nullptr;
+                if (exception)
+                    std::rethrow_exception(exception);
+            }}
+        };
+    }
 }
 
 MKLDNNPlugin::MKLDNNAsyncInferRequest::~MKLDNNAsyncInferRequest() {
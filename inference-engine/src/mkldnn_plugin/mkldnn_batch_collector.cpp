@@ -0,0 +1,91 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_batch_collector.h"
+
+#include <utility>
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+MKLDNNBatchCollector::MKLDNNBatchCollector(int maxBatch, std::chrono::milliseconds timeout,
+                                           const ITaskExecutor::Ptr& executor, BatchTask batchTask) :
+    _maxBatch(static_cast<size_t>(maxBatch)),
+    _timeout(timeout),
+    _executor(executor),
+    _batchTask(std::move(batchTask)) {
+    _pending.reserve(_maxBatch);
+    _timer = std::thread([this] { TimerLoop(); });
+}
+
+MKLDNNBatchCollector::~MKLDNNBatchCollector() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _queueCondVar.notify_one();
+    _timer.join();
+}
+
+void MKLDNNBatchCollector::Submit(MKLDNNInferRequest* request, Callback done) {
+    std::vector<Slot> batch;
+    bool first = false;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        first = _pending.empty();
+        if (first)
+            _deadline = std::chrono::steady_clock::now() + _timeout;
+        _pending.push_back({request, std::move(done)});
+        if (_pending.size() == _maxBatch) {
+            std::swap(batch, _pending);
+            _pending.reserve(_maxBatch);
+        }
+    }
+    if (!batch.empty()) {
+        Dispatch(std::move(batch));
+    } else if (first) {
+        _queueCondVar.notify_one();
+    }
+}
+
+void MKLDNNBatchCollector::Dispatch(std::vector<Slot> batch) {
+    auto slots = std::make_shared<std::vector<Slot>>(std::move(batch));
+    _executor->run([this, slots] {
+        std::vector<MKLDNNInferRequest*> requests;
+        requests.reserve(slots->size());
+        for (const auto& slot : *slots)
+            requests.push_back(slot.request);
+
+        std::vector<std::exception_ptr> exceptions;
+        try {
+            exceptions = _batchTask(requests);
+        } catch (...) {
+            exceptions.assign(slots->size(), std::current_exception());
+        }
+        // The collector may be destroyed once the last request is done, so it isn't touched below
+        for (size_t i = 0; i < slots->size(); i++)
+            (*slots)[i].done(exceptions[i]);
+    });
+}
+
+void MKLDNNBatchCollector::TimerLoop() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (!_stop) {
+        if (_pending.empty()) {
+            _queueCondVar.wait(lock);
+            continue;
+        }
+        // The deadline is updated when a full batch is dispatched and a new one is started
+        if (std::chrono::steady_clock::now() < _deadline) {
+            _queueCondVar.wait_until(lock, _deadline);
+            continue;
+        }
+        std::vector<Slot> batch;
+        std::swap(batch, _pending);
+        _pending.reserve(_maxBatch);
+        lock.unlock();
+        Dispatch(std::move(batch));
+        lock.lock();
+    }
+}
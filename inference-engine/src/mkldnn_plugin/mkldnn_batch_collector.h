@@ -0,0 +1,74 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <threading/ie_itask_executor.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+class MKLDNNInferRequest;
+
+/**
+ * @brief Collects asynchronous infer requests of the executable network into batches.
+ *
+ * The batch is inferred as soon as it contains the maximum number of requests or the first collected request
+ * waited for the timeout. After that the requests continue their pipelines on the thread which inferred the batch.
+ */
+class MKLDNNBatchCollector {
+public:
+    using Ptr = std::shared_ptr<MKLDNNBatchCollector>;
+    using BatchTask = std::function<std::vector<std::exception_ptr>(const std::vector<MKLDNNInferRequest*>&)>;
+    using Callback = std::function<void(std::exception_ptr)>;
+
+    /**
+     * @param maxBatch  Maximum number of requests in the batch
+     * @param timeout   Time the first collected request waits for other requests
+     * @param executor  Executor to infer batches with
+     * @param batchTask Infers the batch and returns the exception of each request if any. A request which fails is
+     *                  excluded from the batch, an exception thrown by the task itself fails all requests of the batch
+     */
+    MKLDNNBatchCollector(int maxBatch, std::chrono::milliseconds timeout,
+                         const InferenceEngine::ITaskExecutor::Ptr& executor, BatchTask batchTask);
+    ~MKLDNNBatchCollector();
+
+    /**
+     * @brief Adds the request to the collected batch
+     * @param request The request which inputs are ready
+     * @param done    Called after the batch is inferred with the exception of the request if any
+     */
+    void Submit(MKLDNNInferRequest* request, Callback done);
+
+private:
+    struct Slot {
+        MKLDNNInferRequest* request;
+        Callback done;
+    };
+
+    void Dispatch(std::vector<Slot> batch);
+    void TimerLoop();
+
+    const size_t                                _maxBatch;
+    const std::chrono::milliseconds             _timeout;
+    InferenceEngine::ITaskExecutor::Ptr         _executor;
+    BatchTask                                   _batchTask;
+
+    std::mutex                                  _mutex;
+    std::condition_variable                     _queueCondVar;
+    std::vector<Slot>                           _pending;
+    std::chrono::steady_clock::time_point       _deadline;
+    bool                                        _stop = false;
+    std::thread                                 _timer;
+};
+
+}  // namespace MKLDNNPlugin
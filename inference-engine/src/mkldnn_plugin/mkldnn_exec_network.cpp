@@ -11,6 +11,7 @@
 #include "mkldnn_memory_state.h"
 #include "mkldnn_itt.h"
 #include "nodes/mkldnn_memory_node.hpp"
+#include "utils/serialize.hpp"
 #include <threading/ie_executor_manager.hpp>
 
 #include <threading/ie_cpu_streams_executor.hpp>
@@ -35,13 +36,15 @@ MKLDNNExecNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap network
 MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
                                      const Config &cfg,
                                      const MKLDNNExtensionManager::Ptr& extMgr,
-                                     NumaNodesWeights &numaNodesWeights) :
+                                     NumaNodesWeights &numaNodesWeights,
+                                     const InferenceEngine::CNNNetwork &batchNetwork) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
     extensionManager(extMgr),
     _cfg{cfg},
     _name{network.getName()},
     _numaNodesWeights(numaNodesWeights),
-        _network(network) {
+        _network(network),
+    _batchNetwork(batchNetwork) {
     auto function = network.getFunction();
     if (function == nullptr) {
         IE_THROW() << "CPU plug-in doesn't support not ngraph-based model!";
@@ -77,18 +80,52 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
         op->get_friendly_name();
     }
 
+    const bool autoBatch = _cfg.autoBatchSize > 1;
     int streams = std::max(1, _cfg.streamExecutorConfig._streams);
     std::vector<Task> tasks; tasks.resize(streams);
     _graphs.resize(streams);
+    if (autoBatch)
+        _batchGraphs.resize(streams);
+    // The graphs of all streams are identical, so mkldnn primitives are compiled once and shared between them.
+    // The rest of the graph compilation is still done by every stream
+    if (streams > 1) {
+        _primitivesCache = std::make_shared<MKLDNNPrimitivesCache>();
+        if (autoBatch)
+            _batchPrimitivesCache = std::make_shared<MKLDNNPrimitivesCache>();
+    }
     if (_cfg.streamExecutorConfig._streams != 0) {
         for (auto&& task : tasks) {
-            task = [this] {
+            task = [this, autoBatch] {
                 MKLDNNExecNetwork::GetGraph();
+                if (autoBatch)
+                    MKLDNNExecNetwork::GetBatchGraph();
             };
         }
         _taskExecutor->runAndWait(tasks);
     } else {
         MKLDNNExecNetwork::GetGraph();
+        if (autoBatch)
+            MKLDNNExecNetwork::GetBatchGraph();
+    }
+
+    if (autoBatch) {
+        // Each request owns a single element of the batch, so per request states and mean images are not supported
+        auto& graph = GetGraph()._graph;
+        for (auto& node : graph.GetNodes()) {
+            if (node->getType() == MemoryInput)
+                IE_THROW() << "Automatic batching is not supported for networks with states";
+        }
+        for (const auto& input : _network.getInputsInfo()) {
+            if (graph.hasMeanImageFor(input.first))
+                IE_THROW() << "Automatic batching is not supported for networks with mean image preprocessing";
+        }
+
+        // Incomplete batches are inferred using dynamic batch if the topology allows it, otherwise the whole batch is inferred
+        _batchDynamic = CanProcessDynBatch(_batchNetwork);
+        _batchCollector = std::make_shared<MKLDNNBatchCollector>(_cfg.autoBatchSize, std::chrono::milliseconds(_cfg.autoBatchTimeout),
+                                                                 _taskExecutor, [this] (const std::vector<MKLDNNInferRequest*>& requests) {
+            return InferBatch(requests);
+        });
     }
 
     // Save all MemoryLayer data tensors. Will use insight about mechanics
@@ -113,6 +150,16 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
 }
 
 MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() {
+    return GetGraph(_graphs, _network, _numaNodesWeights, _primitivesCache);
+}
+
+MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetBatchGraph() {
+    return GetGraph(_batchGraphs, _batchNetwork, _batchNumaNodesWeights, _batchPrimitivesCache);
+}
+
+MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph(std::deque<Graph>& graphs, const InferenceEngine::CNNNetwork& network,
+                                                           NumaNodesWeights& numaNodesWeights,
+                                                           const MKLDNNPrimitivesCache::Ptr& primitivesCache) {
     int streamId = 0;
     int numaNodeId = 0;
     auto streamsExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(_taskExecutor.get());
@@ -120,7 +167,7 @@ MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() {
         streamId = streamsExecutor->GetStreamId();
         numaNodeId = streamsExecutor->GetNumaNodeId();
     }
-    auto graphLock = Graph::Lock(_graphs[streamId % _graphs.size()]);
+    auto graphLock = Graph::Lock(graphs[streamId % graphs.size()]);
     if (!graphLock._graph.IsReady()) {
         std::exception_ptr exception;
         auto makeGraph = [&] {
@@ -129,7 +176,8 @@ MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() {
                     std::lock_guard<std::mutex> lock{_cfgMutex};
                     graphLock._graph.setConfig(_cfg);
                 }
-                graphLock._graph.CreateGraph(_network, extensionManager, _numaNodesWeights[numaNodeId]);
+                graphLock._graph.primitivesCache = primitivesCache;
+                graphLock._graph.CreateGraph(network, extensionManager, numaNodesWeights[numaNodeId]);
             } catch(...) {
                 exception = std::current_exception();
             }
@@ -146,6 +194,39 @@ MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() {
     return graphLock;
 }
 
+std::vector<std::exception_ptr> MKLDNNExecNetwork::InferBatch(const std::vector<MKLDNNInferRequest*>& requests) {
+    std::vector<std::exception_ptr> exceptions(requests.size());
+    auto graphLock = GetBatchGraph();
+    auto& graph = graphLock._graph;
+
+    // Requests canceled while they waited for the batch are dropped, the rest are packed to the first batch elements
+    std::vector<size_t> batch;
+    batch.reserve(requests.size());
+    for (size_t i = 0; i < requests.size(); i++) {
+        try {
+            requests[i]->ThrowIfCanceled();
+            requests[i]->PushBatchInputData(graph, batch.size());
+            batch.push_back(i);
+        } catch (...) {
+            exceptions[i] = std::current_exception();
+        }
+    }
+    if (batch.empty())
+        return exceptions;
+
+    graph.Infer(nullptr, _batchDynamic ? static_cast<int>(batch.size()) : -1);
+
+    for (size_t batchIdx = 0; batchIdx < batch.size(); batchIdx++) {
+        auto i = batch[batchIdx];
+        try {
+            requests[i]->PullBatchOutputData(graph, batchIdx);
+        } catch (...) {
+            exceptions[i] = std::current_exception();
+        }
+    }
+    return exceptions;
+}
+
 void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &properties) {
     {
         std::lock_guard<std::mutex> lock{_cfgMutex};
@@ -157,10 +238,21 @@ void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &pr
             graphLock._graph.setProperty(properties);
         }
     }
+    for (auto& g : _batchGraphs) {
+        auto graphLock = Graph::Lock(g);
+        if (graphLock._graph.IsReady()) {
+            graphLock._graph.setProperty(properties);
+        }
+    }
 }
 
 InferenceEngine::IInferRequestInternal::Ptr MKLDNNExecNetwork::CreateInferRequest() {
-    return CreateAsyncInferRequestFromSync<MKLDNNAsyncInferRequest>();
+    if (_batchCollector == nullptr)
+        return CreateAsyncInferRequestFromSync<MKLDNNAsyncInferRequest>();
+
+    auto syncRequestImpl = CreateInferRequestImpl(_networkInputs, _networkOutputs);
+    syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
+    return std::make_shared<MKLDNNAsyncInferRequest>(syncRequestImpl, _taskExecutor, _callbackExecutor, _batchCollector);
 }
 
 InferenceEngine::CNNNetwork MKLDNNExecNetwork::GetExecGraphInfo() {
@@ -170,6 +262,15 @@ InferenceEngine::CNNNetwork MKLDNNExecNetwork::GetExecGraphInfo() {
     return GetGraph()._graph.dump();
 }
 
+void MKLDNNExecNetwork::Export(std::ostream& modelStream) {
+    // The serializer checks the network before writing, so a network which can't be exported throws
+    // NotImplemented without writing anything and the Core doesn't cache it.
+    // Only the transformed network is written: the import skips the nGraph transformations, but still selects
+    // primitive descriptors, runs the graph optimizer and compiles the primitives of every stream graph
+    CNNNetworkSerializer serializer(modelStream, extensionManager->getOpSets());
+    serializer << _network;
+}
+
 Parameter MKLDNNExecNetwork::GetConfig(const std::string &name) const {
     if (_graphs.size() == 0)
         IE_THROW() << "No graph was found";
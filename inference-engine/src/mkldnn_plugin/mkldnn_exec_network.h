@@ -9,6 +9,7 @@
 
 #include "mkldnn_graph.h"
 #include "mkldnn_extension_mngr.h"
+#include "mkldnn_batch_collector.h"
 #include <threading/ie_thread_local.hpp>
 
 #include <vector>
@@ -30,7 +31,8 @@ public:
     InferenceEngine::IInferRequestInternal::Ptr CreateInferRequest() override;
 
     MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network, const Config &cfg,
-                      const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing);
+                      const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing,
+                      const InferenceEngine::CNNNetwork &batchNetwork = {});
 
     void setProperty(const std::map<std::string, std::string> &properties);
 
@@ -40,6 +42,8 @@ public:
 
     InferenceEngine::CNNNetwork GetExecGraphInfo() override;
 
+    void Export(std::ostream& modelStream) override;
+
     INFERENCE_ENGINE_DEPRECATED("Use InferRequest::QueryState instead")
     std::vector<InferenceEngine::IVariableStateInternal::Ptr> QueryState() override;
 
@@ -62,12 +66,27 @@ protected:
     // WARNING: Do not use _graphs directly.
     std::deque<Graph>                           _graphs;
     NumaNodesWeights&                           _numaNodesWeights;
+    MKLDNNPrimitivesCache::Ptr                  _primitivesCache;
+
+    // Automatic batching: the network reshaped to the maximum batch and its graphs for each stream.
+    // Weights are not shared with the original graphs, since constant subgraphs may depend on the batch.
+    const InferenceEngine::CNNNetwork           _batchNetwork;
+    std::deque<Graph>                           _batchGraphs;
+    NumaNodesWeights                            _batchNumaNodesWeights;
+    MKLDNNPrimitivesCache::Ptr                  _batchPrimitivesCache;
+    bool                                        _batchDynamic = false;
+    MKLDNNBatchCollector::Ptr                   _batchCollector;
 
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
      *       even from main thread
      */
     Graph::Lock GetGraph();
+    Graph::Lock GetBatchGraph();
+    Graph::Lock GetGraph(std::deque<Graph>& graphs, const InferenceEngine::CNNNetwork& network,
+                         NumaNodesWeights& numaNodesWeights, const MKLDNNPrimitivesCache::Ptr& primitivesCache);
+
+    std::vector<std::exception_ptr> InferBatch(const std::vector<MKLDNNInferRequest*>& requests);
 
     bool CanProcessDynBatch(const InferenceEngine::CNNNetwork &network) const;
 };
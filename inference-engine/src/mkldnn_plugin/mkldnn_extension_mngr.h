@@ -7,7 +7,9 @@
 #include <map>
 #include <vector>
 #include <memory>
+#include <string>
 #include <ie_iextension.h>
+#include <ngraph/opsets/opset.hpp>
 #include "nodes/list.hpp"
 
 namespace MKLDNNPlugin {
@@ -19,6 +21,7 @@ public:
     InferenceEngine::ILayerImpl::Ptr CreateImplementation(const std::shared_ptr<ngraph::Node>& op);
     std::shared_ptr<InferenceEngine::ILayerImplFactory> CreateExtensionFactory(const std::shared_ptr<ngraph::Node>& op);
     void AddExtension(const InferenceEngine::IExtensionPtr& extension);
+    std::map<std::string, ngraph::OpSet> getOpSets() const;
 
 private:
     std::vector<InferenceEngine::IExtensionPtr> _extensions;
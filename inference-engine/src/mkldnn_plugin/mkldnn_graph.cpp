@@ -19,7 +19,7 @@
 #include "mkldnn_graph_optimizer.h"
 #include "mkldnn_extension_utils.h"
 #include "mkldnn_extension_mngr.h"
-#include "mkldnn_memory_solver.hpp"
+#include "memory_solver.hpp"
 #include "mkldnn_itt.h"
 #include "mkldnn_infer_request.h"
 #include <nodes/mkldnn_input_node.h>
@@ -701,6 +701,7 @@ void MKLDNNGraph::CreatePrimitives() {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNGraph::CreatePrimitives");
     for (auto& node : graphNodes) {
         OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, node->profiling.createPrimitive);
+        node->primitivesCache = primitivesCache;
         node->createPrimitive();
     }
 }
@@ -801,6 +802,74 @@ void MKLDNNGraph::PullOutputData(const BlobMap &out) {
     }
 }
 
+// Returns the memory of the batch element, the batch dimension must not be split into blocks
+static MKLDNNMemoryPtr getBatchElement(const mkldnn::engine& eng, const MKLDNNMemory& mem, size_t batchIdx) {
+    auto desc = mem.GetDescriptor();
+    const auto& blocking = desc.data.format_desc.blocking;
+    if (desc.data.format_kind != dnnl_blocked || desc.data.ndims == 0 ||
+        std::find(blocking.inner_idxs, blocking.inner_idxs + blocking.inner_nblks, 0) != blocking.inner_idxs + blocking.inner_nblks)
+        IE_THROW() << "Cannot get a batch element of the memory with non blocked batch dimension";
+    if (batchIdx >= static_cast<size_t>(desc.data.dims[0]))
+        IE_THROW() << "Batch element " << batchIdx << " is out of the batch " << desc.data.dims[0];
+
+    auto elementPtr = static_cast<uint8_t*>(mem.GetPtr()) +
+                      batchIdx * blocking.strides[0] * MKLDNNExtensionUtils::sizeOfDataType(mem.GetDataType());
+    desc.data.dims[0] = 1;
+    desc.data.padded_dims[0] = 1;
+    desc.data.offset0 = 0;
+
+    auto element = std::make_shared<MKLDNNMemory>(eng);
+    element->Create(desc, elementPtr, false);
+    return element;
+}
+
+void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in, size_t batchIdx) {
+    if (!IsReady()) IE_THROW()<< "Wrong state. Topology not ready.";
+
+    auto input = inputNodesMap.find(name);
+    if (input == inputNodesMap.end())
+        IE_THROW() << "Input blob for infer '" << name << "' doesn't correspond to input in network";
+
+    auto element = getBatchElement(eng, input->second->getChildEdgeAt(0)->getMemory(), batchIdx);
+    if (in->size() != element->GetElementsCount())
+        IE_THROW() << "Input blob number of elements is not equal network input batch element number of elements ("
+                           << in->size() << "!=" << element->GetElementsCount() << ").";
+
+    auto ext_mem = MKLDNNMemory(eng);
+    ext_mem.Create(MKLDNNMemoryDesc{in->getTensorDesc()}, in->cbuffer(), false);
+    element->SetData(ext_mem, 0, false);
+}
+
+void MKLDNNGraph::PullOutputData(const BlobMap &out, size_t batchIdx) {
+    if (!IsReady())
+        IE_THROW() << "Wrong state. Topology not ready.";
+
+    for (auto &outputMap : outputNodesMap) {
+        auto name = outputMap.first;
+        auto node = outputMap.second;
+
+        if (!out.count(name)) {
+            IE_THROW(Unexpected) << "The network outputs do not contain mkldnn graph output node name: \"" << name << "\"";
+        }
+
+        const Blob::Ptr &ext_blob = out.at(name);
+        auto element = getBatchElement(eng, node->getParentEdgeAt(0)->getMemory(), batchIdx);
+        if (ext_blob->size() != element->GetElementsCount())
+            IE_THROW() << "Output blob number of elements is not equal network output batch element number of elements ("
+                               << ext_blob->size() << "!=" << element->GetElementsCount() << ").";
+
+        const TensorDesc actualDesc = element->GetDesc();
+        const auto& expectedDesc = ext_blob->getTensorDesc();
+        if (actualDesc.getBlockingDesc() != expectedDesc.getBlockingDesc()) {
+            auto outBloMem = MKLDNNMemory(eng);
+            outBloMem.Create(MKLDNNMemoryDesc{expectedDesc}, ext_blob->buffer(), false);
+            outBloMem.SetData(*element, 0, false);
+        } else {
+            cpu_convert(element->GetPtr(), ext_blob->buffer(), actualDesc.getPrecision(), expectedDesc.getPrecision(), ext_blob->size());
+        }
+    }
+}
+
 void MKLDNNGraph::Infer(MKLDNNInferRequest* request, int batch) {
     if (!IsReady()) {
         IE_THROW() << "Wrong state. Topology is not ready.";
@@ -22,6 +22,8 @@ class MKLDNNGraph {
 public:
     typedef std::shared_ptr<MKLDNNGraph> Ptr;
     MKLDNNWeightsSharing::Ptr weightsCache;
+    // primitives shared with the graphs of other streams, may be null
+    MKLDNNPrimitivesCache::Ptr primitivesCache;
 
     enum Status {
         NotReady = 0,
@@ -59,6 +61,10 @@ public:
     void PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in);
     void PullOutputData(const InferenceEngine::BlobMap &out);
 
+    // Copy a single batch element of inputs and outputs, so blobs have batch 1
+    void PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in, size_t batchIdx);
+    void PullOutputData(const InferenceEngine::BlobMap &out, size_t batchIdx);
+
     void Infer(MKLDNNInferRequest* request = nullptr, int batch = -1);
 
     const std::vector<MKLDNNNodePtr>& GetNodes() const {
@@ -17,6 +17,7 @@
 #include <nodes/mkldnn_transpose_node.h>
 #include "nodes/mkldnn_interpolate_node.h"
 #include "nodes/mkldnn_input_node.h"
+#include "nodes/mkldnn_embedding_bag_sum_node.h"
 #include "nodes/common/cpu_convert.h"
 
 #include "mkldnn/ie_mkldnn.h"
@@ -55,6 +56,10 @@ void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
     FuseConvolutionAndBias(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseEmbeddingBagAndDequantization");
+    FuseEmbeddingBagAndDequantization(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseMultiplyAndAdd");
     FuseMultiplyAndAdd(graph);
     graph.RemoveDroppedNodes();
@@ -115,6 +120,10 @@ void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
     FuseFullyConnectedAndSimpleOperation(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseMatMulAndSimpleOperation");
+    FuseMatMulAndSimpleOperation(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseMVNAndSimpleOperation");
     FuseMVNAndSimpleOperation(graph);
     graph.RemoveDroppedNodes();
@@ -577,6 +586,90 @@ void MKLDNNGraphOptimizer::FuseConvolutionAndZeroPoints(MKLDNNGraph &graph) {
     }
 }
 
+void MKLDNNGraphOptimizer::FuseEmbeddingBagAndDequantization(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isSutableEmbeddingNode = [](MKLDNNNodePtr node) {
+        return one_of(node->getType(), EmbeddingBagOffsetsSum, EmbeddingBagPackedSum, EmbeddingSegmentsSum) &&
+               node->getOriginalInputPrecisionAtPort(0) == Precision::FP32;
+    };
+
+    auto isConstInput = [](MKLDNNNodePtr node) {
+        return node->getType() == Input && node->isConstant();
+    };
+
+    // Table of the embedding node is dequantized as Multiply(Convert(I8/U8 table), per row scales)
+    auto getRowScales = [&](MKLDNNNodePtr multiply, int convertPort, std::vector<float>& rowScales) {
+        if (multiply->getType() != Eltwise || multiply->getAlgorithm() != EltwiseMultiply ||
+            !multiply->getFusedWith().empty() || multiply->getParentEdges().size() != 2 || multiply->getChildEdges().size() != 1)
+            return false;
+
+        auto convert = multiply->getParentEdgesAtPort(convertPort)[0]->getParent();
+        if (convert->getType() != Convert || convert->getChildEdges().size() != 1)
+            return false;
+        auto table = convert->getParentEdgesAtPort(0)[0]->getParent();
+        if (!isConstInput(table) || !one_of(table->getOriginalOutputPrecisionAtPort(0), Precision::I8, Precision::U8))
+            return false;
+
+        auto scales = multiply->getParentEdgesAtPort(1 - convertPort)[0]->getParent();
+        if (!isConstInput(scales) || scales->getOriginalOutputPrecisionAtPort(0) != Precision::FP32)
+            return false;
+
+        const auto tableDims = convert->getParentEdgesAtPort(0)[0]->getDims();
+        const auto scalesDims = multiply->getParentEdgesAtPort(1 - convertPort)[0]->getDims();
+        if (scalesDims.ndims() != tableDims.ndims() || tableDims.ndims() < 2 ||
+            (scalesDims[0] != tableDims[0] && scalesDims[0] != 1))
+            return false;
+        for (int i = 1; i < scalesDims.ndims(); i++) {
+            if (scalesDims[i] != 1)
+                return false;
+        }
+
+        auto scalesConstant = dynamic_cast<MKLDNNInputNode*>(scales.get());
+        if (scalesConstant == nullptr || scalesConstant->getMemoryPtr() == nullptr)
+            return false;
+        auto scalesData = static_cast<const float*>(scalesConstant->getMemoryPtr()->GetPtr());
+        if (scalesData == nullptr)
+            return false;
+
+        rowScales.resize(tableDims[0]);
+        for (size_t i = 0; i < rowScales.size(); i++)
+            rowScales[i] = scalesData[scalesDims[0] == 1 ? 0 : i];
+        return true;
+    };
+
+    for (int i = 0; i < graphNodes.size(); i++) {
+        auto embedding = graphNodes[i];
+        if (!isSutableEmbeddingNode(embedding))
+            continue;
+
+        auto embeddingNode = dynamic_cast<MKLDNNEmbeddingBagSumNode*>(embedding.get());
+        if (embeddingNode == nullptr)
+            IE_THROW() << "Cannot get embedding node " << embedding->getName();
+
+        auto multiply = embedding->getParentEdgesAtPort(0)[0]->getParent();
+        std::vector<float> rowScales;
+        int convertPort = 0;
+        for (; convertPort < 2; convertPort++) {
+            if (getRowScales(multiply, convertPort, rowScales))
+                break;
+        }
+        if (convertPort == 2)
+            continue;
+
+        auto convert = multiply->getParentEdgesAtPort(convertPort)[0]->getParent();
+        const auto tablePrecision = convert->getOriginalInputPrecisionAtPort(0);
+
+        auto scalesEdge = multiply->getParentEdgesAtPort(1 - convertPort)[0];
+        graph.RemoveEdge(scalesEdge);
+        graph.DropNode(multiply);
+        graph.DropNode(convert);
+
+        embeddingNode->setRowScales(std::move(rowScales));
+        embedding->setOriginalInputPrecisionAtPort(0, tablePrecision);
+    }
+}
+
 static bool BF16QuantizeNodeFusing(MKLDNNNodePtr parentNode, MKLDNNNodePtr childNode) {
     return childNode->getType() == FakeQuantize &&
         one_of(Precision::BF16,
@@ -1257,6 +1350,44 @@ void MKLDNNGraphOptimizer::FuseNormalizeL2AndSimpleOperation(MKLDNNGraph &graph)
     }
 }
 
+void MKLDNNGraphOptimizer::FuseMatMulAndSimpleOperation(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isSutableParentNode = [](MKLDNNNodePtr node) {
+        return node->getType() == MatMul && node->getChildEdges().size() == 1;
+    };
+
+    auto parent = graphNodes.begin();
+    while (parent != graphNodes.end()) {
+        auto parentNode = *parent;
+        if (!isSutableParentNode(parentNode)) {
+            parent++;
+            continue;
+        }
+
+        auto childNode = parentNode->getChildEdgeAt(0)->getChild();
+        if (!parentNode->canFuse(childNode)) {
+            parent++;
+            continue;
+        }
+
+        childNode->fuseInto(parentNode);
+
+        if (childNode->getType() == FakeQuantize || childNode->getType() == Eltwise) {
+            auto parentEdges = childNode->parentEdges;
+            for (auto &parentEdge : parentEdges) {
+                auto p_edge = parentEdge.lock();
+                if (p_edge->getParent()->getType() == MatMul)
+                    continue;
+
+                graph.RemoveEdge(p_edge);
+            }
+        }
+
+        graph.DropNode(childNode);
+    }
+}
+
 void MKLDNNGraphOptimizer::FuseEltwiseAndSimple(MKLDNNGraph &graph) {
     auto& graphNodes = graph.GetNodes();
 
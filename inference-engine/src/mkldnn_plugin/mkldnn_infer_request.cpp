@@ -73,93 +73,156 @@ MKLDNNPlugin::MKLDNNInferRequest::~MKLDNNInferRequest() {
     --(execNetwork->_numRequests);
 }
 
-void MKLDNNPlugin::MKLDNNInferRequest::pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob, InferenceEngine::Precision inPrec) {
+InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::prepareInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob) {
+    if (!_networkInputs[inputName]) {
+        IE_THROW() << "Input blobs map contains not registered during IInferencePlugin::LoadNetwork blob with name " << inputName;
+    }
+    auto inPrec = inputBlob->getTensorDesc().getPrecision();
+    if (graph->hasMeanImageFor(inputName) && one_of(inPrec, InferenceEngine::Precision::U8, InferenceEngine::Precision::BOOL)) {
+        inPrec = InferenceEngine::Precision::FP32;
+    } else {
+        inPrec = normalizeToSupportedPrecision(inPrec);
+    }
+
+    if (inPrec == InferenceEngine::Precision::UNSPECIFIED) {
+        IE_THROW() << "Unsupported input precision " << inputBlob->getTensorDesc().getPrecision();
+    }
+
+    // User can initialize input via setBlob API using tensorDesc with default (ANY) layout.
+    // Currently IE doesn't specify behavior in such scenario, so we assume real layout is equal to the network input.
+    if (inputBlob->getTensorDesc().getLayout() == InferenceEngine::ANY) {
+        inputBlob->getTensorDesc().setLayout(_networkInputs[inputName]->getLayout());
+    }
+
     bool needConvert = inPrec != inputBlob->getTensorDesc().getPrecision();
 
     if (inputBlob->cbuffer().as<const void *>() == nullptr) {
         IE_THROW() << "Input blob has no allocated memory";
     }
 
-    InferenceEngine::Blob::Ptr iconv;
-    if (needConvert) {
-        iconv = make_blob_with_precision(inPrec, InferenceEngine::TensorDesc(inPrec, inputBlob->getTensorDesc().getDims(),
-                                         inputBlob->getTensorDesc().getLayout()));
-        iconv->allocate();
-        if (inputBlob->size() != iconv->size())
-            IE_THROW() << "Can't copy tensor: input and converted tensors have different number of elements: " << inputBlob->size() << " and "
-                               << iconv->size();
-
-        void *srcData = inputBlob->cbuffer().as<void *>();
-        void *dstData = iconv->buffer().as<void *>();
-        if (dstData == nullptr) {
-            IE_THROW() << "Converted input blob has no allocated memory";
-        }
-        cpu_convert(srcData, dstData, inputBlob->getTensorDesc().getPrecision(), iconv->getTensorDesc().getPrecision(), iconv->size());
-    }
+    if (!needConvert)
+        return inputBlob;
 
-    graph->PushInputData(inputName, needConvert ? iconv : inputBlob);
+    auto iconv = make_blob_with_precision(inPrec, InferenceEngine::TensorDesc(inPrec, inputBlob->getTensorDesc().getDims(),
+                                          inputBlob->getTensorDesc().getLayout()));
+    iconv->allocate();
+    if (inputBlob->size() != iconv->size())
+        IE_THROW() << "Can't copy tensor: input and converted tensors have different number of elements: " << inputBlob->size() << " and "
+                           << iconv->size();
+
+    void *srcData = inputBlob->cbuffer().as<void *>();
+    void *dstData = iconv->buffer().as<void *>();
+    if (dstData == nullptr) {
+        IE_THROW() << "Converted input blob has no allocated memory";
+    }
+    cpu_convert(srcData, dstData, inputBlob->getTensorDesc().getPrecision(), iconv->getTensorDesc().getPrecision(), iconv->size());
+    return iconv;
 }
 
 void MKLDNNPlugin::MKLDNNInferRequest::PushInputData() {
     for (auto input : _inputs) {
-        if (!_networkInputs[input.first]) {
-            IE_THROW() << "Input blobs map contains not registered during IInferencePlugin::LoadNetwork blob with name " << input.first;
-        }
-        auto inPrec = input.second->getTensorDesc().getPrecision();
-        if (graph->hasMeanImageFor(input.first) && one_of(inPrec, InferenceEngine::Precision::U8, InferenceEngine::Precision::BOOL)) {
-            inPrec = InferenceEngine::Precision::FP32;
-        } else {
-            inPrec = normalizeToSupportedPrecision(inPrec);
-        }
+        graph->PushInputData(input.first, prepareInput(input.first, input.second));
+    }
+}
+
+static inline void changeEdgePtr(const MKLDNNPlugin::MKLDNNEdgePtr &edge, void *newPtr) {
+    edge->getMemory().GetPrimitivePtr()->set_data_handle(newPtr);
+}
 
-        if (inPrec == InferenceEngine::Precision::UNSPECIFIED) {
-            IE_THROW() << "Unsupported input precision " << input.second->getTensorDesc().getPrecision();
+// Child edges of the node can use external memory if their memory isn't shared with other primitives
+static bool canChangeChildEdgesPtr(const MKLDNNPlugin::MKLDNNNodePtr &node) {
+    for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+        auto& child = node->getChildEdgeAt(i)->getChild();
+        if (child->isConstant())
+            return false;
+        auto* concat = dynamic_cast<MKLDNNConcatNode *>(child.get());
+        if (concat && concat->isOptimized())
+            return false;
+
+        // Cannot be in-place before split because split is using different ptrs without offsets
+        auto* split = dynamic_cast<MKLDNNSplitNode *>(child.get());
+        if (split)
+            return false;
+
+        if (child->isInplace())
+            return false;
+        for (size_t j = 0; j < child->getChildEdges().size(); j++) {
+            if (child->getChildEdgeAt(j)->getMemory().GetPrimitive().get_data_handle() ==
+                    node->getChildEdgeAt(i)->getMemory().GetPrimitive().get_data_handle())
+                return false;
         }
+    }
+    return true;
+}
 
-        // User can initialize input via setBlob API using tensorDesc with default (ANY) layout.
-        // Currently IE doesn't specify behavior in such scenario, so we assume real layout is equal to the network input.
-        if (input.second->getTensorDesc().getLayout() == InferenceEngine::ANY) {
-            input.second->getTensorDesc().setLayout(_networkInputs[input.first]->getLayout());
+// Parent edge of the node can use external memory if its producers don't share the memory with other primitives
+static bool canChangeParentEdgePtr(const MKLDNNPlugin::MKLDNNNodePtr &node) {
+    void * defaultPtr = node->getParentEdgeAt(0)->getMemory().GetPrimitivePtr()->get_data_handle();
+    // Cannot be in-place after concat because concat is using different ptrs without offsets
+    auto parent = node->getParentEdgeAt(0)->getParent();
+    MKLDNNPlugin::MKLDNNNodePtr previousParent;
+    do {
+        previousParent = parent;
+        if (parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInplace())
+            return false;
+
+        for (size_t i = 0; i < parent->getParentEdges().size(); i++) {
+            if (parent->getParentEdgeAt(i)->getMemory().GetPrimitivePtr()->get_data_handle() == defaultPtr) {
+                parent = parent->getParentEdgeAt(i)->getParent();
+                break;
+            }
         }
+    } while (previousParent != parent);
+    return true;
+}
 
-        pushInput(input.first, input.second, inPrec);
+MKLDNNPlugin::MKLDNNVariableState* MKLDNNPlugin::MKLDNNInferRequest::findState(const std::string& id) const {
+    for (const auto& state : memoryStates) {
+        if (state->GetName() == id)
+            return dynamic_cast<MKLDNNVariableState*>(state.get());
     }
+    return nullptr;
 }
 
 void MKLDNNPlugin::MKLDNNInferRequest::PushStates() {
     for (auto &node : graph->GetNodes()) {
         if (node->getType() == MemoryInput) {
             auto cur_node = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
-            auto cur_id = cur_node->getId();
-            for (const auto& state : memoryStates) {
-                if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(cur_state_mem_buf, data_ptr, data_size);
-                }
+            auto state = findState(cur_node->getId());
+            if (!state)
+                continue;
+
+            void* current = state->currentData();
+            cur_node->bindState(current, state->nextData());
+            // ReadValue output is read from the state directly
+            if (node->getChildEdgeAt(0)->getMemory().GetData() != current && canChangeChildEdgesPtr(node)) {
+                for (size_t i = 0; i < node->getChildEdges().size(); i++)
+                    changeEdgePtr(node->getChildEdgeAt(i), current);
             }
+        } else if (node->getType() == MemoryOutput) {
+            auto cur_node = dynamic_cast<MKLDNNMemoryOutputNode*>(node.get());
+            auto state = findState(cur_node->getId());
+            if (!state)
+                continue;
+
+            // Producer of the Assign input writes the next state directly
+            void* next = state->nextData();
+            auto parentEdge = node->getParentEdgeAt(0);
+            if (parentEdge->getMemory().GetData() != next && parentEdge->getDesc() == state->getTensorDesc() &&
+                !one_of(parentEdge->getParent()->getType(), Input, MemoryInput) && canChangeParentEdgePtr(node))
+                changeEdgePtr(parentEdge, next);
         }
     }
 }
 
 void MKLDNNPlugin::MKLDNNInferRequest::PullStates() {
+    // The next state buffer written by Assign becomes the current one, ReadValue only states keep their buffers
     for (auto &node : graph->GetNodes()) {
-        if (node->getType() == MemoryInput) {
-            auto cur_node = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
-            auto cur_id = cur_node->getId();
-            for (const auto& state : memoryStates) {
-                if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(data_ptr, cur_state_mem_buf, data_size);
-                }
-            }
+        if (node->getType() == MemoryOutput) {
+            auto cur_node = dynamic_cast<MKLDNNMemoryOutputNode*>(node.get());
+            auto state = findState(cur_node->getId());
+            if (state)
+                state->swapBuffers();
         }
     }
 }
@@ -196,11 +259,43 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
     graph->PullOutputData(_outputs);
 }
 
+void MKLDNNPlugin::MKLDNNInferRequest::PrepareBatchInputData() {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, profilingTask);
+    ThrowIfCanceled();
+
+    execDataPreprocessing(_inputs);
+
+    // Inputs are validated and converted here, so a wrong input fails only this request and not the whole batch
+    _batchInputs.clear();
+    for (auto input : _inputs) {
+        auto blob = prepareInput(input.first, input.second);
+        const auto elementSize = InferenceEngine::details::product(_networkInputs[input.first]->getTensorDesc().getDims());
+        if (blob->size() != elementSize)
+            IE_THROW() << "Input blob number of elements is not equal network input number of elements ("
+                       << blob->size() << "!=" << elementSize << ").";
+        _batchInputs[input.first] = blob;
+    }
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::PushBatchInputData(MKLDNNGraph& batchGraph, size_t batchIdx) {
+    for (const auto& input : _batchInputs) {
+        batchGraph.PushInputData(input.first, input.second, batchIdx);
+    }
+    _batchInputs.clear();
+    lastBatchGraph = &batchGraph;
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::PullBatchOutputData(MKLDNNGraph& batchGraph, size_t batchIdx) {
+    batchGraph.PullOutputData(_outputs, batchIdx);
+}
+
 std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> MKLDNNPlugin::MKLDNNInferRequest::GetPerformanceCounts() const {
-    if (!graph || !graph->IsReady())
+    // Asynchronous requests of the automatic batching are inferred by the batched graph
+    auto perfGraph = lastBatchGraph != nullptr ? lastBatchGraph : graph;
+    if (!perfGraph || !perfGraph->IsReady())
         IE_THROW() << "Graph is not ready!";
     std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> perfMap;
-    graph->GetPerfData(perfMap);
+    perfGraph->GetPerfData(perfMap);
     return perfMap;
 }
 
@@ -419,10 +514,6 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
     }
 }
 
-static inline void changeEdgePtr(const MKLDNNPlugin::MKLDNNEdgePtr &edge, void *newPtr) {
-    edge->getMemory().GetPrimitivePtr()->set_data_handle(newPtr);
-}
-
 void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr() {
     for (auto& it : externalPtr) {
         auto input = graph->inputNodesMap.find(it.first);
@@ -430,30 +521,9 @@ void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr() {
             if (input->second->getChildEdgeAt(0)->getMemory().GetPrimitive().get_data_handle() == it.second)
                 continue;
             // Input cannot be in-place with other primitives
-            bool canBeInPlace = true;
-            for (size_t i = 0; canBeInPlace && i < input->second->getChildEdges().size(); i++) {
-                auto& child = input->second->getChildEdgeAt(i)->getChild();
-                if (child->isConstant())
-                    canBeInPlace = false;
-                auto* concat = dynamic_cast<MKLDNNConcatNode *>(child.get());
-                if (canBeInPlace && concat && concat->isOptimized())
-                    canBeInPlace = false;
-
-                // Cannot be in-place before split because split is using different ptrs without offsets
-                auto* split = dynamic_cast<MKLDNNSplitNode *>(child.get());
-                if (canBeInPlace && split)
-                    canBeInPlace = false;
-
-                if (child->isInplace())
-                    canBeInPlace = false;
-                for (size_t j = 0; canBeInPlace && j < child->getChildEdges().size(); j++) {
-                    if (child->getChildEdgeAt(j)->getMemory().GetPrimitive().get_data_handle() ==
-                            input->second->getChildEdgeAt(i)->getMemory().GetPrimitive().get_data_handle())
-                        canBeInPlace = false;
-                }
-            }
-            for (size_t i = 0; canBeInPlace && i < input->second->getChildEdges().size(); i++) {
-                changeEdgePtr(input->second->getChildEdgeAt(i), it.second);
+            if (canChangeChildEdgesPtr(input->second)) {
+                for (size_t i = 0; i < input->second->getChildEdges().size(); i++)
+                    changeEdgePtr(input->second->getChildEdgeAt(i), it.second);
             }
             continue;
         }
@@ -468,26 +538,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr() {
         if (output) {
             if (output->getParentEdgeAt(0)->getMemory().GetPrimitive().get_data_handle() == it.second)
                 continue;
-            bool canBeInPlace = true;
-            void * defaultPtr = output->getParentEdgeAt(0)->getMemory().GetPrimitivePtr()->get_data_handle();
-            // Cannot be in-place after concat because concat is using different ptrs without offsets
-            auto parent = output->getParentEdgeAt(0)->getParent();
-            MKLDNNNodePtr previousParent;
-            do {
-                previousParent = parent;
-                if (parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInplace()) {
-                    canBeInPlace = false;
-                    break;
-                }
-
-                for (size_t i = 0; i < parent->getParentEdges().size(); i++) {
-                    if (parent->getParentEdgeAt(i)->getMemory().GetPrimitivePtr()->get_data_handle() == defaultPtr) {
-                        parent = parent->getParentEdgeAt(i)->getParent();
-                        break;
-                    }
-                }
-            } while (previousParent != parent);
-            if (canBeInPlace)
+            if (canChangeParentEdgePtr(output))
                 changeEdgePtr(output->getParentEdgeAt(0), it.second);
             continue;
         }
@@ -14,6 +14,7 @@ namespace MKLDNNPlugin {
 
 class MKLDNNExecNetwork;
 class MKLDNNAsyncInferRequest;
+class MKLDNNVariableState;
 
 class MKLDNNInferRequest : public InferenceEngine::IInferRequestInternal {
 public:
@@ -47,12 +48,32 @@ public:
      */
     void ThrowIfCanceled() const;
 
+    /**
+     * @brief Preprocesses and validates inputs of the request before it is added to a batch
+     */
+    void PrepareBatchInputData();
+
+    /**
+     * @brief Copies inputs prepared by PrepareBatchInputData() to the element of the batched graph inputs
+     * @param[in]  batchGraph Graph compiled for the batch of requests
+     * @param[in]  batchIdx Index of the request in the batch
+     */
+    void PushBatchInputData(MKLDNNGraph& batchGraph, size_t batchIdx);
+
+    /**
+     * @brief Copies the element of the batched graph outputs to outputs of the request
+     * @param[in]  batchGraph Graph compiled for the batch of requests
+     * @param[in]  batchIdx Index of the request in the batch
+     */
+    void PullBatchOutputData(MKLDNNGraph& batchGraph, size_t batchIdx);
+
 private:
     void PushInputData();
     void PushStates();
     void PullStates();
+    MKLDNNVariableState* findState(const std::string& id) const;
 
-    void pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob, InferenceEngine::Precision dataType);
+    InferenceEngine::Blob::Ptr prepareInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob);
 
     void changeDefaultPtr();
     std::shared_ptr<MKLDNNExecNetwork>  execNetwork;
@@ -61,5 +82,7 @@ private:
     openvino::itt::handle_t             profilingTask;
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> memoryStates;
     MKLDNNAsyncInferRequest*            _asyncRequest = nullptr;
+    InferenceEngine::BlobMap            _batchInputs;
+    MKLDNNGraph*                        lastBatchGraph = nullptr;
 };
 }  // namespace MKLDNNPlugin
@@ -11,7 +11,20 @@ using namespace InferenceEngine;
 namespace MKLDNNPlugin {
 
 void  MKLDNNVariableState::Reset() {
-    std::memset(state->buffer(), 0, state->byteSize());
+    std::memset(currentState->buffer(), 0, currentState->byteSize());
+}
+
+void MKLDNNVariableState::SetState(const Blob::Ptr& newState) {
+    // the blob of the user isn't kept, it would be overwritten as the next state buffer
+    if (newState->byteSize() != currentState->byteSize())
+        IE_THROW() << "Cannot set state " << name << ": expected " << currentState->byteSize() << " bytes, got " << newState->byteSize();
+    cpu_memcpy(currentState->buffer().as<void*>(), newState->cbuffer().as<const void*>(), currentState->byteSize());
+}
+
+Blob::CPtr MKLDNNVariableState::GetState() const {
+    // the buffers are exchanged after every inference, the returned blob must keep the value
+    cpu_memcpy(state->buffer().as<void*>(), currentState->cbuffer().as<const void*>(), state->byteSize());
+    return state;
 }
 
 }  // namespace MKLDNNPlugin
@@ -10,19 +10,51 @@
 #include "nodes/common/cpu_memcpy.h"
 
 #include <string>
+#include <utility>
 
 namespace MKLDNNPlugin {
 
+/**
+ * The state has two buffers: ReadValue reads the current one and Assign writes the next one during inference.
+ * The buffers are exchanged when inference is finished, so the state isn't copied between inferences.
+ * The blob returned by GetState is not one of the buffers, the current value is copied into it on every GetState call.
+ */
 class MKLDNNVariableState : public InferenceEngine::IVariableStateInternal {
 public:
     MKLDNNVariableState(std::string name, MKLDNNMemoryPtr storage) :
             InferenceEngine::IVariableStateInternal{name} {
-        state = make_blob_with_precision(MKLDNNMemoryDesc(storage->GetDescriptor()));
+        currentState = make_blob_with_precision(MKLDNNMemoryDesc(storage->GetDescriptor()));
+        currentState->allocate();
+        cpu_memcpy(currentState->buffer(), storage->GetData(), storage->GetSize());
+        nextState = make_blob_with_precision(currentState->getTensorDesc());
+        nextState->allocate();
+        state = make_blob_with_precision(currentState->getTensorDesc());
         state->allocate();
-        cpu_memcpy(state->buffer(), storage->GetData(), storage->GetSize());
     }
 
     void Reset() override;
+    void SetState(const InferenceEngine::Blob::Ptr& newState) override;
+    InferenceEngine::Blob::CPtr GetState() const override;
+
+    const InferenceEngine::TensorDesc& getTensorDesc() const {
+        return currentState->getTensorDesc();
+    }
+
+    void* currentData() {
+        return currentState->buffer().as<void*>();
+    }
+
+    void* nextData() {
+        return nextState->buffer().as<void*>();
+    }
+
+    void swapBuffers() {
+        std::swap(currentState, nextState);
+    }
+
+private:
+    InferenceEngine::Blob::Ptr currentState;
+    InferenceEngine::Blob::Ptr nextState;
 };
 
 }  // namespace MKLDNNPlugin
\ No newline at end of file
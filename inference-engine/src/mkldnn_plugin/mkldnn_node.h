@@ -20,6 +20,7 @@
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn_primitive.h"
 #include "mkldnn_weights_cache.hpp"
+#include "mkldnn_primitives_cache.hpp"
 #include "mkldnn.hpp"
 #include <openvino/itt.hpp>
 #include "utils/ngraph_utils.hpp"
@@ -192,6 +193,10 @@ static std::string NameFromType(Type type) {
             return "ExtractImagePatches";
         case NonMaxSuppression:
             return "NonMaxSuppression";
+        case Subgraph:
+            return "Subgraph";
+        case ScaledDotProductAttention:
+            return "ScaledDotProductAttention";
         default:
             return "Unknown";
     }
@@ -696,6 +701,7 @@ protected:
 
     InferenceEngine::Blob::Ptr ext_scales;
     MKLDNNWeightsSharing::Ptr weightCache;
+    MKLDNNPrimitivesCache::Ptr primitivesCache;
 
     Algorithm algorithm = Algorithm::Undefined;
 
@@ -706,6 +712,20 @@ protected:
     friend class MKLDNNGraphOptimizer;
     friend class NodeDumper;
 
+    /**
+     * @brief Creates the primitive from the primitive descriptor or takes the one already created for the same node
+     * by the graph of another stream
+     */
+    template <typename PRIMITIVE, typename PRIMITIVE_DESC>
+    MKLDNNPrimitivesCache::PrimitivePtr getOrCreatePrimitive(const PRIMITIVE_DESC& desc) {
+        auto create = [&desc]() -> MKLDNNPrimitivesCache::PrimitivePtr {
+            return std::make_shared<PRIMITIVE>(desc);
+        };
+        if (!primitivesCache)
+            return create();
+        return primitivesCache->findOrCreate(MKLDNNPrimitivesCache::getKey(getName(), desc), create);
+    }
+
     bool isUninitTensorDesc(const InferenceEngine::TensorDesc& desc) const;
     bool isInitConfig(const InferenceEngine::LayerConfig& config) const;
     void selectPreferPrimitiveDescriptor(const std::vector<impl_desc_type>& priority, bool ignoreConstInputs);
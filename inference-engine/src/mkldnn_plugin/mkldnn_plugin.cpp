@@ -7,6 +7,7 @@
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn_weights_cache.hpp"
 #include "mkldnn_itt.h"
+#include "utils/serialize.hpp"
 
 #include <threading/ie_executor_manager.hpp>
 #include <memory>
@@ -88,6 +89,11 @@
 #include "nodes/mkldnn_mvn_node.h"
 #include "nodes/mkldnn_fake_quantize_node.h"
 #include "ngraph_transformations/convert_to_cpu_specific_opset.hpp"
+#include "utils/performance_heuristics.hpp"
+#include "ngraph_transformations/embedding_table_dequantization.hpp"
+#include "ngraph_transformations/op/fully_connected.hpp"
+
+#include <snippets/pass/collapse_subgraph.hpp>
 
 #if !defined(__arm__) && !defined(_M_ARM) && !defined(__aarch64__) && !defined(_M_ARM64)
 # ifdef _WIN32
@@ -112,11 +118,94 @@ Engine::~Engine() {
     ExecutorManager::getInstance()->clear("CPUCallbackExecutor");
 }
 
+// Elementwise operations which MKLDNNGraphOptimizer fuses into other nodes: post ops of the nodes with fusing rules,
+// including chains of them, and scale shifts or clamps preceding FakeQuantize. They are left out of snippets,
+// since the fused node doesn't spend a separate pass over memory on them.
+// This is an approximation of the optimizer rules written over the nGraph function, so snippets are enabled only
+// by the SNIPPETS_MODE key until the fusing rules are shared with MKLDNNGraphOptimizer
+static std::unordered_set<const ngraph::Node*> GetNodesFusedByGraphOptimizer(const std::shared_ptr<ngraph::Function>& nGraphFunc) {
+    auto hasPostOps = [](const ngraph::Node* node) {
+        return ngraph::is_type<ngraph::opset1::Convolution>(node) ||
+               ngraph::is_type<ngraph::opset1::GroupConvolution>(node) ||
+               ngraph::is_type<ngraph::opset1::ConvolutionBackpropData>(node) ||
+               ngraph::is_type<ngraph::opset1::GroupConvolutionBackpropData>(node) ||
+               ngraph::is_type<ngraph::opset1::BinaryConvolution>(node) ||
+               ngraph::is_type<ngraph::opset1::MatMul>(node) ||
+               ngraph::is_type<MKLDNNPlugin::FullyConnectedNode>(node) ||
+               ngraph::is_type<ngraph::op::v0::MVN>(node) ||
+               ngraph::is_type<ngraph::opset6::MVN>(node) ||
+               ngraph::is_type<ngraph::opset1::Interpolate>(node) ||
+               ngraph::is_type<ngraph::opset4::Interpolate>(node) ||
+               ngraph::is_type<ngraph::opset1::NormalizeL2>(node);
+    };
+    auto hasSingleConsumer = [](const ngraph::Output<ngraph::Node>& output) {
+        return output.get_node()->get_output_size() == 1 && output.get_target_inputs().size() == 1;
+    };
+    auto otherInputsAreConstants = [](const ngraph::Node* node, size_t port) {
+        for (size_t i = 0; i < node->get_input_size(); i++) {
+            if (i != port && !ngraph::is_type<ngraph::opset1::Constant>(node->get_input_node_ptr(i)))
+                return false;
+        }
+        return true;
+    };
+
+    std::unordered_set<const ngraph::Node*> fused;
+    // nodes which the following elementwise operation is fused into
+    std::unordered_set<const ngraph::Node*> fusingParents;
+    for (const auto& node : nGraphFunc->get_ordered_ops()) {
+        if (hasPostOps(node.get())) {
+            fusingParents.insert(node.get());
+            continue;
+        }
+        // Activations after MaxPool are fused into the convolution before it
+        if (ngraph::is_type<ngraph::opset1::MaxPool>(node) && hasSingleConsumer(node->input_value(0)) &&
+            hasPostOps(node->get_input_node_ptr(0))) {
+            fusingParents.insert(node.get());
+            continue;
+        }
+        for (size_t i = 0; i < node->get_input_size(); i++) {
+            const auto input = node->input_value(i);
+            const auto producer = input.get_node();
+            if (fusingParents.count(producer) == 0 || !hasSingleConsumer(input))
+                continue;
+            // Convolutions also fuse a sum with another tensor, the next post ops take only constants
+            if (hasPostOps(producer) || otherInputsAreConstants(node.get(), i)) {
+                fused.insert(node.get());
+                fusingParents.insert(node.get());
+                break;
+            }
+        }
+    }
+
+    for (const auto& node : nGraphFunc->get_ops()) {
+        if (!ngraph::is_type<ngraph::opset1::FakeQuantize>(node))
+            continue;
+        // Multiply and Add before FakeQuantize are merged into one scale shift and fused into it
+        auto input = node->input_value(0);
+        for (size_t depth = 0; depth < 2 && hasSingleConsumer(input); depth++) {
+            const auto producer = input.get_node();
+            if (!(ngraph::is_type<ngraph::opset1::Multiply>(producer) || ngraph::is_type<ngraph::opset1::Add>(producer) ||
+                  ngraph::is_type<ngraph::opset1::Subtract>(producer) || ngraph::is_type<ngraph::opset1::Divide>(producer) ||
+                  ngraph::is_type<ngraph::opset1::Clamp>(producer)))
+                break;
+            size_t dataPort = 0;
+            if (producer->get_input_size() == 2 && ngraph::is_type<ngraph::opset1::Constant>(producer->get_input_node_ptr(0)))
+                dataPort = 1;
+            if (!otherInputsAreConstants(producer, dataPort))
+                break;
+            fused.insert(producer);
+            input = producer->input_value(dataPort);
+        }
+    }
+    return fused;
+}
+
 static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
     auto nGraphFunc = clonedNetwork.getFunction();
 
     ngraph::pass::Manager manager;
     manager.register_pass<ngraph::pass::InitNodeInfo>();
+    manager.register_pass<MKLDNNPlugin::KeepEmbeddingTableDequantization>();
 
     const bool useLpt =
         (conf.lpTransformsMode == Config::LPTransformsMode::On) &&
@@ -380,6 +469,31 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
     postLPTPassManager.run_passes(nGraphFunc);
 
     ConvertToCPUSpecificOpset(nGraphFunc);
+
+    if (conf.enableSnippets && with_cpu_x86_avx2()) {
+        ngraph::pass::Manager snippetsManager;
+        snippetsManager.register_pass<ngraph::snippets::pass::TokenizeSnippets>();
+
+        const auto fusedNodes = std::make_shared<std::unordered_set<const ngraph::Node*>>(GetNodesFusedByGraphOptimizer(nGraphFunc));
+        auto isFusedByGraphOptimizer = [fusedNodes](const_node_ptr &node) -> bool {
+            return fusedNodes->count(node.get()) != 0;
+        };
+        snippetsManager.get_pass_config()->set_callback<ngraph::snippets::pass::StartSubgraph>(isFusedByGraphOptimizer);
+        snippetsManager.get_pass_config()->set_callback<ngraph::snippets::pass::AttachToSubgraph>(isFusedByGraphOptimizer);
+
+        snippetsManager.run_passes(nGraphFunc);
+    }
+}
+
+// Automatic batching infers requests with the copy of the network reshaped to the maximum batch
+static CNNNetwork CreateBatchNetwork(const CNNNetwork& network, const Config& conf) {
+    if (network.getBatchSize() != 1)
+        IE_THROW() << "Automatic batching requires a network with batch 1, but the network batch is " << network.getBatchSize();
+
+    CNNNetwork batchNetwork = InferenceEngine::details::cloneNetwork(network);
+    batchNetwork.setBatchSize(static_cast<size_t>(conf.autoBatchSize));
+    Transformation(batchNetwork, conf);
+    return batchNetwork;
 }
 
 InferenceEngine::IExecutableNetworkInternal::Ptr
@@ -415,11 +529,56 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
         conf.batchLimit = static_cast<int>(network.getBatchSize());
     }
 
+    ApplyPerformanceHints(conf, network.getFunction());
+
+    CNNNetwork batchNetwork;
+    if (conf.autoBatchSize > 1) {
+        if (conf.enableDynamicBatch)
+            IE_THROW() << "Automatic batching cannot be used with dynamic batch";
+        batchNetwork = CreateBatchNetwork(network, conf);
+    }
+
     CNNNetwork clonedNetwork = InferenceEngine::details::cloneNetwork(network);
 
     Transformation(clonedNetwork, conf);
 
-    return std::make_shared<MKLDNNExecNetwork>(clonedNetwork, conf, extensionManager, weightsSharing);
+    return std::make_shared<MKLDNNExecNetwork>(clonedNetwork, conf, extensionManager, weightsSharing, batchNetwork);
+}
+
+std::shared_ptr<InferenceEngine::IExecutableNetworkInternal>
+Engine::ImportNetwork(std::istream& networkModel, const std::map<std::string, std::string>& config) {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "Engine::ImportNetwork");
+
+    CNNNetwork cnnnetwork;
+    CNNNetworkDeserializer deserializer(networkModel, extensionManager->getOpSets());
+    deserializer >> cnnnetwork;
+
+    Config conf = engConfig;
+    conf.readProperties(config);
+
+    if (conf.enableDynamicBatch) {
+        conf.batchLimit = static_cast<int>(cnnnetwork.getBatchSize());
+    }
+
+    ApplyPerformanceHints(conf, cnnnetwork.getFunction());
+
+    // The exported network is already transformed, so it can't be reshaped to the batch
+    if (conf.autoBatchSize > 1) {
+        IE_THROW(NotImplemented) << "Automatic batching is not supported for imported networks";
+    }
+
+    // The imported network has already passed through the transformation pipeline on export, while the graphs
+    // are built from scratch (InitDescriptors, fusing, primitive creation), since the compiled graph isn't exported
+    auto execNetwork = std::make_shared<MKLDNNExecNetwork>(cnnnetwork, conf, extensionManager, weightsSharing);
+    ConstInputsDataMap inputs;
+    for (const auto& input : cnnnetwork.getInputsInfo())
+        inputs.emplace(input.first, input.second);
+    ConstOutputsDataMap outputs;
+    for (const auto& output : cnnnetwork.getOutputsInfo())
+        outputs.emplace(output.first, output.second);
+    SetExeNetworkInfo(execNetwork, inputs, outputs);
+
+    return execNetwork;
 }
 
 void Engine::SetConfig(const std::map<std::string, std::string> &config) {
@@ -462,6 +621,7 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(RANGE_FOR_ASYNC_INFER_REQUESTS));
         metrics.push_back(METRIC_KEY(RANGE_FOR_STREAMS));
+        metrics.push_back(METRIC_KEY(IMPORT_EXPORT_SUPPORT));
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(FULL_DEVICE_NAME)) {
         std::string brand_string;
@@ -508,6 +668,8 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
     } else if (name == METRIC_KEY(RANGE_FOR_STREAMS)) {
         std::tuple<unsigned int, unsigned int> range = std::make_tuple(1, parallel_get_max_threads());
         IE_SET_METRIC_RETURN(RANGE_FOR_STREAMS, range);
+    } else if (name == METRIC_KEY(IMPORT_EXPORT_SUPPORT)) {
+        IE_SET_METRIC_RETURN(IMPORT_EXPORT_SUPPORT, true);
     } else {
         IE_THROW() << "Unsupported metric key " << name;
     }
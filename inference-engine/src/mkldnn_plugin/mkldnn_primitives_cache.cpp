@@ -0,0 +1,101 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_primitives_cache.hpp"
+#include "mkldnn_weights_cache.hpp"
+
+#include <common/primitive_attr.hpp>
+
+#include <sstream>
+
+namespace MKLDNNPlugin {
+
+MKLDNNPrimitivesCache::PrimitivePtr MKLDNNPrimitivesCache::findOrCreate(const std::string& key,
+                                                                        std::function<PrimitivePtr(void)> create) {
+    PrimitiveInfo::Ptr info;
+    {
+        std::lock_guard<std::mutex> lock(guard);
+        auto& found = primitives[key];
+        if (!found)
+            found = std::make_shared<PrimitiveInfo>();
+        info = found;
+    }
+
+    // Only the same primitive is created under the entry lock, so different primitives are created in parallel
+    std::lock_guard<std::mutex> lock(info->guard);
+    if (!info->primitive)
+        info->primitive = create();
+    return info->primitive;
+}
+
+std::string MKLDNNPrimitivesCache::getKey(const std::string& nodeName, const mkldnn::primitive_desc_base& desc) {
+    const auto& hashFunc = MKLDNNWeightsSharing::GetHashFunc();
+    auto hashMemoryDesc = [&](const mkldnn::memory::desc& md) {
+        return hashFunc.hash(reinterpret_cast<const unsigned char*>(&md.data), sizeof(md.data));
+    };
+
+    std::ostringstream key;
+    key << nodeName << "_" << desc.impl_info_str();
+    for (int i = 0; desc.src_desc(i).data.ndims != 0; i++)
+        key << "_" << hashMemoryDesc(desc.src_desc(i));
+    for (int i = 0; desc.weights_desc(i).data.ndims != 0; i++)
+        key << "_" << hashMemoryDesc(desc.weights_desc(i));
+    for (int i = 0; desc.dst_desc(i).data.ndims != 0; i++)
+        key << "_" << hashMemoryDesc(desc.dst_desc(i));
+    for (int i = 0; desc.diff_src_desc(i).data.ndims != 0; i++)
+        key << "_" << hashMemoryDesc(desc.diff_src_desc(i));
+    for (int i = 0; desc.diff_dst_desc(i).data.ndims != 0; i++)
+        key << "_" << hashMemoryDesc(desc.diff_dst_desc(i));
+    key << "_" << getAttrKey(desc);
+    return key.str();
+}
+
+std::string MKLDNNPrimitivesCache::getAttrKey(const mkldnn::primitive_desc_base& desc) {
+    const auto& hashFunc = MKLDNNWeightsSharing::GetHashFunc();
+
+    const auto attrHolder = desc.get_primitive_attr();
+    const auto& attr = *attrHolder.get();
+    std::ostringstream key;
+    // Output scales are copied into the attributes, so they are compared by value
+    const auto& scales = attr.output_scales_;
+    key << scales.mask_ << "_"
+        << (scales.scales_ ? hashFunc.hash(reinterpret_cast<const unsigned char*>(scales.scales_),
+                                           scales.count_ * sizeof(float)) : 0);
+
+    // Depthwise, quantization and binarization post ops keep raw pointers to the buffers of the fused nodes and
+    // the primitive reads them on every execution. They are compared by address, so such a primitive is shared
+    // only by the graphs which really share these buffers: a stream must not depend on the buffers of another
+    // stream, which may be released earlier or allocated on another NUMA node.
+    auto address = [](const void* data) {
+        return data;
+    };
+    const auto& postOps = attr.post_ops_;
+    for (int i = 0; i < postOps.len(); i++) {
+        const auto& postOp = postOps.entry_[i];
+        key << "_" << postOp.kind;
+        if (postOp.is_eltwise()) {
+            const auto& eltwise = postOp.eltwise;
+            key << "_" << eltwise.alg << "_" << eltwise.alpha << "_" << eltwise.beta << "_" << eltwise.scale;
+        } else if (postOp.is_sum()) {
+            key << "_" << postOp.sum.scale;
+        } else if (postOp.is_depthwise()) {
+            const auto& depthwise = postOp.depthwise;
+            key << "_" << depthwise.alg
+                << "_" << address(depthwise.weights_data) << "_" << address(depthwise.biases_data);
+        } else if (postOp.is_quantization()) {
+            const auto& quantization = postOp.quantization;
+            key << "_" << quantization.alg
+                << "_" << address(quantization.crop_low_data) << "_" << address(quantization.crop_high_data)
+                << "_" << address(quantization.input_scale_data) << "_" << address(quantization.input_shift_data)
+                << "_" << address(quantization.output_scale_data) << "_" << address(quantization.output_shift_data);
+        } else if (postOp.is_binarization()) {
+            const auto& binarization = postOp.binarization;
+            key << "_" << binarization.alg
+                << "_" << address(binarization.weights_data) << "_" << address(binarization.output_mask_data);
+        }
+    }
+    return key.str();
+}
+
+}  // namespace MKLDNNPlugin
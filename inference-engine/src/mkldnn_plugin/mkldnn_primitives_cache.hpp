@@ -0,0 +1,61 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <mkldnn.hpp>
+
+#include <unordered_map>
+#include <functional>
+#include <string>
+#include <memory>
+#include <mutex>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Caching store of mkldnn primitives shared by the graphs of all the streams of an executable network
+ *
+ * All the per stream graphs are built from the same network with the same config, so a node gets the same
+ * primitive descriptor in each of them. The primitive (and its JIT code) is created by the first stream only,
+ * while other streams take it from the cache and allocate only their own memory. mkldnn is built with
+ * DNNL_ENABLE_CONCURRENT_EXEC, so a primitive may be executed by several streams simultaneously.
+ *
+ * Only the primitive creation is shared: every stream still builds its own graph from the network, i.e. creates
+ * the nodes, selects primitive descriptors, runs the graph optimizer and allocates memory.
+ *
+ * Is a thread safe
+ */
+class MKLDNNPrimitivesCache {
+public:
+    typedef std::shared_ptr<MKLDNNPrimitivesCache> Ptr;
+    typedef std::shared_ptr<mkldnn::primitive> PrimitivePtr;
+
+    PrimitivePtr findOrCreate(const std::string& key, std::function<PrimitivePtr(void)> create);
+
+    /**
+     * @brief Builds the cache key of a primitive created by a node from the node name, implementation type,
+     * memory descriptors and attributes of the primitive descriptor
+     */
+    static std::string getKey(const std::string& nodeName, const mkldnn::primitive_desc_base& desc);
+
+    /**
+     * @brief Builds the part of the cache key describing the primitive attributes: output scales and fused post ops.
+     * Post ops referring to external buffers are keyed by the buffer addresses
+     */
+    static std::string getAttrKey(const mkldnn::primitive_desc_base& desc);
+
+protected:
+    struct PrimitiveInfo {
+        typedef std::shared_ptr<PrimitiveInfo> Ptr;
+
+        std::mutex guard;
+        PrimitivePtr primitive;
+    };
+
+    std::mutex guard;
+    std::unordered_map<std::string, PrimitiveInfo::Ptr> primitives;
+};
+
+}  // namespace MKLDNNPlugin
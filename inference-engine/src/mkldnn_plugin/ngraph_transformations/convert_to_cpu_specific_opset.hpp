@@ -3,6 +3,7 @@
 //
 
 #include <ngraph/pass/constant_folding.hpp>
+#include "fuse_scaled_dot_product_attention.hpp"
 #include "convert_matmul_to_fc_or_gemm.hpp"
 #include "fc_bias_fusion.hpp"
 #include "reshape_fc_fusion.hpp"
@@ -27,6 +28,7 @@ inline void ConvertToCPUSpecificOpset(std::shared_ptr<ngraph::Function> &nGraphF
     manager.register_pass<Reshape1DMaxPool>();
     manager.register_pass<ConvertBroadcastToTiles>();
     manager.register_pass<ConvertTileToSeqTiles>();
+    manager.register_pass<FuseScaledDotProductAttention>();
     manager.register_pass<ConvertMatMulToFC>();
     manager.register_pass<ConvertMatMulToGemm>();
     manager.register_pass<FullyConnectedBiasFusion>();
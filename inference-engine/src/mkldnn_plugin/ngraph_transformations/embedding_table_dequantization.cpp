@@ -0,0 +1,64 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "embedding_table_dequantization.hpp"
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset3.hpp>
+#include <ngraph/variant.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::KeepEmbeddingTableDequantization, "KeepEmbeddingTableDequantization", 0);
+
+MKLDNNPlugin::KeepEmbeddingTableDequantization::KeepEmbeddingTableDequantization() {
+    auto table = ngraph::pattern::wrap_type<ngraph::opset1::Constant>(
+            ngraph::pattern::type_matches_any({ngraph::element::i8, ngraph::element::u8}));
+    auto convert = ngraph::pattern::wrap_type<ngraph::opset1::Convert>({table}, ngraph::pattern::consumers_count(1));
+    auto scales = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
+    auto multiply = ngraph::pattern::wrap_type<ngraph::opset1::Multiply>({convert, scales});
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+        const auto& pattern_map = m.get_pattern_value_map();
+        auto convertNode = pattern_map.at(convert).get_node_shared_ptr();
+        auto scalesNode = pattern_map.at(scales).get_node_shared_ptr();
+        auto multiplyNode = pattern_map.at(multiply).get_node_shared_ptr();
+        if (convertNode->get_output_element_type(0) != ngraph::element::f32 ||
+            scalesNode->get_output_element_type(0) != ngraph::element::f32)
+            return false;
+
+        // The embedding node fuses only a scale per row or one scale for the table, other scales
+        // (e.g. per column) are left to constant folding
+        if (convertNode->get_output_partial_shape(0).is_dynamic() ||
+            scalesNode->get_output_partial_shape(0).is_dynamic())
+            return false;
+        const auto& tableShape = convertNode->get_output_shape(0);
+        const auto& scalesShape = scalesNode->get_output_shape(0);
+        if (tableShape.size() < 2 || scalesShape.size() != tableShape.size())
+            return false;
+        if (scalesShape[0] != tableShape[0] && scalesShape[0] != 1)
+            return false;
+        for (size_t i = 1; i < scalesShape.size(); i++) {
+            if (scalesShape[i] != 1)
+                return false;
+        }
+
+        for (const auto& consumer : multiplyNode->output(0).get_target_inputs()) {
+            const auto node = consumer.get_node();
+            const bool isEmbedding = ngraph::is_type<ngraph::opset3::EmbeddingBagOffsetsSum>(node) ||
+                                     ngraph::is_type<ngraph::opset3::EmbeddingBagPackedSum>(node) ||
+                                     ngraph::is_type<ngraph::opset3::EmbeddingSegmentsSum>(node);
+            if (!isEmbedding || consumer.get_index() != 0)
+                return false;
+        }
+
+        auto& rtInfo = convertNode->get_rt_info();
+        if (rtInfo.count("DISABLED_CONSTANT_FOLDING"))
+            return false;
+        rtInfo["DISABLED_CONSTANT_FOLDING"] = std::make_shared<ngraph::VariantWrapper<std::string>>("");
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(multiply, "KeepEmbeddingTableDequantization");
+    this->register_matcher(m, callback);
+}
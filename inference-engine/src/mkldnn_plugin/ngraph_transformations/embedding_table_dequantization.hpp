@@ -0,0 +1,21 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Keeps I8/U8 embedding tables dequantized by Convert and per row Multiply from being folded to FP32,
+ * so the embedding node reads the quantized table and applies the scales itself.
+ */
+class KeepEmbeddingTableDequantization: public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    KeepEmbeddingTableDequantization();
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,126 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fuse_scaled_dot_product_attention.hpp"
+#include "op/scaled_dot_product_attention.hpp"
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::FuseScaledDotProductAttention, "FuseScaledDotProductAttention", 0);
+
+namespace {
+
+bool hasSingleConsumer(const std::shared_ptr<ngraph::Node>& node) {
+    return node->get_output_size() == 1 && node->output(0).get_target_inputs().size() == 1;
+}
+
+bool isScalarConstant(const ngraph::Output<ngraph::Node>& output, float& value) {
+    auto constant = std::dynamic_pointer_cast<ngraph::opset1::Constant>(output.get_node_shared_ptr());
+    if (!constant || ngraph::shape_size(constant->get_shape()) != 1)
+        return false;
+    value = constant->cast_vector<float>()[0];
+    return true;
+}
+
+// Attention scores are Q*K MatMul optionally scaled by a scalar constant, while the mask is any other subgraph
+// (e.g. BERT mask is computed as Multiply(Subtract(1, mask), -10000))
+bool isScores(const std::shared_ptr<ngraph::Node>& node) {
+    auto producer = node;
+    float scale = 1.f;
+    if ((ngraph::is_type<ngraph::opset1::Multiply>(producer) || ngraph::is_type<ngraph::opset1::Divide>(producer)) &&
+        isScalarConstant(producer->input_value(1), scale))
+        producer = producer->get_input_node_shared_ptr(0);
+    return ngraph::is_type<ngraph::opset1::MatMul>(producer);
+}
+
+}  // namespace
+
+MKLDNNPlugin::FuseScaledDotProductAttention::FuseScaledDotProductAttention() {
+    auto softmax = ngraph::pattern::wrap_type<ngraph::opset1::Softmax>(ngraph::pattern::consumers_count(1));
+    auto matmul = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({softmax, ngraph::pattern::any_input()},
+                                                                      ngraph::pattern::has_static_shape());
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+        auto outMatMul = std::dynamic_pointer_cast<ngraph::opset1::MatMul>(m.get_match_root());
+        auto softmaxNode = std::dynamic_pointer_cast<ngraph::opset1::Softmax>(m.get_pattern_value_map().at(softmax).get_node_shared_ptr());
+        if (!outMatMul || !softmaxNode || outMatMul->get_transpose_a() || outMatMul->get_transpose_b())
+            return false;
+
+        const auto scoresShape = softmaxNode->get_output_shape(0);
+        const auto rank = scoresShape.size();
+        if ((rank != 3 && rank != 4) || softmaxNode->get_axis() != rank - 1)
+            return false;
+
+        ngraph::NodeVector fused = {outMatMul, softmaxNode};
+        auto node = softmaxNode->get_input_node_shared_ptr(0);
+
+        ngraph::Output<ngraph::Node> mask;
+        if (ngraph::is_type<ngraph::opset1::Add>(node)) {
+            if (!hasSingleConsumer(node))
+                return false;
+            size_t scoresSide = 0;
+            if (isScores(node->get_input_node_shared_ptr(0))) {
+                scoresSide = 0;
+            } else if (isScores(node->get_input_node_shared_ptr(1))) {
+                scoresSide = 1;
+            } else {
+                return false;
+            }
+            mask = node->input_value(1 - scoresSide);
+            // mask is broadcast to the scores and doesn't change their shape
+            if (mask.get_partial_shape().is_dynamic() || mask.get_shape().size() > rank ||
+                node->get_input_shape(scoresSide) != scoresShape)
+                return false;
+            fused.push_back(node);
+            node = node->get_input_node_shared_ptr(scoresSide);
+        }
+
+        float scale = 1.f;
+        if (ngraph::is_type<ngraph::opset1::Multiply>(node) || ngraph::is_type<ngraph::opset1::Divide>(node)) {
+            if (!hasSingleConsumer(node) || !isScalarConstant(node->input_value(1), scale))
+                return false;
+            if (ngraph::is_type<ngraph::opset1::Divide>(node)) {
+                if (scale == 0.f)
+                    return false;
+                scale = 1.f / scale;
+            }
+            fused.push_back(node);
+            node = node->get_input_node_shared_ptr(0);
+        }
+
+        auto inMatMul = std::dynamic_pointer_cast<ngraph::opset1::MatMul>(node);
+        if (!inMatMul || !hasSingleConsumer(inMatMul) || inMatMul->get_transpose_a())
+            return false;
+        fused.push_back(inMatMul);
+
+        const auto q = inMatMul->input_value(0);
+        const auto k = inMatMul->input_value(1);
+        const auto v = outMatMul->input_value(1);
+        for (const auto& input : {q, k, v}) {
+            if (input.get_partial_shape().is_dynamic() || input.get_shape().size() != rank ||
+                !input.get_element_type().is_real())
+                return false;
+        }
+        // batch dimensions are not broadcast
+        const auto qShape = q.get_shape();
+        if (!std::equal(qShape.begin(), qShape.end() - 2, k.get_shape().begin()) ||
+            !std::equal(qShape.begin(), qShape.end() - 2, v.get_shape().begin()))
+            return false;
+
+        ngraph::OutputVector args = {q, k, v};
+        if (mask.get_node())
+            args.push_back(mask);
+
+        auto attention = std::make_shared<MKLDNNPlugin::ScaledDotProductAttentionNode>(args, scale, inMatMul->get_transpose_b());
+        attention->set_friendly_name(outMatMul->get_friendly_name());
+        ngraph::copy_runtime_info(fused, attention);
+        ngraph::replace_node(outMatMul, attention);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(matmul, "FuseScaledDotProductAttention");
+    this->register_matcher(m, callback);
+}
@@ -0,0 +1,21 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Replaces MatMul(Q, K) -> [Multiply|Divide by scalar] -> [Add(mask)] -> Softmax -> MatMul(V) with
+ * ScaledDotProductAttentionNode, so the attention scores are never stored in memory.
+ */
+class FuseScaledDotProductAttention: public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    FuseScaledDotProductAttention();
+};
+
+}  // namespace MKLDNNPlugin
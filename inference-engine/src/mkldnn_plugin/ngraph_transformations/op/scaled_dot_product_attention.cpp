@@ -0,0 +1,43 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "scaled_dot_product_attention.hpp"
+
+constexpr ngraph::NodeTypeInfo MKLDNNPlugin::ScaledDotProductAttentionNode::type_info;
+
+MKLDNNPlugin::ScaledDotProductAttentionNode::ScaledDotProductAttentionNode(const ngraph::OutputVector& args,
+                                                                           const float scale,
+                                                                           const bool transpose_k)
+    : Op(args), m_scale(scale), m_transpose_k(transpose_k) {
+    constructor_validate_and_infer_types();
+}
+
+std::shared_ptr<ngraph::Node> MKLDNNPlugin::ScaledDotProductAttentionNode::clone_with_new_inputs(const ngraph::OutputVector& new_args) const {
+    if (new_args.size() != 3 && new_args.size() != 4)
+        throw ngraph::ngraph_error("Unsupported number of arguments for ScaledDotProductAttention operation");
+    return std::make_shared<MKLDNNPlugin::ScaledDotProductAttentionNode>(new_args, m_scale, m_transpose_k);
+}
+
+void MKLDNNPlugin::ScaledDotProductAttentionNode::validate_and_infer_types() {
+    const auto inputsNum = get_input_size();
+    NODE_VALIDATION_CHECK(this, inputsNum == 3 || inputsNum == 4, "Expects 3 or 4 inputs, got: ", inputsNum);
+
+    const auto& qShape = get_input_partial_shape(0);
+    const auto& vShape = get_input_partial_shape(2);
+    if (qShape.rank().is_dynamic() || vShape.rank().is_dynamic()) {
+        set_output_type(0, get_input_element_type(0), ngraph::PartialShape::dynamic());
+        return;
+    }
+    NODE_VALIDATION_CHECK(this, qShape.rank() == vShape.rank(), "Query and value ranks must be equal");
+
+    auto outShape = qShape;
+    outShape[outShape.rank().get_length() - 1] = vShape[vShape.rank().get_length() - 1];
+    set_output_type(0, get_input_element_type(0), outShape);
+}
+
+bool MKLDNNPlugin::ScaledDotProductAttentionNode::visit_attributes(ngraph::AttributeVisitor& visitor) {
+    visitor.on_attribute("scale", m_scale);
+    visitor.on_attribute("transpose_k", m_transpose_k);
+    return true;
+}
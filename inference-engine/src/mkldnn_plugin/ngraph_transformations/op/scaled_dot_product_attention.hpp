@@ -0,0 +1,38 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/op/op.hpp>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Softmax(Q * K^T * scale + mask) * V computed without materializing the attention scores.
+ * Inputs: Q [.., L, E], K [.., S, E] (or [.., E, S] when transpose_k is false), V [.., S, Ev] and optional
+ * mask broadcastable to [.., L, S]. Batch dimensions of Q, K and V are equal.
+ */
+class ScaledDotProductAttentionNode : public ngraph::op::Op {
+public:
+    static constexpr ngraph::NodeTypeInfo type_info{"ScaledDotProductAttention", 0};
+    static constexpr const ::ngraph::Node::type_info_t& get_type_info_static() { return type_info; }
+    const ngraph::NodeTypeInfo& get_type_info() const override { return type_info; }
+
+    ScaledDotProductAttentionNode() = default;
+
+    ScaledDotProductAttentionNode(const ngraph::OutputVector& args, float scale, bool transpose_k);
+
+    void validate_and_infer_types() override;
+    bool visit_attributes(ngraph::AttributeVisitor& visitor) override;
+    std::shared_ptr<ngraph::Node> clone_with_new_inputs(const ngraph::OutputVector& new_args) const override;
+
+    float get_scale() const { return m_scale; }
+    bool get_transpose_k() const { return m_transpose_k; }
+
+private:
+    float m_scale = 1.f;
+    bool m_transpose_k = true;
+};
+
+}  // namespace MKLDNNPlugin
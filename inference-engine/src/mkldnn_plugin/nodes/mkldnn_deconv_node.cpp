@@ -328,7 +328,7 @@ void MKLDNNDeconvolutionNode::createPrimitive() {
         auto prim_desc = createPrimitiveDescriptor<deconvolution_forward::primitive_desc,
                 deconvolution_forward::desc>(attr);
 
-        prim.reset(new deconvolution_forward(prim_desc));
+        prim = getOrCreatePrimitive<deconvolution_forward>(prim_desc);
 
         auto src = getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
         auto dst = getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
@@ -337,7 +337,7 @@ void MKLDNNDeconvolutionNode::createPrimitive() {
         auto prim_desc = createPrimitiveDescriptor<convolution_backward_data::primitive_desc,
                 convolution_backward_data::desc, convolution_forward::primitive_desc>(attr);
 
-        prim.reset(new convolution_backward_data(prim_desc));
+        prim = getOrCreatePrimitive<convolution_backward_data>(prim_desc);
 
         auto src = getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
         auto weights = getParentEdgeAt(1)->getMemory().GetPrimitive();
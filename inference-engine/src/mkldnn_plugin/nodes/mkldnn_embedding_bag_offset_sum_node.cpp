@@ -45,32 +45,22 @@ void MKLDNNEmbeddingBagOffsetSumNode::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
 
-    std::string logPrefix = std::string("Layer EmbeddingBagSum with name '") + _layerName + "' ";
-    static const std::set<Precision> supportedPrecisions =
-            {Precision::FP32, Precision::I8, Precision::U8, Precision::I32};
-
-    auto inDataPrecision = getOriginalInputPrecisionAtPort(EMB_TABLE_IDX);
-    if (inDataPrecision == Precision::BF16)
-        inDataPrecision = Precision::FP32;
-    if (!supportedPrecisions.empty()) {
-        if (supportedPrecisions.find(inDataPrecision) == supportedPrecisions.end())
-            IE_THROW() << logPrefix << "has unsupported precision: " << inDataPrecision.name();
-    } else {
-        static const std::set<Precision> defaultSupportedPrecisions =
-                {Precision::FP32, Precision::I8, Precision::U8, Precision::I32};
-        if (defaultSupportedPrecisions.find(inDataPrecision) == defaultSupportedPrecisions.end())
-            IE_THROW() << logPrefix << "has unsupported precision: " << inDataPrecision.name();
-    }
+    Precision tablePrecision, dataPrecision;
+    getSupportedPrecisions(getOriginalInputPrecisionAtPort(EMB_TABLE_IDX), tablePrecision, dataPrecision);
 
-    std::vector<DataConfigurator> inDataConfigurators({{TensorDescCreatorTypes::ncsp, inDataPrecision},
+    std::vector<DataConfigurator> inDataConfigurators({{TensorDescCreatorTypes::ncsp, tablePrecision},
                                                        {TensorDescCreatorTypes::ncsp, Precision::I32},
                                                        {TensorDescCreatorTypes::ncsp, Precision::I32}});
     if (getOriginalInputsNumber() > DEFAULT_INDEX_IDX)
         inDataConfigurators.push_back({TensorDescCreatorTypes::ncsp, Precision::I32});
     if (getOriginalInputsNumber() > PER_SAMPLE_WEIGHTS_IDX)
-        inDataConfigurators.push_back({TensorDescCreatorTypes::ncsp, inDataPrecision});
+        inDataConfigurators.push_back({TensorDescCreatorTypes::ncsp, dataPrecision});
+
+    addSupportedPrimDesc(inDataConfigurators, {{TensorDescCreatorTypes::ncsp, dataPrecision}}, impl_desc_type::ref_any);
+}
 
-    addSupportedPrimDesc(inDataConfigurators, {{TensorDescCreatorTypes::ncsp, inDataPrecision}}, impl_desc_type::ref_any);
+void MKLDNNEmbeddingBagOffsetSumNode::createPrimitive() {
+    createKernel(getParentEdgeAt(EMB_TABLE_IDX)->getDesc().getPrecision());
 }
 
 void MKLDNNEmbeddingBagOffsetSumNode::initFromInputs() {
@@ -2,7 +2,10 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <cmath>
+#include <limits>
+#include <set>
 #include <vector>
 #include <string>
 #include <mkldnn_types.h>
@@ -10,10 +13,165 @@
 #include "mkldnn_embedding_bag_sum_node.h"
 #include <ngraph/opsets/opset1.hpp>
 #include "common/cpu_memcpy.h"
+#include "utils/bfloat16.hpp"
+#include <cpu/x64/jit_generator.hpp>
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 
+using namespace dnnl::impl::cpu;
+using namespace dnnl::impl::cpu::x64;
+using namespace dnnl::impl::utils;
+using namespace Xbyak;
+
+#define GET_OFF(field) offsetof(jit_emb_bag_call_args, field)
+
+template <cpu_isa_t isa>
+struct jit_emb_bag_kernel : public jit_uni_emb_bag_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_emb_bag_kernel)
+
+    explicit jit_emb_bag_kernel(jit_emb_bag_config_params jcp) : jit_uni_emb_bag_kernel(jcp), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        this->preamble();
+
+        mov(reg_table, ptr[reg_params + GET_OFF(table)]);
+        mov(reg_indices, ptr[reg_params + GET_OFF(indices)]);
+        mov(reg_weights, ptr[reg_params + GET_OFF(weights)]);
+        mov(reg_scales, ptr[reg_params + GET_OFF(scales)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_indices_num, ptr[reg_params + GET_OFF(indices_num)]);
+
+        // Bags may be unweighted even if the node has per sample weights (e.g. default index of an empty bag)
+        Xbyak::Label unweighted_label, exit_label;
+        if (jcp.with_weights) {
+            test(reg_weights, reg_weights);
+            jz(unweighted_label, T_NEAR);
+            accumulate_row(true);
+            jmp(exit_label, T_NEAR);
+        }
+        L(unweighted_label);
+        accumulate_row(false);
+        L(exit_label);
+
+        this->postamble();
+    }
+
+private:
+    using Vmm = typename conditional<isa == x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    using reg64_t = const Xbyak::Reg64;
+
+    static constexpr size_t cache_line_size = 64;
+    // All vector registers but the auxiliary ones keep accumulators
+    const size_t max_unroll = (isa == x64::avx2 ? 16 : 32) - 3;
+    const size_t vlen = cpu_isa_traits<isa>::vlen;
+
+    reg64_t reg_table = r8;
+    reg64_t reg_indices = r9;
+    reg64_t reg_weights = r10;
+    reg64_t reg_scales = r11;
+    reg64_t reg_dst = r12;
+    reg64_t reg_indices_num = r13;
+    reg64_t reg_index_pos = r14;
+    reg64_t reg_row = r15;
+    reg64_t reg_prefetch_row = rax;
+    reg64_t reg_params = abi_param1;
+
+    Vmm vmm_scale = Vmm(max_unroll);
+    Vmm vmm_weight = Vmm(max_unroll + 1);
+    Vmm vmm_val = Vmm(max_unroll + 2);
+
+    void accumulate_row(bool weighted) {
+        for (size_t block = 0; block < jcp.blocks_num; block += max_unroll)
+            accumulate_blocks(block, std::min(max_unroll, jcp.blocks_num - block), weighted);
+    }
+
+    // Sums the same unroll vectors of all rows of the bag in registers and stores them to dst
+    void accumulate_blocks(size_t first_block, size_t unroll, bool weighted) {
+        const size_t prc_size = jcp.table_prc.size();
+        const size_t row_bytes = jcp.row_size * prc_size;
+        const size_t offset = first_block * jcp.block_size * prc_size;
+        const size_t bytes = unroll * jcp.block_size * prc_size;
+
+        for (size_t i = 0; i < unroll; i++)
+            uni_vpxor(Vmm(i), Vmm(i), Vmm(i));
+
+        Xbyak::Label loop_label, loop_end_label, prefetch_end_label;
+        xor_(reg_index_pos, reg_index_pos);
+        L(loop_label);
+        {
+            cmp(reg_index_pos, reg_indices_num);
+            jge(loop_end_label, T_NEAR);
+
+            // Rows are scattered over the table, so the part of the row needed a few iterations later is requested in advance
+            if (jcp.prefetch_distance != 0) {
+                lea(reg_prefetch_row, ptr[reg_index_pos + jcp.prefetch_distance]);
+                cmp(reg_prefetch_row, reg_indices_num);
+                jge(prefetch_end_label, T_NEAR);
+                movsxd(reg_prefetch_row, dword[reg_indices + reg_prefetch_row * sizeof(int)]);
+                imul(reg_prefetch_row, reg_prefetch_row, static_cast<int>(row_bytes));
+                add(reg_prefetch_row, reg_table);
+                for (size_t line = 0; line < bytes; line += cache_line_size)
+                    prefetcht0(ptr[reg_prefetch_row + offset + line]);
+                prefetcht0(ptr[reg_prefetch_row + (offset + bytes - 1)]);
+                L(prefetch_end_label);
+            }
+
+            movsxd(reg_row, dword[reg_indices + reg_index_pos * sizeof(int)]);
+            if (jcp.with_scales)
+                uni_vbroadcastss(vmm_scale, ptr[reg_scales + reg_row * sizeof(float)]);
+            if (weighted)
+                uni_vbroadcastss(vmm_weight, ptr[reg_weights + reg_index_pos * sizeof(float)]);
+            imul(reg_row, reg_row, static_cast<int>(row_bytes));
+            add(reg_row, reg_table);
+
+            // Same operations order as in the reference implementation, multiplication and addition are not fused
+            for (size_t i = 0; i < unroll; i++) {
+                load_vector(vmm_val, ptr[reg_row + offset + i * jcp.block_size * prc_size]);
+                if (jcp.with_scales)
+                    uni_vmulps(vmm_val, vmm_val, vmm_scale);
+                if (weighted)
+                    uni_vmulps(vmm_val, vmm_val, vmm_weight);
+                uni_vaddps(Vmm(i), Vmm(i), vmm_val);
+            }
+
+            add(reg_index_pos, 1);
+            jmp(loop_label, T_NEAR);
+        }
+        L(loop_end_label);
+
+        for (size_t i = 0; i < unroll; i++)
+            uni_vmovups(ptr[reg_dst + (first_block + i) * vlen], Vmm(i));
+    }
+
+    inline void load_vector(const Vmm& vmm_dst, const Xbyak::Address& op) {
+        switch (jcp.table_prc) {
+            case Precision::FP32:
+                uni_vmovups(vmm_dst, op);
+                break;
+            case Precision::BF16:
+                vpmovzxwd(vmm_dst, op);
+                uni_vpslld(vmm_dst, vmm_dst, 16);
+                break;
+            case Precision::I8:
+                uni_vpmovsxbd(vmm_dst, op);
+                uni_vcvtdq2ps(vmm_dst, vmm_dst);
+                break;
+            case Precision::U8:
+                uni_vpmovzxbd(vmm_dst, op);
+                uni_vcvtdq2ps(vmm_dst, vmm_dst);
+                break;
+            default:
+                assert(!"unsupported table precision");
+        }
+    }
+};
+
 MKLDNNEmbeddingBagSumNode::MKLDNNEmbeddingBagSumNode(
             const std::shared_ptr<ngraph::Node>& op,
             size_t requiredInputNum,
@@ -42,96 +200,199 @@ MKLDNNEmbeddingBagSumNode::MKLDNNEmbeddingBagSumNode(
     }
 }
 
-template<typename T>
-void MKLDNNEmbeddingBagSumNode::processData(const T* srcData, const T* weightsData, T* dstData,
-                                            const InferenceEngine::TensorDesc& srcDesc, const InferenceEngine::TensorDesc& dstDesc) {
-    std::string msgPrefix = std::string("Node EmbeddingBagSum with name '") + _layerName + "' ";
+void MKLDNNEmbeddingBagSumNode::getSupportedPrecisions(Precision origTablePrc, Precision& tablePrc, Precision& dataPrc) const {
+    std::string logPrefix = std::string("Layer EmbeddingBagSum with name '") + _layerName + "' ";
+    static const std::set<Precision> supportedPrecisions =
+            {Precision::FP32, Precision::I8, Precision::U8, Precision::I32};
 
-    initFromInputs();
+    tablePrc = origTablePrc;
+    dataPrc = origTablePrc;
+    // Reduced precision tables are read as is and accumulated in FP32
+    if (origTablePrc == Precision::BF16) {
+        dataPrc = Precision::FP32;
+        return;
+    }
+    if (withRowScales()) {
+        if (origTablePrc != Precision::I8 && origTablePrc != Precision::U8)
+            IE_THROW() << logPrefix << "has unsupported precision of the table with row scales: " << origTablePrc.name();
+        dataPrc = Precision::FP32;
+        return;
+    }
+    if (supportedPrecisions.find(origTablePrc) == supportedPrecisions.end())
+        IE_THROW() << logPrefix << "has unsupported precision: " << origTablePrc.name();
+}
 
-    const auto& inDataDims = srcDesc.getDims();
-    const size_t outputBagsNum = dstDesc.getDims()[0];
+void MKLDNNEmbeddingBagSumNode::createKernel(Precision tablePrc) {
+    _kernel.reset();
+    // Integer tables without scales are accumulated in their own precision by the reference implementation
+    if (tablePrc == Precision::I32 || (!withRowScales() && (tablePrc == Precision::I8 || tablePrc == Precision::U8)))
+        return;
+    if (_embDepth * tablePrc.size() > static_cast<size_t>(std::numeric_limits<int>::max()))
+        return;
 
-    auto threadBody = [&](const int ithr, const int nthr) {
-        size_t start(0lu), end(0lu);
-        splitter(outputBagsNum, nthr, ithr, start, end);
-        if (start >= end)
-            return;
+    jit_emb_bag_config_params jcp;
+    jcp.row_size = _embDepth;
+    jcp.table_prc = tablePrc;
+    jcp.with_weights = _withWeights;
+    jcp.with_scales = withRowScales();
+    jcp.prefetch_distance = 8;
 
-        size_t indicesSize = 0lu;
-        const int* indices = nullptr;
-        int weightsIdx = 0lu;
-        bool withWeights = _withWeights;
+    // BF16 rows are widened with vpmovzxwd, its 512-bit form requires AVX512BW
+    if (mayiuse(x64::avx512_common) && (tablePrc != Precision::BF16 || mayiuse(x64::avx512_core))) {
+        jcp.block_size = cpu_isa_traits<x64::avx512_common>::vlen / sizeof(float);
+        jcp.blocks_num = _embDepth / jcp.block_size;
+        if (jcp.blocks_num != 0)
+            _kernel.reset(new jit_emb_bag_kernel<x64::avx512_common>(jcp));
+    } else if (mayiuse(x64::avx2)) {
+        jcp.block_size = cpu_isa_traits<x64::avx2>::vlen / sizeof(float);
+        jcp.blocks_num = _embDepth / jcp.block_size;
+        if (jcp.blocks_num != 0)
+            _kernel.reset(new jit_emb_bag_kernel<x64::avx2>(jcp));
+    }
 
-        for (size_t obi = start; obi < end; obi++) {
-            size_t dstIndex = obi * _embDepth;
-            getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
+    if (_kernel)
+        _kernel->create_ker();
+}
 
-            if (indices != nullptr) {
-                withWeights = withWeights & _withWeights;
+void MKLDNNEmbeddingBagSumNode::prepareBags(size_t outputBagsNum, size_t tableRows) {
+    initFromInputs();
 
-                size_t inIdx = 0lu;
-                if (indices[inIdx] >= inDataDims[0]) {
-                    IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]);
-                }
-                size_t srcIndex = indices[inIdx] * _embDepth;
-
-                if (withWeights) {
-                    for (size_t i = 0lu; i < _embDepth; i++) {
-                        dstData[dstIndex + i] = srcData[srcIndex + i] * weightsData[weightsIdx];
-                    }
-                    weightsIdx++;
-                } else {
-                    for (size_t i = 0lu; i < _embDepth; i++) {
-                        dstData[dstIndex + i] = srcData[srcIndex + i];
-                    }
-                }
+    _tableRows = tableRows;
+    _bags.resize(outputBagsNum);
+    _bagsCost.resize(outputBagsNum + 1);
+    _bagsCost[0] = 0;
+    for (size_t obi = 0; obi < outputBagsNum; obi++) {
+        auto& bag = _bags[obi];
+        bag.weightsIdx = 0;
+        bag.withWeights = _withWeights;
+        getIndices(obi, bag.indices, bag.size, bag.weightsIdx, bag.withWeights);
+        bag.withWeights = bag.withWeights && _withWeights;
+        // Every bag costs at least its output row, bag sizes may differ by orders of magnitude
+        _bagsCost[obi + 1] = _bagsCost[obi] + (bag.indices != nullptr ? bag.size : 0) + 1;
+    }
+}
+
+void MKLDNNEmbeddingBagSumNode::checkIndices(const BagInfo& bag) const {
+    for (size_t i = 0; i < bag.size; i++) {
+        if (static_cast<size_t>(bag.indices[i]) >= _tableRows) {
+            IE_THROW() << "Node EmbeddingBagSum with name '" << _layerName << "' has invalid embedding bag index: " << bag.indices[i];
+        }
+    }
+}
+
+template<typename F>
+void MKLDNNEmbeddingBagSumNode::parallelForBags(const F& func) {
+    const size_t totalCost = _bagsCost.back();
+    auto threadBody = [&](const int ithr, const int nthr) {
+        // Threads take ranges of bags with equal number of rows to accumulate instead of equal number of bags
+        auto firstBag = [&](int thr) {
+            return static_cast<size_t>(std::lower_bound(_bagsCost.begin(), _bagsCost.end(), totalCost * thr / nthr) - _bagsCost.begin());
+        };
+        const size_t start = firstBag(ithr);
+        const size_t end = ithr == nthr - 1 ? _bags.size() : firstBag(ithr + 1);
+        for (size_t obi = start; obi < end; obi++)
+            func(obi);
+    };
+
+    parallel_nt(0, threadBody);
+}
 
-                for (inIdx = 1lu; inIdx < indicesSize; inIdx++) {
-                    if (indices[inIdx] >= inDataDims[0]) {
-                        IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]);
-                    }
-                    size_t srcIndex = indices[inIdx] * _embDepth;
-
-                    if (withWeights) {
-                        for (size_t i = 0lu; i < _embDepth; i++) {
-                            dstData[dstIndex + i] += srcData[srcIndex + i] * weightsData[weightsIdx];
-                        }
-                        weightsIdx++;
-                    } else {
-                        for (size_t i = 0lu; i < _embDepth; i++) {
-                            dstData[dstIndex + i] += srcData[srcIndex + i];
-                        }
-                    }
+template<typename T>
+void MKLDNNEmbeddingBagSumNode::processData(const T* srcData, const T* weightsData, T* dstData) {
+    parallelForBags([&](size_t obi) {
+        const auto& bag = _bags[obi];
+        T* dst = dstData + obi * _embDepth;
+        std::fill(dst, dst + _embDepth, static_cast<T>(0));
+        if (bag.indices == nullptr)
+            return;
+        checkIndices(bag);
+
+        for (size_t inIdx = 0lu; inIdx < bag.size; inIdx++) {
+            const T* src = srcData + bag.indices[inIdx] * _embDepth;
+            if (bag.withWeights) {
+                const T weight = weightsData[bag.weightsIdx + inIdx];
+                for (size_t i = 0lu; i < _embDepth; i++) {
+                    dst[i] += src[i] * weight;
                 }
             } else {
                 for (size_t i = 0lu; i < _embDepth; i++) {
-                    dstData[dstIndex + i] = 0;
+                    dst[i] += src[i];
                 }
             }
         }
-    };
+    });
+}
 
-    parallel_nt(0, threadBody);
+template<typename T>
+void MKLDNNEmbeddingBagSumNode::processFloatData(const T* srcData, const float* weightsData, float* dstData) {
+    const float* scales = withRowScales() ? _rowScales.data() : nullptr;
+    const size_t kernelDepth = _kernel ? _kernel->jcp.blocks_num * _kernel->jcp.block_size : 0lu;
+
+    parallelForBags([&](size_t obi) {
+        const auto& bag = _bags[obi];
+        float* dst = dstData + obi * _embDepth;
+        if (bag.indices == nullptr) {
+            std::fill(dst, dst + _embDepth, 0.f);
+            return;
+        }
+        checkIndices(bag);
+
+        const float* weights = bag.withWeights ? weightsData + bag.weightsIdx : nullptr;
+        if (_kernel) {
+            auto args = jit_emb_bag_call_args();
+            args.table = srcData;
+            args.indices = bag.indices;
+            args.weights = weights;
+            args.scales = scales;
+            args.dst = dst;
+            args.indices_num = bag.size;
+            (*_kernel)(&args);
+        }
+
+        // Row tail which doesn't fill a vector or the whole row if there is no kernel
+        std::fill(dst + kernelDepth, dst + _embDepth, 0.f);
+        for (size_t inIdx = 0lu; inIdx < bag.size; inIdx++) {
+            const T* src = srcData + bag.indices[inIdx] * _embDepth;
+            for (size_t i = kernelDepth; i < _embDepth; i++) {
+                float value = static_cast<float>(src[i]);
+                if (scales)
+                    value *= scales[bag.indices[inIdx]];
+                if (weights)
+                    value *= weights[inIdx];
+                dst[i] += value;
+            }
+        }
+    });
 }
 
 void MKLDNNEmbeddingBagSumNode::execute(const uint8_t* srcData, const uint8_t* weightsData, uint8_t* dstData,
                                         const InferenceEngine::TensorDesc& srcDesc, const InferenceEngine::TensorDesc& dstDesc) {
+    prepareBags(dstDesc.getDims()[0], srcDesc.getDims()[0]);
+
     switch (srcDesc.getPrecision()) {
         case Precision::FP32: {
-            return processData<PrecisionTrait<Precision::FP32>::value_type>(reinterpret_cast<const float*>(srcData),
-                    reinterpret_cast<const float*>(weightsData), reinterpret_cast<float*>(dstData), srcDesc, dstDesc);
+            return processFloatData(reinterpret_cast<const float*>(srcData), reinterpret_cast<const float*>(weightsData),
+                    reinterpret_cast<float*>(dstData));
+        }
+        case Precision::BF16: {
+            return processFloatData(reinterpret_cast<const bfloat16_t*>(srcData), reinterpret_cast<const float*>(weightsData),
+                    reinterpret_cast<float*>(dstData));
         }
         case Precision::I8: {
+            if (withRowScales())
+                return processFloatData(reinterpret_cast<const int8_t*>(srcData), reinterpret_cast<const float*>(weightsData),
+                        reinterpret_cast<float*>(dstData));
             return processData<PrecisionTrait<Precision::I8>::value_type>(reinterpret_cast<const int8_t*>(srcData),
-                    reinterpret_cast<const int8_t*>(weightsData), reinterpret_cast<int8_t*>(dstData), srcDesc, dstDesc);
+                    reinterpret_cast<const int8_t*>(weightsData), reinterpret_cast<int8_t*>(dstData));
         }
         case Precision::U8: {
-            return processData<PrecisionTrait<Precision::U8>::value_type>(srcData, weightsData, dstData, srcDesc, dstDesc);
+            if (withRowScales())
+                return processFloatData(srcData, reinterpret_cast<const float*>(weightsData), reinterpret_cast<float*>(dstData));
+            return processData<PrecisionTrait<Precision::U8>::value_type>(srcData, weightsData, dstData);
         }
         case Precision::I32: {
             return processData<PrecisionTrait<Precision::I32>::value_type>(reinterpret_cast<const int32_t*>(srcData),
-                    reinterpret_cast<const int32_t*>(weightsData), reinterpret_cast<int32_t*>(dstData), srcDesc, dstDesc);
+                    reinterpret_cast<const int32_t*>(weightsData), reinterpret_cast<int32_t*>(dstData));
         }
         default: {
             IE_THROW() << "EmbeddingBagSum layer does not support precision '"
@@ -12,6 +12,34 @@
 
 namespace MKLDNNPlugin {
 
+struct jit_emb_bag_config_params {
+    size_t row_size;        // elements in a table row
+    size_t block_size;      // elements in a vector
+    size_t blocks_num;      // vectors of a row processed by the kernel, the rest is computed by the caller
+    InferenceEngine::Precision table_prc;
+    bool with_weights;
+    bool with_scales;
+    size_t prefetch_distance;
+};
+
+struct jit_emb_bag_call_args {
+    const void* table;
+    const int* indices;
+    const float* weights;   // nullptr if the bag is not weighted
+    const float* scales;
+    float* dst;
+    size_t indices_num;
+};
+
+struct jit_uni_emb_bag_kernel {
+    void (*ker_)(const jit_emb_bag_call_args *);
+    void operator()(const jit_emb_bag_call_args *args) { assert(ker_); ker_(args); }
+    jit_emb_bag_config_params jcp;
+    virtual void create_ker() = 0;
+    explicit jit_uni_emb_bag_kernel(jit_emb_bag_config_params jcp) : ker_(nullptr), jcp(jcp) {}
+    virtual ~jit_uni_emb_bag_kernel() {}
+};
+
 class MKLDNNEmbeddingBagSumNode {
 public:
     MKLDNNEmbeddingBagSumNode(
@@ -26,6 +54,13 @@ public:
 
     ~MKLDNNEmbeddingBagSumNode() = default;
 
+    /**
+     * @brief Makes the node dequantize an I8/U8 embedding table with one scale per table row.
+     * Set by the graph optimizer when it fuses the Convert and Multiply producing the FP32 table.
+     */
+    void setRowScales(std::vector<float> scales) { _rowScales = std::move(scales); }
+    bool withRowScales() const { return !_rowScales.empty(); }
+
 protected:
     virtual void initFromInputs() = 0;
     virtual void getIndices(
@@ -35,9 +70,30 @@ protected:
             int& weightsIdx,
             bool& withWeights) = 0;
 
+    /**
+     * @brief Selects precisions of the embedding table, per sample weights and output for the original table precision.
+     * BF16 and scaled I8/U8 tables are accumulated in FP32.
+     */
+    void getSupportedPrecisions(InferenceEngine::Precision origTablePrc, InferenceEngine::Precision& tablePrc,
+                                InferenceEngine::Precision& dataPrc) const;
+    void createKernel(InferenceEngine::Precision tablePrc);
+
+    struct BagInfo {
+        const int* indices;
+        size_t size;
+        int weightsIdx;
+        bool withWeights;
+    };
+
+    void prepareBags(size_t outputBagsNum, size_t tableRows);
+    void checkIndices(const BagInfo& bag) const;
+    template<typename F>
+    void parallelForBags(const F& func);
+
+    template<typename T>
+    void processData(const T* srcData, const T* weightsData, T* dstData);
     template<typename T>
-    void processData(const T* srcData, const T* weightsData, T* dstData,
-                     const InferenceEngine::TensorDesc& srcDesc, const InferenceEngine::TensorDesc& dstDesc);
+    void processFloatData(const T* srcData, const float* weightsData, float* dstData);
 
     const size_t EMB_TABLE_IDX = 0lu;
     const size_t INDICES_IDX;
@@ -47,6 +103,12 @@ protected:
     bool _withWeights = false;
     size_t _embDepth = 0;
     std::string _layerName;
+
+    std::vector<float> _rowScales;
+    std::vector<BagInfo> _bags;
+    std::vector<size_t> _bagsCost;
+    size_t _tableRows = 0;
+    std::shared_ptr<jit_uni_emb_bag_kernel> _kernel;
 };
 
 }  // namespace MKLDNNPlugin
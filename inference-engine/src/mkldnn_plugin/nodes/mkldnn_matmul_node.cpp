@@ -12,11 +12,191 @@
 #include <mkldnn_extension_utils.h>
 #include "ie_parallel.hpp"
 #include "common/cpu_memcpy.h"
+#include "mkldnn_fake_quantize_node.h"
+#include "mkldnn_eltwise_node.h"
+#include "utils/general_utils.h"
+#include "emitters/jit_load_store_emitters.hpp"
+#include "emitters/jit_bf16_emitters.hpp"
 #include <ngraph/opsets/opset1.hpp>
 
+#include <cpu/x64/jit_generator.hpp>
+#include <cpu/x64/jit_uni_eltwise_injector.hpp>
+#include <cpu/x64/jit_uni_depthwise_injector.hpp>
+#include <cpu/x64/jit_uni_quantization_injector.hpp>
+
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
+using namespace mkldnn::impl;
+using namespace mkldnn::impl::cpu::x64;
+using namespace mkldnn::impl::utils;
+using namespace Xbyak;
+
+#define GET_OFF(field) offsetof(jit_matmul_post_ops_call_args, field)
+
+// Applies fused operations to one FP32 row of the gemm result and stores it in the output precision
+template <cpu_isa_t isa>
+struct jit_uni_matmul_post_ops_kernel_f32 : public jit_uni_matmul_post_ops_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_matmul_post_ops_kernel_f32)
+
+    explicit jit_uni_matmul_post_ops_kernel_f32(jit_matmul_post_ops_config_params jcp, const mkldnn_primitive_attr &attr)
+        : jit_uni_matmul_post_ops_kernel(jcp, attr), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        const auto &p = attr_.post_ops_;
+        for (int i = 0; i < p.len(); i++) {
+            auto &post_op = p.entry_[i];
+            if (post_op.is_eltwise()) {
+                eltwise_injectors.push_back(std::make_shared<jit_uni_eltwise_injector_f32<isa>>(
+                        this, post_op.eltwise.alg, post_op.eltwise.alpha, post_op.eltwise.beta, post_op.eltwise.scale));
+            } else if (post_op.is_depthwise()) {
+                depthwise_injectors.push_back(std::make_shared<jit_uni_depthwise_injector_f32<isa>>(
+                        this, post_op.depthwise.alg));
+            } else if (post_op.is_quantization()) {
+                quantization_injectors.push_back(std::make_shared<jit_uni_quantization_injector_f32<isa>>(
+                        this, post_op, vmm_d_weights, vmm_d_bias, reg_d_weights, reg_d_bias));
+            }
+        }
+
+        load_emitter.reset(new jit_load_emitter(this, isa, nullptr));
+        store_emitter.reset(new jit_store_emitter(this, isa, nullptr));
+
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_oc_off, ptr[reg_params + GET_OFF(oc_off)]);
+        mov(reg_work_amount, jcp_.work_amount);
+
+        uni_vpxor(vmm_zero, vmm_zero, vmm_zero);
+
+        load_pool_gpr_idxs = {static_cast<size_t>(reg_load_store_mask.getIdx()), static_cast<size_t>(reg_load_table.getIdx())};
+        store_pool_gpr_idxs = {static_cast<size_t>(reg_load_store_mask.getIdx())};
+        store_pool_vec_idxs = {static_cast<size_t>(vmm_zero.getIdx())};
+
+        Xbyak::Label loop_label;
+        Xbyak::Label loop_end_label;
+
+        L(loop_label);
+        {
+            cmp(reg_work_amount, step);
+            jl(loop_end_label, T_NEAR);
+
+            worker(step);
+
+            add(reg_src, step * sizeof(float));
+            add(reg_dst, step * jcp_.dst_prc.size());
+            if (!jcp_.is_broadcast)
+                add(reg_oc_off, step * sizeof(float));
+            sub(reg_work_amount, step);
+
+            jmp(loop_label, T_NEAR);
+        }
+        L(loop_end_label);
+
+        const int tail_num = jcp_.work_amount % step;
+        if (tail_num != 0)
+            worker(tail_num);
+
+        this->postamble();
+
+        load_emitter->emit_data();
+        store_emitter->emit_data();
+
+        for (auto& inj : eltwise_injectors)
+            inj->prepare_table();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xbyak::Xmm, isa == cpu::x64::avx2,
+            Xbyak::Ymm, Xbyak::Zmm>::type;
+
+    const int vlen = cpu_isa_traits<isa>::vlen;
+    const int step = vlen / sizeof(float);
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_dst = r9;
+    Xbyak::Reg64 reg_work_amount = r10;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Xbyak::Reg64 reg_oc_off = rax;
+    Xbyak::Reg64 reg_d_weights = rbx;
+    Xbyak::Reg64 reg_d_bias = rdx;
+
+    Xbyak::Reg64 reg_load_table = r15;
+    Xbyak::Reg64 reg_load_store_mask = rbp;
+
+    Vmm vmm_val = Vmm(1);
+    Vmm vmm_zero = Vmm(3);
+
+    Vmm vmm_d_weights = Vmm(5);
+    Vmm vmm_d_bias = Vmm(6);
+
+    std::unique_ptr<jit_load_emitter> load_emitter = nullptr;
+    std::unique_ptr<jit_store_emitter> store_emitter = nullptr;
+
+    std::vector<std::shared_ptr<jit_uni_eltwise_injector_f32<isa>>> eltwise_injectors;
+    std::vector<std::shared_ptr<jit_uni_depthwise_injector_f32<isa>>> depthwise_injectors;
+    std::vector<std::shared_ptr<jit_uni_quantization_injector_f32<isa>>> quantization_injectors;
+
+    std::vector<size_t> store_pool_gpr_idxs;
+    std::vector<size_t> store_pool_vec_idxs;
+    std::vector<size_t> load_pool_gpr_idxs;
+
+    inline void worker(int elt_num) {
+        load_emitter->emit_code({static_cast<size_t>(reg_src.getIdx())}, {static_cast<size_t>(vmm_val.getIdx())},
+            std::make_shared<load_emitter_context>(Precision::FP32, Precision::FP32, elt_num),
+            {}, {load_pool_gpr_idxs});
+
+        apply_post_ops(jcp_.dst_prc, jcp_.is_broadcast);
+
+        store_emitter->emit_code({static_cast<size_t>(vmm_val.getIdx())}, {static_cast<size_t>(reg_dst.getIdx())},
+            std::make_shared<store_emitter_context>(Precision::FP32, jcp_.dst_prc, elt_num),
+            {store_pool_vec_idxs}, {store_pool_gpr_idxs});
+    }
+
+    void apply_post_ops(InferenceEngine::Precision dst_prc, bool is_broadcast) {
+        const auto &p = attr_.post_ops_;
+        int eltwise_inj_idx = 0;
+        int depthwise_inj_idx = 0;
+        int quantization_inj_idx = 0;
+        for (int i = 0; i < p.len(); i++) {
+            auto& post_op = p.entry_[i];
+            if (post_op.is_eltwise()) {
+                eltwise_injectors[eltwise_inj_idx]->compute_vector_range(vmm_val.getIdx(), vmm_val.getIdx() + 1);
+                eltwise_inj_idx++;
+            } else if (post_op.is_depthwise()) {
+                mov(reg_d_weights, reinterpret_cast<size_t>(post_op.depthwise.weights_data));
+                mov(reg_d_bias, reinterpret_cast<size_t>(post_op.depthwise.biases_data));
+                add(reg_d_weights, reg_oc_off);
+                add(reg_d_bias, reg_oc_off);
+                depthwise_injectors[depthwise_inj_idx]->compute_vector_range(vmm_val.getIdx(), vmm_val.getIdx() + 1,
+                                                                             reg_d_weights, reg_d_bias, is_broadcast);
+                depthwise_inj_idx++;
+            } else if (post_op.is_quantization()) {
+                bool do_dequantization = post_op.quantization.alg == alg_kind::quantization_quantize_dequantize;
+                bool do_rounding = do_dequantization || one_of(dst_prc, Precision::FP32, Precision::BF16) || i != p.len() - 1;
+                int s_idx = vmm_val.getIdx();
+
+                quantization_injectors[quantization_inj_idx]->init_crop_ptrs(reg_oc_off);
+                quantization_injectors[quantization_inj_idx]->compute_crop(s_idx, s_idx + 1, 0, 0, is_broadcast);
+
+                quantization_injectors[quantization_inj_idx]->init_input_scale_shift_ptrs(reg_oc_off);
+                quantization_injectors[quantization_inj_idx]->compute_input_scale_shift(s_idx, s_idx + 1, 0, do_rounding, 0, is_broadcast);
+
+                quantization_injectors[quantization_inj_idx]->init_output_scale_shift_ptrs(reg_oc_off);
+                quantization_injectors[quantization_inj_idx]->compute_output_scale_shift(s_idx, s_idx + 1, 0, 0, is_broadcast);
+
+                quantization_inj_idx++;
+            }
+        }
+    }
+};
 
 bool MKLDNNMatMulNode::isSupportedOperation(const std::shared_ptr<ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
@@ -131,9 +311,21 @@ void MKLDNNMatMulNode::initSupportedPrimitiveDescriptors() {
         }
     }
 
+    setPostOps(attr);
+
+    // gemm result is FP32, other output precisions are produced by the post ops kernel
+    auto outPrec = Precision(Precision::FP32);
+    if (!fusedWith.empty())
+        outPrec = fusedWith[fusedWith.size() - 1]->getOriginalOutputPrecisionAtPort(0);
+    else if (getOriginalOutputPrecisionAtPort(0) == Precision::BF16)
+        outPrec = Precision::BF16;
+    if (!mayiuse(cpu::x64::sse41) || !one_of(outPrec, Precision::FP32, Precision::BF16, Precision::I8, Precision::U8) ||
+        (outPrec == Precision::BF16 && !mayiuse(avx512_core)))
+        outPrec = Precision::FP32;
+
     auto inputDataType0 = MKLDNNExtensionUtils::IEPrecisionToDataType(inPrec0);
     auto inputDataType1 = MKLDNNExtensionUtils::IEPrecisionToDataType(inPrec1);
-    auto outputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(InferenceEngine::Precision::FP32);
+    auto outputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(outPrec);
 
     InferenceEngine::LayerConfig config;
     config.dynBatchSupport = true;
@@ -179,6 +371,57 @@ void MKLDNNMatMulNode::createPrimitive() {
         IE_THROW()  << errorPrefix << " did not allocate input memory";
     if (getSelectedPrimitiveDescriptor() == nullptr)
         IE_THROW()  << errorPrefix << " did not set preferable primitive descriptor";
+
+    const auto outDims = getChildEdgeAt(0)->getDims();
+    const auto outPrec = getChildEdgeAt(0)->getDesc().getPrecision();
+    if (fusedWith.empty() && outPrec == Precision::FP32)
+        return;
+
+    jit_matmul_post_ops_config_params jcp;
+    jcp.dst_prc = outPrec;
+    jcp.work_amount = outDims[xAxis];
+    // channel axis is the column axis only for 2D output, otherwise all elements of a row share the channel
+    jcp.is_broadcast = outDims.ndims() != 2;
+
+    if (mayiuse(cpu::x64::avx512_common)) {
+        postOpsKernel.reset(new jit_uni_matmul_post_ops_kernel_f32<cpu::x64::avx512_common>(jcp, *attr.get()));
+    } else if (mayiuse(cpu::x64::avx2)) {
+        postOpsKernel.reset(new jit_uni_matmul_post_ops_kernel_f32<cpu::x64::avx2>(jcp, *attr.get()));
+    } else if (mayiuse(cpu::x64::sse41)) {
+        postOpsKernel.reset(new jit_uni_matmul_post_ops_kernel_f32<cpu::x64::sse41>(jcp, *attr.get()));
+    } else {
+        IE_THROW() << errorPrefix << " doesn't support fused operations on the current CPU";
+    }
+    postOpsKernel->create_ker();
+
+    gemmBuffer.resize(static_cast<size_t>(parallel_get_max_threads()) * outDims[yAxis] * outDims[xAxis]);
+}
+
+void MKLDNNMatMulNode::setPostOps(mkldnn::primitive_attr &attr) {
+    mkldnn::post_ops ops;
+    for (auto &node : fusedWith) {
+        auto* fakeQuantizeNode = dynamic_cast<MKLDNNFakeQuantizeNode *>(node.get());
+        if (fakeQuantizeNode) {
+            fakeQuantizeNode->appendPostOps(ops);
+            continue;
+        }
+
+        auto* eltwiseNode = dynamic_cast<MKLDNNEltwiseNode *>(node.get());
+        if (eltwiseNode) {
+            eltwiseNode->appendPostOps(ops);
+            continue;
+        }
+        IE_THROW() << "Fusing of " << NameFromType(node->getType()) << " operation to " << NameFromType(this->getType()) << " node is not implemented";
+    }
+    attr.set_post_ops(ops);
+}
+
+bool MKLDNNMatMulNode::canFuse(const MKLDNNNodePtr& node) const {
+    // fused operations are applied by the JIT kernel only
+    if (!mayiuse(cpu::x64::sse41))
+        return false;
+
+    return canFuseSimpleOperation(node);
 }
 
 inline void process_gemm(char transa, char transb, int M, int N, int K, float alpha, const float *A, int lda,
@@ -211,6 +454,9 @@ inline void process_gemm(char transa, char transb, int M, int N, int K, float al
     });
 }
 
+// number of multiply-adds below which a single gemm doesn't scale over all cores
+static constexpr size_t smallGemmSize = 64 * 64 * 64;
+
 template<typename T0, typename T1>
 void MKLDNNMatMulNode::process_data() {
     auto inDims0 = getParentEdgeAt(0)->getDims();
@@ -223,10 +469,12 @@ void MKLDNNMatMulNode::process_data() {
 
     const T0 *src0_ptr = reinterpret_cast<const T0*>(srcMemory0.GetPtr());
     const T1 *src1_ptr = reinterpret_cast<const T1*>(srcMemory1.GetData());
-    float *dst_ptr = reinterpret_cast<float*>(dstMemory0.GetData());
+    uint8_t *dst_ptr = reinterpret_cast<uint8_t*>(dstMemory0.GetData());
+    const size_t dstDataSize = dstMemory0.GetDesc().GetElementSize();
 
-    int MB1 = outDims.ndims() == 4 ? batchToProcess() : 1;
-    int MB2 = outDims.ndims() == 3 ? batchToProcess() : outDims.ndims() > 3 ? outDims[outDims.ndims() - 3] : 1;
+    const int nDims = outDims.ndims();
+    int MB1 = nDims == 4 ? batchToProcess() : 1;
+    int MB2 = nDims == 3 ? batchToProcess() : nDims > 3 ? outDims[nDims - 3] : 1;
     int M = outDims[yAxis];
     int N = outDims[xAxis];
     int K = transposeA ? inDims0[yAxis] : inDims0[xAxis];
@@ -240,22 +488,59 @@ void MKLDNNMatMulNode::process_data() {
 
     beta = 0.f;
 
-    for (int b1 = 0; b1 < MB1; b1++) {
-        const T0 *a_ptr = src0_ptr;
-        const T1 *b_ptr = src1_ptr;
-        float *d_ptr = dst_ptr;
-
-        for (int b2 = 0; b2 < MB2; b2++) {
-            process_gemm(transa, transb, M, N, K, alpha, a_ptr, lda, b_ptr, ldb, beta, d_ptr, ldc);
+    const int batch = MB1 * MB2;
+    const size_t sliceSize = static_cast<size_t>(M) * N;
+
+    auto postOpsRow = [&](int b, const float *c_ptr, int m) {
+        const int b2 = b % MB2;
+        auto arg = jit_matmul_post_ops_call_args();
+        arg.src = c_ptr + m * N;
+        arg.dst = dst_ptr + (b * sliceSize + m * N) * dstDataSize;
+        // channel is the axis 1 of the output
+        arg.oc_off = (nDims == 4 ? b2 : nDims == 3 ? m : 0) * sizeof(float);
+        (*postOpsKernel)(&arg);
+    };
 
-            a_ptr += aOffsets[0];
-            b_ptr += bOffsets[0];
-            d_ptr += M * N;
+    // The post ops are applied to the rows in parallel unless the slices themselves are processed in parallel
+    auto processSlice = [&](int b, float *c_ptr, bool parallelRows) {
+        const int b1 = b / MB2;
+        const int b2 = b % MB2;
+        process_gemm(transa, transb, M, N, K, alpha, src0_ptr + b1 * aOffsets[1] + b2 * aOffsets[0], lda,
+                     src1_ptr + b1 * bOffsets[1] + b2 * bOffsets[0], ldb, beta, c_ptr, ldc);
+        if (!postOpsKernel)
+            return;
+
+        if (parallelRows) {
+            parallel_for(M, [&](int m) {
+                postOpsRow(b, c_ptr, m);
+            });
+        } else {
+            for (int m = 0; m < M; m++)
+                postOpsRow(b, c_ptr, m);
         }
+    };
+
+    auto sliceDst = [&](int b, int ithr) {
+        return postOpsKernel ? &gemmBuffer[ithr * sliceSize] : reinterpret_cast<float*>(dst_ptr) + b * sliceSize;
+    };
 
-        src0_ptr += aOffsets[1];
-        src1_ptr += bOffsets[1];
-        dst_ptr += MB2 * M * N;
+    // Gemm is parallel inside, but small matrices (e.g. attention heads) don't load all cores,
+    // so such batches are split across threads and each slice is computed by a single thread
+    const int nthr = parallel_get_max_threads();
+    const bool parallelBatch = batch > 1 && (batch >= nthr || sliceSize * K <= smallGemmSize);
+    if (parallelBatch) {
+        if (postOpsKernel && gemmBuffer.size() < nthr * sliceSize)
+            gemmBuffer.resize(nthr * sliceSize);
+
+        parallel_nt(nthr, [&](const int ithr, const int nthr_) {
+            int start = 0, end = 0;
+            splitter(batch, nthr_, ithr, start, end);
+            for (int b = start; b < end; b++)
+                processSlice(b, sliceDst(b, ithr), false);
+        });
+    } else {
+        for (int b = 0; b < batch; b++)
+            processSlice(b, sliceDst(b, 0), true);
     }
 }
 
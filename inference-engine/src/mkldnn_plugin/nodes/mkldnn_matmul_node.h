@@ -6,11 +6,42 @@
 
 #include <ie_common.h>
 #include <mkldnn_node.h>
+#include <memory>
 #include <string>
 #include <vector>
 
 namespace MKLDNNPlugin {
 
+struct jit_matmul_post_ops_config_params {
+    InferenceEngine::Precision dst_prc;
+    size_t work_amount;     // number of elements in an output row
+    bool is_broadcast;      // whole row belongs to the same channel
+};
+
+struct jit_matmul_post_ops_call_args {
+    const float *src;
+    void *dst;
+    size_t oc_off;
+};
+
+struct jit_uni_matmul_post_ops_kernel {
+    void (*ker_)(const jit_matmul_post_ops_call_args *);
+
+    void operator()(const jit_matmul_post_ops_call_args *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_matmul_post_ops_kernel(jit_matmul_post_ops_config_params jcp, const mkldnn_primitive_attr &attr)
+        : ker_(nullptr), jcp_(jcp), attr_(attr) {}
+    virtual ~jit_uni_matmul_post_ops_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_matmul_post_ops_config_params jcp_;
+    const mkldnn_primitive_attr &attr_;
+};
+
 class MKLDNNMatMulNode : public MKLDNNNode {
 public:
     MKLDNNMatMulNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
@@ -22,6 +53,7 @@ public:
     void execute(mkldnn::stream strm) override;
     bool created() const override;
     int getMaxBatch() override;
+    bool canFuse(const MKLDNNNodePtr& node) const override;
 
     InferenceEngine::Precision getRuntimePrecision() const override;
 
@@ -42,6 +74,14 @@ private:
 
     template<typename T0, typename T1> void process_data();
 
+    void setPostOps(mkldnn::primitive_attr &attr);
+
+    mkldnn::primitive_attr attr;
+    // converts gemm FP32 result to the output precision and applies fused operations
+    std::shared_ptr<jit_uni_matmul_post_ops_kernel> postOpsKernel;
+    // per thread gemm results, used only together with postOpsKernel
+    std::vector<float> gemmBuffer;
+
     std::string errorPrefix;
 };
 
@@ -92,7 +92,8 @@ bool MKLDNNMemoryInputNode::isSupportedOperation(const std::shared_ptr<const ngr
 }
 
 MKLDNNMemoryInputNode::MKLDNNMemoryInputNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache)
-        : MKLDNNInputNode(op, eng, cache), MKLDNNMemoryNode(op), dataStore(new MKLDNNMemory{eng}) {
+        : MKLDNNInputNode(op, eng, cache), MKLDNNMemoryNode(op), dataStore(new MKLDNNMemory{eng}),
+          currentStore(new MKLDNNMemory{eng}), nextStore(new MKLDNNMemory{eng}) {
     std::string errorMessage;
     if (!isSupportedOperation(op, errorMessage)) {
         IE_THROW(NotImplemented) << errorMessage;
@@ -110,6 +111,8 @@ void MKLDNNMemoryInputNode::createPrimitive() {
 
     // default memory state is zero filled
     dataStore->FillZero();
+    currentStore->Create(mem_desc, dataStore->GetData());
+    nextStore->Create(mem_desc, dataStore->GetData());
 }
 
 /**
@@ -138,19 +141,30 @@ MKLDNNMemoryPtr MKLDNNMemoryInputNode::getStore() {
     return dataStore;
 }
 
+void MKLDNNMemoryInputNode::bindState(void* current, void* next) {
+    currentStore->GetPrimitivePtr()->set_data_handle(current);
+    nextStore->GetPrimitivePtr()->set_data_handle(next);
+}
+
 void MKLDNNMemoryInputNode::storeState(const MKLDNNMemory &new_state) {
+    // the state is already written in place by the producer
+    if (new_state.GetData() == nextStore->GetData())
+        return;
     // TODO: Should be next one call:
-    //           dataStore.SetData(new_state, false);
+    //           nextStore.SetData(new_state, false);
     //       But because of performance reason we use simple manual copy
-    simple_copy(*dataStore, new_state);
+    simple_copy(*nextStore, new_state);
 }
 
 void MKLDNNMemoryInputNode::execute(mkldnn::stream strm) {
     auto dst_mem = getChildEdgeAt(0)->getMemory();
+    // consumers read the state in place
+    if (dst_mem.GetData() == currentStore->GetData())
+        return;
     // TODO: Should be simple call of:
-    //           dst_mem.SetData(dataStore, false);
+    //           dst_mem.SetData(currentStore, false);
     //       But because of performance reason we use simple manual copy
-    simple_copy(dst_mem, *dataStore);
+    simple_copy(dst_mem, *currentStore);
 }
 
 MKLDNNMemoryNodeVirtualEdge::Holder* MKLDNNMemoryNodeVirtualEdge::registerInput(MKLDNNMemoryInputNode * node) {
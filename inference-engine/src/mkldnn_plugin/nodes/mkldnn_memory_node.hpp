@@ -96,8 +96,15 @@ public:
     void setInputNode(MKLDNNNode* node) override {}
     void storeState(const MKLDNNMemory& mem);
     MKLDNNMemoryPtr getStore();
+    /**
+     * @brief Makes the node read the state from the current buffer and store the new state to the next one
+     */
+    void bindState(void* current, void* next);
  private:
     MKLDNNMemoryPtr dataStore;
+    // state buffers used by inference, they share dataStore buffer until other buffers are bound
+    MKLDNNMemoryPtr currentStore;
+    MKLDNNMemoryPtr nextStore;
     MKLDNNMemoryNodeVirtualEdge::Holder* holder = nullptr;
 };
 
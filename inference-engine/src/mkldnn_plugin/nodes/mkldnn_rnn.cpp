@@ -672,7 +672,7 @@ void MKLDNNRNN::createDescriptor(const std::vector<TensorDesc> &inputDesc,
 
 void MKLDNNRNN::createPrimitive() {
     auto pd = descs[0].createPrimitiveDescriptorIterator(getEngine());
-    prim.reset(new mkldnn::primitive(pd));
+    prim = getOrCreatePrimitive<mkldnn::primitive>(pd);
 }
 
 void MKLDNNRNN::execute(mkldnn::stream strm) {
@@ -0,0 +1,223 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_scaled_dot_product_attention_node.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "ie_parallel.hpp"
+#include "ngraph_transformations/op/scaled_dot_product_attention.hpp"
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+constexpr size_t MKLDNNScaledDotProductAttentionNode::queryBlock;
+constexpr size_t MKLDNNScaledDotProductAttentionNode::keyBlock;
+
+bool MKLDNNScaledDotProductAttentionNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        const auto attention = std::dynamic_pointer_cast<const ScaledDotProductAttentionNode>(op);
+        if (!attention) {
+            errorMessage = "Only CPU plugin internal ScaledDotProductAttention operation is supported";
+            return false;
+        }
+        const auto rank = attention->get_input_shape(Q_IDX).size();
+        if (rank != 3 && rank != 4) {
+            errorMessage = "Unsupported rank: " + std::to_string(rank);
+            return false;
+        }
+        if (attention->get_input_size() > MASK_IDX && attention->get_input_shape(MASK_IDX).size() > rank) {
+            errorMessage = "Mask rank is bigger than the rank of the queries";
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+MKLDNNScaledDotProductAttentionNode::MKLDNNScaledDotProductAttentionNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng,
+        MKLDNNWeightsSharing::Ptr &cache) : MKLDNNNode(op, eng, cache) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+
+    errorPrefix = "ScaledDotProductAttention node with name '" + op->get_friendly_name() + "' ";
+    const auto attention = std::dynamic_pointer_cast<const ScaledDotProductAttentionNode>(op);
+    scale = attention->get_scale();
+    transposeK = attention->get_transpose_k();
+    withMask = op->get_input_size() > MASK_IDX;
+
+    const auto qShape = op->get_input_shape(Q_IDX);
+    const auto vShape = op->get_input_shape(V_IDX);
+    const auto rank = qShape.size();
+    if (rank == 4) {
+        D0 = qShape[0];
+        D1 = qShape[1];
+    } else {
+        D1 = qShape[0];
+    }
+    L = qShape[rank - 2];
+    E = qShape[rank - 1];
+    S = vShape[rank - 2];
+    Ev = vShape[rank - 1];
+
+    const auto kShape = op->get_input_shape(K_IDX);
+    if (kShape[rank - 2] != (transposeK ? S : E) || kShape[rank - 1] != (transposeK ? E : S))
+        IE_THROW() << errorPrefix << "has inconsistent shapes of keys and values";
+
+    if (withMask) {
+        // align the mask to [D0, D1, L, S]
+        auto maskShape = op->get_input_shape(MASK_IDX);
+        maskShape.insert(maskShape.begin(), 4 - maskShape.size(), 1lu);
+        const SizeVector dims = {D0, D1, L, S};
+        maskStrides.assign(4, 0lu);
+        size_t stride = 1;
+        for (int i = 3; i >= 0; i--) {
+            if (maskShape[i] != 1 && maskShape[i] != dims[i])
+                IE_THROW() << errorPrefix << "has mask which is not broadcastable to the attention scores";
+            maskStrides[i] = maskShape[i] == 1 ? 0 : stride;
+            stride *= maskShape[i];
+        }
+    }
+}
+
+void MKLDNNScaledDotProductAttentionNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    std::vector<DataConfigurator> inDataConf(getOriginalInputsNumber(), {TensorDescCreatorTypes::ncsp, Precision::FP32});
+    addSupportedPrimDesc(inDataConf, {{TensorDescCreatorTypes::ncsp, Precision::FP32}}, impl_desc_type::gemm_any);
+}
+
+size_t MKLDNNScaledDotProductAttentionNode::scratchSize() const {
+    // scores tile, output accumulator, running maximum and sum of every query
+    return queryBlock * keyBlock + queryBlock * Ev + 2 * queryBlock;
+}
+
+void MKLDNNScaledDotProductAttentionNode::createPrimitive() {
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        auto& srcMemPtr = getParentEdgeAt(i)->getMemoryPtr();
+        if (!srcMemPtr || !srcMemPtr->GetPrimitivePtr())
+            IE_THROW() << errorPrefix << "did not allocate input memory";
+    }
+    auto& dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+    if (!dstMemPtr || !dstMemPtr->GetPrimitivePtr())
+        IE_THROW() << errorPrefix << "did not allocate destination memory";
+    if (getSelectedPrimitiveDescriptor() == nullptr)
+        IE_THROW() << errorPrefix << "did not set preferable primitive descriptor";
+
+    buffer.resize(parallel_get_max_threads() * scratchSize());
+}
+
+void MKLDNNScaledDotProductAttentionNode::attentionBlock(size_t b, size_t l0, size_t lCount, float* scratch) {
+    const float* q = qData + (b * L + l0) * E;
+    const float* k = kData + b * S * E;
+    const float* v = vData + b * S * Ev;
+    float* dst = dstData + (b * L + l0) * Ev;
+
+    float* scores = scratch;
+    float* acc = scores + queryBlock * keyBlock;
+    float* rowMax = acc + queryBlock * Ev;
+    float* rowSum = rowMax + queryBlock;
+
+    std::fill(acc, acc + lCount * Ev, 0.f);
+    std::fill(rowMax, rowMax + lCount, -std::numeric_limits<float>::infinity());
+    std::fill(rowSum, rowSum + lCount, 0.f);
+
+    const int ldScores = static_cast<int>(keyBlock);
+    for (size_t s0 = 0; s0 < S; s0 += keyBlock) {
+        const size_t sCount = std::min(keyBlock, S - s0);
+        if (transposeK) {
+            mkldnn_sgemm('N', 'T', lCount, sCount, E, scale, q, E, k + s0 * E, E, 0.f, scores, ldScores);
+        } else {
+            mkldnn_sgemm('N', 'N', lCount, sCount, E, scale, q, E, k + s0, S, 0.f, scores, ldScores);
+        }
+
+        for (size_t i = 0; i < lCount; i++) {
+            float* row = scores + i * keyBlock;
+            if (withMask) {
+                const float* mask = maskData + (b / D1) * maskStrides[0] + (b % D1) * maskStrides[1] +
+                                    (l0 + i) * maskStrides[2] + s0 * maskStrides[3];
+                const size_t maskStride = maskStrides[3];
+                for (size_t j = 0; j < sCount; j++)
+                    row[j] += mask[j * maskStride];
+            }
+
+            float blockMax = row[0];
+            for (size_t j = 1; j < sCount; j++)
+                blockMax = std::max(blockMax, row[j]);
+            const float newMax = std::max(rowMax[i], blockMax);
+            if (std::isinf(newMax) && newMax < 0) {
+                // all keys seen so far are masked out, they don't contribute to the output
+                std::fill(row, row + sCount, 0.f);
+                continue;
+            }
+
+            float sum = 0.f;
+            for (size_t j = 0; j < sCount; j++) {
+                row[j] = std::exp(row[j] - newMax);
+                sum += row[j];
+            }
+
+            // rescale the previous blocks to the new maximum
+            const float correction = std::exp(rowMax[i] - newMax);
+            rowSum[i] = rowSum[i] * correction + sum;
+            rowMax[i] = newMax;
+            if (correction != 1.f) {
+                float* accRow = acc + i * Ev;
+                for (size_t j = 0; j < Ev; j++)
+                    accRow[j] *= correction;
+            }
+        }
+
+        mkldnn_sgemm('N', 'N', lCount, Ev, sCount, 1.f, scores, ldScores, v + s0 * Ev, Ev, 1.f, acc, Ev);
+    }
+
+    for (size_t i = 0; i < lCount; i++) {
+        const float inv = 1.f / rowSum[i];
+        for (size_t j = 0; j < Ev; j++)
+            dst[i * Ev + j] = acc[i * Ev + j] * inv;
+    }
+}
+
+void MKLDNNScaledDotProductAttentionNode::execute(mkldnn::stream strm) {
+    qData = reinterpret_cast<const float*>(getParentEdgeAt(Q_IDX)->getMemoryPtr()->GetPtr());
+    kData = reinterpret_cast<const float*>(getParentEdgeAt(K_IDX)->getMemoryPtr()->GetPtr());
+    vData = reinterpret_cast<const float*>(getParentEdgeAt(V_IDX)->getMemoryPtr()->GetPtr());
+    maskData = withMask ? reinterpret_cast<const float*>(getParentEdgeAt(MASK_IDX)->getMemoryPtr()->GetPtr()) : nullptr;
+    dstData = reinterpret_cast<float*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+
+    const size_t batch = D0 * D1;
+    const size_t qBlocks = div_up(L, queryBlock);
+    const size_t workAmount = batch * qBlocks;
+
+    const int nthr = parallel_get_max_threads();
+    const size_t blockScratch = scratchSize();
+    if (buffer.size() < nthr * blockScratch)
+        buffer.resize(nthr * blockScratch);
+
+    // every block of queries is computed by one thread, gemms inside are sequential
+    parallel_nt(nthr, [&](const int ithr, const int nthr_) {
+        size_t start = 0, end = 0;
+        splitter(workAmount, nthr_, ithr, start, end);
+        float* scratch = &buffer[ithr * blockScratch];
+        for (size_t iwork = start; iwork < end; iwork++) {
+            const size_t b = iwork / qBlocks;
+            const size_t l0 = (iwork % qBlocks) * queryBlock;
+            attentionBlock(b, l0, std::min(queryBlock, L - l0), scratch);
+        }
+    });
+}
+
+bool MKLDNNScaledDotProductAttentionNode::created() const {
+    return getType() == ScaledDotProductAttention;
+}
+
+REG_MKLDNN_PRIM_FOR(MKLDNNScaledDotProductAttentionNode, ScaledDotProductAttention)
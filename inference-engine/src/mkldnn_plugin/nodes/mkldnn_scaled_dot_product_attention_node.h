@@ -0,0 +1,68 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+#include <string>
+#include <memory>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Computes Softmax(Q * K^T * scale + mask) * V blockwise: a block of queries is multiplied by blocks of
+ * keys and values with an online softmax, so only a [queries block, keys block] tile of scores exists at a time.
+ */
+class MKLDNNScaledDotProductAttentionNode : public MKLDNNNode {
+public:
+    MKLDNNScaledDotProductAttentionNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+
+    static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
+
+private:
+    static constexpr size_t Q_IDX = 0;
+    static constexpr size_t K_IDX = 1;
+    static constexpr size_t V_IDX = 2;
+    static constexpr size_t MASK_IDX = 3;
+
+    // queries and keys processed together, tiles of K, V and scores stay in L2
+    static constexpr size_t queryBlock = 64;
+    static constexpr size_t keyBlock = 256;
+
+    void attentionBlock(size_t b, size_t l0, size_t lCount, float* scratch);
+    size_t scratchSize() const;
+
+    float scale = 1.f;
+    bool transposeK = true;
+    bool withMask = false;
+
+    // leading dimensions of the outputs, for 3D tensors the first one is 1
+    size_t D0 = 1lu, D1 = 1lu;
+    size_t L = 0lu;     // queries
+    size_t S = 0lu;     // keys and values
+    size_t E = 0lu;     // query and key size
+    size_t Ev = 0lu;    // value size
+    // mask strides for [D0, D1, L, S], broadcast dimensions have zero stride
+    std::vector<size_t> maskStrides;
+
+    const float* qData = nullptr;
+    const float* kData = nullptr;
+    const float* vData = nullptr;
+    const float* maskData = nullptr;
+    float* dstData = nullptr;
+
+    std::vector<float> buffer;
+
+    std::string errorPrefix;
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,354 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_snippet_node.h"
+
+#include <ie_parallel.hpp>
+#include <mkldnn_extension_utils.h>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/runtime/host_tensor.hpp>
+
+#include "emitters/cpu_generator.hpp"
+#include "emitters/jit_snippets_emitters.hpp"
+
+#include <string>
+#include <vector>
+#include <numeric>
+#include <algorithm>
+
+using namespace mkldnn;
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+using namespace mkldnn::impl::cpu::x64;
+
+bool MKLDNNSnippetNode::isSupportedOperation(const std::shared_ptr<ngraph::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        const auto subgraph = ngraph::as_type_ptr<ngraph::snippets::op::Subgraph>(op);
+        if (!subgraph) {
+            errorMessage = "Only snippets Subgraph operation is supported";
+            return false;
+        }
+        if (op->get_input_size() + op->get_output_size() > SNIPPETS_MAX_SNIPPETS_DIMS) {
+            errorMessage = "Doesn't support more than " + std::to_string(SNIPPETS_MAX_SNIPPETS_DIMS) + " inputs and outputs";
+            return false;
+        }
+        for (const auto& input : op->inputs()) {
+            if (input.get_element_type() != ngraph::element::f32 || input.get_partial_shape().is_dynamic()) {
+                errorMessage = "Supports only static f32 inputs";
+                return false;
+            }
+        }
+        for (const auto& output : op->outputs()) {
+            if (output.get_element_type() != ngraph::element::f32 || output.get_partial_shape().is_dynamic()) {
+                errorMessage = "Supports only static f32 outputs";
+                return false;
+            }
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+MKLDNNSnippetNode::MKLDNNSnippetNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache)
+        : MKLDNNNode(op, eng, cache) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+
+    host_isa = mayiuse(avx512_common) ? avx512_common : avx2;
+
+    // The subgraph is copied with its own parameters, so the node doesn't keep references to the original function
+    auto original = ngraph::as_type_ptr<ngraph::snippets::op::Subgraph>(op);
+    ngraph::OutputVector subgraphInputs;
+    for (const auto& input : original->input_values()) {
+        subgraphInputs.push_back(std::make_shared<ngraph::opset1::Parameter>(input.get_element_type(), input.get_partial_shape()));
+    }
+    snippet = std::make_shared<ngraph::snippets::op::Subgraph>(subgraphInputs, ngraph::clone_function(*original->get_body()));
+    ngraph::copy_runtime_info(original, snippet);
+    snippet->set_friendly_name(original->get_friendly_name());
+    snippet->set_generator(std::make_shared<CPUGenerator>(host_isa));
+}
+
+void MKLDNNSnippetNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    auto createDataConfig = [](const MKLDNNDims& dims) -> InferenceEngine::DataConfig {
+        InferenceEngine::DataConfig dataConfig;
+        dataConfig.inPlace = -1;
+        dataConfig.constant = false;
+        dataConfig.desc = MKLDNNMemoryDesc(dims, memory::data_type::f32, MKLDNNMemory::GetPlainFormat(dims));
+        return dataConfig;
+    };
+
+    InferenceEngine::LayerConfig config;
+    config.dynBatchSupport = false;
+    for (size_t i = 0; i < inDims.size(); i++)
+        config.inConfs.push_back(createDataConfig(inDims[i]));
+    for (size_t i = 0; i < outDims.size(); i++)
+        config.outConfs.push_back(createDataConfig(outDims[i]));
+
+    // The code is generated here, so performance counters and the execution graph show whether the subgraph
+    // runs the JIT kernel or is interpreted
+    generate();
+    impl_desc_type implType = impl_desc_type::ref;
+    if (schedule.ptr != nullptr) {
+        implType = host_isa == avx512_common ? impl_desc_type::jit_avx512 : impl_desc_type::jit_avx2;
+    } else {
+        prepareInterpretation();
+    }
+
+    supportedPrimitiveDescriptors.push_back({config, implType, memory::format_tag::undef});
+}
+
+void MKLDNNSnippetNode::createPrimitive() {
+}
+
+void MKLDNNSnippetNode::generate() {
+    using BlockedShape = ngraph::snippets::op::Subgraph::BlockedShape;
+
+    auto planar = [](const ngraph::Shape& shape) -> BlockedShape {
+        ngraph::AxisVector order(shape.size());
+        std::iota(order.begin(), order.end(), 0);
+        return std::make_tuple(shape, order, ngraph::element::f32);
+    };
+
+    ngraph::snippets::op::Subgraph::BlockedShapeVector inputShapes;
+    for (size_t i = 0; i < snippet->get_input_size(); i++)
+        inputShapes.push_back(planar(snippet->get_input_shape(i)));
+
+    ngraph::snippets::op::Subgraph::BlockedShapeVector outputShapes;
+    for (size_t i = 0; i < snippet->get_output_size(); i++)
+        outputShapes.push_back(planar(snippet->get_output_shape(i)));
+
+    // Code generation may reject the body (e.g. an operation without emitter or too many live registers),
+    // such a subgraph is still executed correctly by the interpreter
+    try {
+        snippetCanonical = snippet->make_canonical_from_this();
+        schedule = snippetCanonical->generate(outputShapes, inputShapes);
+    } catch (const std::exception&) {
+        snippetCanonical.reset();
+        schedule = ngraph::snippets::Schedule();
+        return;
+    }
+
+    dims_out = schedule.work_size;
+    const size_t rank = dims_out.size();
+
+    std::vector<ngraph::Shape> shapesIn, shapesOut;
+    auto alignRank = [rank](ngraph::Shape shape) {
+        shape.insert(shape.begin(), rank - shape.size(), 1);
+        return shape;
+    };
+    for (size_t i = 0; i < snippet->get_input_size(); i++)
+        shapesIn.push_back(alignRank(snippet->get_input_shape(i)));
+    for (size_t i = 0; i < snippet->get_output_size(); i++)
+        shapesOut.push_back(alignRank(snippet->get_output_shape(i)));
+
+    // Stores always advance the output pointer, so every output must cover the whole most varying dimension
+    for (const auto& shape : shapesOut) {
+        if (shape.back() != dims_out.back()) {
+            snippetCanonical.reset();
+            schedule = ngraph::snippets::Schedule();
+            return;
+        }
+    }
+
+    // Dimensions which are not broadcasted by any of inputs and outputs are collapsed into the most varying one
+    // to give the kernel longer contiguous runs
+    auto isCollapsible = [&](size_t dim) {
+        auto sameAsOut = [&](const ngraph::Shape& shape) { return shape[dim] == dims_out[dim]; };
+        return std::all_of(shapesIn.begin(), shapesIn.end(), sameAsOut) && std::all_of(shapesOut.begin(), shapesOut.end(), sameAsOut);
+    };
+    while (dims_out.size() > 1 && isCollapsible(dims_out.size() - 1) && isCollapsible(dims_out.size() - 2)) {
+        auto collapse = [](std::vector<size_t>& dims) {
+            dims[dims.size() - 2] *= dims[dims.size() - 1];
+            dims.pop_back();
+        };
+        collapse(dims_out);
+        for (auto& shape : shapesIn)
+            collapse(shape);
+        for (auto& shape : shapesOut)
+            collapse(shape);
+    }
+
+    auto getOffsets = [](const ngraph::Shape& shape) {
+        std::vector<size_t> offsets(shape.size(), 0);
+        size_t stride = sizeof(float);
+        for (int d = static_cast<int>(shape.size()) - 1; d >= 0; d--) {
+            offsets[d] = shape[d] == 1 ? 0 : stride;
+            stride *= shape[d];
+        }
+        return offsets;
+    };
+
+    offsets_in.clear();
+    for (const auto& shape : shapesIn)
+        offsets_in.push_back(getOffsets(shape));
+    offsets_out.clear();
+    for (const auto& shape : shapesOut)
+        offsets_out.push_back(getOffsets(shape));
+
+    outerWorkAmount = std::accumulate(dims_out.begin(), dims_out.end() - 1, static_cast<size_t>(1), std::multiplies<size_t>());
+}
+
+void MKLDNNSnippetNode::executeOptimized() {
+    using kernel = void (*)(const jit_snippets_call_args*);
+    const auto callable = schedule.get_callable<kernel>();
+
+    const size_t inputNum = inDims.size();
+    const size_t outputNum = outDims.size();
+
+    std::vector<const uint8_t*> srcPtrs(inputNum);
+    for (size_t i = 0; i < inputNum; i++)
+        srcPtrs[i] = reinterpret_cast<const uint8_t*>(getParentEdgesAtPort(i)[0]->getMemory().GetPtr());
+
+    std::vector<uint8_t*> dstPtrs(outputNum);
+    for (size_t i = 0; i < outputNum; i++)
+        dstPtrs[i] = reinterpret_cast<uint8_t*>(getChildEdgesAtPort(i)[0]->getMemory().GetPtr());
+
+    const size_t outerRank = dims_out.size() - 1;
+    const size_t innerWorkAmount = dims_out.back();
+
+    parallel_for(outerWorkAmount, [&](size_t iwork) {
+        jit_snippets_call_args args;
+        for (size_t i = 0; i < inputNum; i++)
+            args.ptrs[i] = srcPtrs[i];
+        for (size_t i = 0; i < outputNum; i++)
+            args.ptrs[inputNum + i] = dstPtrs[i];
+
+        size_t rest = iwork;
+        for (int d = static_cast<int>(outerRank) - 1; d >= 0; d--) {
+            const size_t idx = rest % dims_out[d];
+            rest /= dims_out[d];
+            for (size_t i = 0; i < inputNum; i++)
+                args.ptrs[i] = reinterpret_cast<const uint8_t*>(args.ptrs[i]) + idx * offsets_in[i][d];
+            for (size_t i = 0; i < outputNum; i++)
+                args.ptrs[inputNum + i] = reinterpret_cast<const uint8_t*>(args.ptrs[inputNum + i]) + idx * offsets_out[i][d];
+        }
+        args.work_amount = innerWorkAmount;
+
+        callable(&args);
+    });
+}
+
+void MKLDNNSnippetNode::prepareInterpretation() {
+    sliceBody.reset();
+    sliceCount = 1;
+
+    // Outputs are split along the outermost dimension which is not 1, every slice is evaluated separately
+    const auto outShape = snippet->get_output_shape(0);
+    for (size_t i = 1; i < snippet->get_output_size(); i++) {
+        if (snippet->get_output_shape(i) != outShape)
+            return;
+    }
+    const size_t rank = outShape.size();
+    size_t axis = 0;
+    while (axis < rank && outShape[axis] == 1)
+        axis++;
+    if (axis == rank)
+        return;
+
+    // Returns the byte stride between slices of the tensor, 0 if the tensor is broadcasted along the axis
+    auto getSliceStride = [&](const ngraph::Shape& shape) -> size_t {
+        if (shape.size() + axis < rank || shape[shape.size() + axis - rank] == 1)
+            return 0;
+        return sizeof(float) * std::accumulate(shape.end() - (rank - axis - 1), shape.end(), static_cast<size_t>(1), std::multiplies<size_t>());
+    };
+    auto getSliceShape = [&](ngraph::Shape shape) {
+        if (shape.size() + axis >= rank)
+            shape[shape.size() + axis - rank] = 1;
+        return shape;
+    };
+
+    // Constants of the body broadcasted along the axis can't be sliced
+    for (const auto& op : snippet->get_body()->get_ops()) {
+        if (ngraph::is_type<ngraph::opset1::Constant>(op) && getSliceStride(op->get_output_shape(0)) != 0)
+            return;
+    }
+
+    try {
+        auto body = ngraph::clone_function(*snippet->get_body());
+        for (const auto& parameter : body->get_parameters()) {
+            if (getSliceStride(parameter->get_shape()) != 0)
+                parameter->set_partial_shape(getSliceShape(parameter->get_shape()));
+        }
+        body->validate_nodes_and_infer_types();
+        for (const auto& result : body->get_results()) {
+            if (result->get_shape() != getSliceShape(outShape))
+                return;
+        }
+        // Builds the topological cache before the body is evaluated concurrently
+        body->get_ordered_ops();
+        sliceBody = body;
+    } catch (const std::exception&) {
+        return;
+    }
+
+    sliceCount = outShape[axis];
+    sliceStridesIn.clear();
+    for (size_t i = 0; i < snippet->get_input_size(); i++)
+        sliceStridesIn.push_back(getSliceStride(snippet->get_input_shape(i)));
+    sliceStridesOut.clear();
+    for (size_t i = 0; i < snippet->get_output_size(); i++)
+        sliceStridesOut.push_back(getSliceStride(snippet->get_output_shape(i)));
+}
+
+void MKLDNNSnippetNode::interpret() {
+    if (!sliceBody) {
+        ngraph::HostTensorVector inputs;
+        for (size_t i = 0; i < inDims.size(); i++) {
+            void *srcDataPtr = getParentEdgesAtPort(i)[0]->getMemory().GetPtr();
+            inputs.push_back(std::make_shared<ngraph::HostTensor>(snippet->get_input_element_type(i), snippet->get_input_shape(i), srcDataPtr));
+        }
+
+        ngraph::HostTensorVector outputs;
+        for (size_t i = 0; i < outDims.size(); i++) {
+            void *dstDataPtr = getChildEdgesAtPort(i)[0]->getMemory().GetPtr();
+            outputs.push_back(std::make_shared<ngraph::HostTensor>(snippet->get_output_element_type(i), snippet->get_output_shape(i), dstDataPtr));
+        }
+
+        if (!snippet->evaluate(outputs, inputs)) {
+            IE_THROW() << "Evaluation failed on node of type: " << std::string(snippet->get_type_name()) << " name: " << getName();
+        }
+        return;
+    }
+
+    const auto& parameters = sliceBody->get_parameters();
+    const auto& results = sliceBody->get_results();
+    parallel_for(sliceCount, [&](size_t slice) {
+        ngraph::HostTensorVector inputs;
+        for (size_t i = 0; i < inDims.size(); i++) {
+            auto srcDataPtr = reinterpret_cast<uint8_t*>(getParentEdgesAtPort(i)[0]->getMemory().GetPtr()) + slice * sliceStridesIn[i];
+            inputs.push_back(std::make_shared<ngraph::HostTensor>(parameters[i]->get_element_type(), parameters[i]->get_shape(), srcDataPtr));
+        }
+
+        ngraph::HostTensorVector outputs;
+        for (size_t i = 0; i < outDims.size(); i++) {
+            auto dstDataPtr = reinterpret_cast<uint8_t*>(getChildEdgesAtPort(i)[0]->getMemory().GetPtr()) + slice * sliceStridesOut[i];
+            outputs.push_back(std::make_shared<ngraph::HostTensor>(results[i]->get_element_type(), results[i]->get_shape(), dstDataPtr));
+        }
+
+        if (!sliceBody->evaluate(outputs, inputs)) {
+            IE_THROW() << "Evaluation failed on node of type: " << std::string(snippet->get_type_name()) << " name: " << getName();
+        }
+    });
+}
+
+void MKLDNNSnippetNode::execute(mkldnn::stream strm) {
+    if (schedule.ptr != nullptr) {
+        executeOptimized();
+    } else {
+        interpret();
+    }
+}
+
+bool MKLDNNSnippetNode::created() const {
+    return getType() == Subgraph;
+}
+
+REG_MKLDNN_PRIM_FOR(MKLDNNSnippetNode, Subgraph);
@@ -0,0 +1,64 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+#include <snippets/op/subgraph.hpp>
+#include <cpu/x64/cpu_isa_traits.hpp>
+
+#include <string>
+#include <vector>
+#include <memory>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Executes a subgraph of elementwise operations tokenized by ngraph::snippets::pass::TokenizeSnippets.
+ * The body is lowered by the snippets passes and compiled into a single JIT kernel which processes all the operations
+ * of the subgraph in one pass over memory. If the code can't be generated the body is interpreted by ngraph reference
+ * in parallel over slices of the outermost dimension, the node reports "ref" implementation then.
+ */
+class MKLDNNSnippetNode : public MKLDNNNode {
+public:
+    MKLDNNSnippetNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+
+    static bool isSupportedOperation(const std::shared_ptr<ngraph::Node>& op, std::string& errorMessage) noexcept;
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+
+private:
+    void generate();
+    void executeOptimized();
+    void prepareInterpretation();
+    void interpret();
+
+    // a copy of the original subgraph with its own parameters, is used for the interpretation
+    std::shared_ptr<ngraph::snippets::op::Subgraph> snippet;
+    // the canonicalized copy of the subgraph, owns the generated code
+    std::shared_ptr<ngraph::snippets::op::Subgraph> snippetCanonical;
+    ngraph::snippets::Schedule schedule;
+
+    mkldnn::impl::cpu::x64::cpu_isa_t host_isa;
+
+    // scheduling domain: the last dimension is processed by the kernel, all the others are iterated in parallel
+    std::vector<size_t> dims_out = {};
+    std::vector<std::vector<size_t>> offsets_in = {};
+    std::vector<std::vector<size_t>> offsets_out = {};
+    size_t outerWorkAmount = 0;
+
+    // interpretation domain: the body reshaped to a slice of the outputs and byte strides between the slices,
+    // sliceBody is null if the subgraph can't be split
+    std::shared_ptr<ngraph::Function> sliceBody;
+    size_t sliceCount = 1;
+    std::vector<size_t> sliceStridesIn = {};
+    std::vector<size_t> sliceStridesOut = {};
+};
+
+}  // namespace MKLDNNPlugin
@@ -81,7 +81,7 @@ void MKLDNNSoftMaxNode::createPrimitive() {
             break;
     }
 
-    prim.reset(new softmax_forward(prim_desc));
+    prim = getOrCreatePrimitive<softmax_forward>(prim_desc);
 
     auto src = getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     auto dst = getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
@@ -2,7 +2,9 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <cmath>
+#include <vector>
 
 #include <ngraph/op/topk.hpp>
 #include "ie_parallel.hpp"
@@ -16,6 +18,10 @@
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 
+// Axis length starting from which the row is processed by the partial sort with the threshold filter
+// instead of the insertion into the sorted list of the best elements
+static constexpr int topk_large_axis_dim = 4096;
+
 bool MKLDNNTopKNode::isSupportedOperation(const std::shared_ptr<ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
         const auto topKOp = ngraph::as_type_ptr<const ngraph::op::v1::TopK>(op);
@@ -148,7 +154,12 @@ void MKLDNNTopKNode::execute(mkldnn::stream strm) {
                 top1_axis<cmplt_ps, std::less>(src, dst_data, dst_idx, in_dims);
         }
     } else {
-        if (is_last_dim) {
+        if (is_last_dim && dim >= topk_large_axis_dim) {
+            if (mode_max)
+                topk_large_axis<cmpgt_ps, std::greater>(src, dst_data, dst_idx);
+            else
+                topk_large_axis<cmplt_ps, std::less>(src, dst_data, dst_idx);
+        } else if (is_last_dim) {
             if (mode_max)
                 topk<std::greater>(src, dst_data, dst_idx, in_dims);
             else
@@ -464,6 +475,114 @@ void MKLDNNTopKNode::topk(const float* src_data, float* dst_data, int* dst_idx,
     });
 }
 
+// Selects the best src_k elements of [start, end) into the unordered list. Elements are ordered by value
+// and then by index, so the result is the same as of the stable sort and doesn't depend on the splitting.
+template <class Compare1, template <typename> class Compare2>
+void MKLDNNTopKNode::topk_select(const float* src_data, int start, int end, std::vector<topk_candidate>& best) {
+    auto better = [](const topk_candidate& a, const topk_candidate& b) {
+        return Compare2<float>()(a.value, b.value) || (a.value == b.value && a.index < b.index);
+    };
+    const size_t k = static_cast<size_t>(src_k);
+    best.clear();
+    best.reserve(2 * k);
+
+    int i = start;
+    for (; i < end && best.size() < k; i++)
+        best.push_back({src_data[i], i});
+    if (i == end)
+        return;
+
+    // Elements are scanned in the order of indexes, so only ones strictly better than the worst selected value
+    // can be selected. Candidates are collected until the buffer is full, then the buffer is cut to the best ones.
+    float threshold = std::max_element(best.begin(), best.end(), better)->value;
+    auto add_candidate = [&](int index) {
+        best.push_back({src_data[index], index});
+        if (best.size() == 2 * k) {
+            std::nth_element(best.begin(), best.begin() + k - 1, best.end(), better);
+            best.resize(k);
+            threshold = best[k - 1].value;
+        }
+    };
+
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    const int vec_end = i + (end - i) / block_size * block_size;
+    for (; i < vec_end; i += block_size) {
+        vmask_type vmask = Compare1::cmp_ps(_mm_uni_loadu_ps(src_data + i), _mm_uni_set1_ps(threshold));
+#if defined(HAVE_AVX512F)
+        int mask = static_cast<int>(vmask);
+#else
+        int mask = _mm_uni_movemask_ps(vmask);
+#endif
+        for (int j = 0; mask != 0; j++, mask >>= 1) {
+            // the threshold may have been raised by the previous elements of the block
+            if ((mask & 1) && Compare2<float>()(src_data[i + j], threshold))
+                add_candidate(i + j);
+        }
+    }
+#endif
+    for (; i < end; i++) {
+        if (Compare2<float>()(src_data[i], threshold))
+            add_candidate(i);
+    }
+}
+
+template <class Compare1, template <typename> class Compare2>
+void MKLDNNTopKNode::topk_large_axis(const float* src_data, float* dst_data, int* dst_idx) {
+    auto better = [](const topk_candidate& a, const topk_candidate& b) {
+        return Compare2<float>()(a.value, b.value) || (a.value == b.value && a.index < b.index);
+    };
+    const size_t k = static_cast<size_t>(src_k);
+
+    auto store = [&](std::vector<topk_candidate>& best, int i0) {
+        if (best.size() > k) {
+            std::nth_element(best.begin(), best.begin() + k - 1, best.end(), better);
+            best.resize(k);
+        }
+        if (sort_value) {
+            std::sort(best.begin(), best.end(), better);
+        } else {
+            std::sort(best.begin(), best.end(), [](const topk_candidate& a, const topk_candidate& b) {
+                return a.index < b.index;
+            });
+        }
+        for (size_t i2 = 0; i2 < k; i2++) {
+            if (dst_data)
+                dst_data[i0 * k + i2] = best[i2].value;
+            if (dst_idx)
+                dst_idx[i0 * k + i2] = best[i2].index;
+        }
+    };
+
+    const int nthr = parallel_get_max_threads();
+    if (before_num >= nthr) {
+        parallel_for(before_num, [&](int i0) {
+            std::vector<topk_candidate> best;
+            topk_select<Compare1, Compare2>(src_data + i0 * dim, 0, dim, best);
+            store(best, i0);
+        });
+        return;
+    }
+
+    // There are not enough rows to load all threads, so each row is split along the axis.
+    // Threads select the best elements of their parts, which are merged afterwards.
+    std::vector<std::vector<topk_candidate>> partial_best(nthr);
+    std::vector<topk_candidate> best;
+    for (int i0 = 0; i0 < before_num; i0++) {
+        const float* row = src_data + i0 * dim;
+        parallel_nt(nthr, [&](const int ithr, const int nthr_) {
+            int start = 0, end = 0;
+            splitter(dim, nthr_, ithr, start, end);
+            topk_select<Compare1, Compare2>(row, start, end, partial_best[ithr]);
+        });
+        best.clear();
+        for (auto& part : partial_best) {
+            best.insert(best.end(), part.begin(), part.end());
+            part.clear();
+        }
+        store(best, i0);
+    }
+}
+
 inline int MKLDNNTopKNode::count(SizeVector dims, size_t start_ind, size_t end_ind) {
     size_t count = 1;
     for (size_t i = start_ind; i < end_ind; i++)
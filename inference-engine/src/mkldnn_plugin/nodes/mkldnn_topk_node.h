@@ -79,7 +79,18 @@ public:
     template<template<typename> class Compare>
     void topk(const float *src_data, float *dst_data, int *dst_idx, InferenceEngine::SizeVector in_dims);
 
+    template<class Compare1, template<typename> class Compare2>
+    void topk_large_axis(const float *src_data, float *dst_data, int *dst_idx);
+
 private:
+    struct topk_candidate {
+        float value;
+        int index;
+    };
+
+    template<class Compare1, template<typename> class Compare2>
+    void topk_select(const float *src_data, int start, int end, std::vector<topk_candidate> &best);
+
     const size_t TOPK_DATA = 0;
     const size_t TOPK_K = 1;
     const size_t TOPK_VALUE = 0;
@@ -0,0 +1,161 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "performance_heuristics.hpp"
+
+#include <algorithm>
+#include <ngraph/opsets/opset1.hpp>
+#include <ie_plugin_config.hpp>
+#include <ie_system_conf.h>
+#include "mkldnn/ie_mkldnn.h"
+#include "ngraph_transformations/op/fully_connected.hpp"
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+// Arithmetic intensity (flops per byte of memory traffic) below which a layer is limited by the memory bandwidth
+// when all cores are busy. Low precision math is faster, so such layers become memory bound earlier.
+constexpr double kBalanceFP32 = 8.0;
+constexpr double kBalanceBF16 = 16.0;
+constexpr double kBalanceINT8 = 32.0;
+
+// Shares of memory bound work which separate compute bound, mixed and memory bound networks
+constexpr double kComputeBoundRatio = 0.1;
+constexpr double kMemoryBoundRatio = 0.5;
+
+// Threads per stream used when the network properties are unknown, the same as CPU_THROUGHPUT_AUTO gives
+constexpr int kDefaultThreadsPerStream = 4;
+
+// Weights are Constants, possibly decompressed or quantized on the way to the layer
+bool isWeights(const ngraph::Output<ngraph::Node>& output) {
+    auto node = output.get_node();
+    for (int depth = 0; depth < 4; depth++) {
+        if (ngraph::is_type<ngraph::opset1::Constant>(node))
+            return true;
+        if (!ngraph::is_type<ngraph::opset1::Convert>(node) &&
+            !ngraph::is_type<ngraph::opset1::FakeQuantize>(node) &&
+            !ngraph::is_type<ngraph::opset1::Subtract>(node) &&
+            !ngraph::is_type<ngraph::opset1::Multiply>(node))
+            return false;
+        node = node->get_input_node_ptr(0);
+    }
+    return false;
+}
+
+// Returns the number of multiply-add operations for a single output element (input element for deconvolutions)
+size_t getReductionSize(const ngraph::Node* op) {
+    const auto& weights = op->get_input_shape(1);
+    if (ngraph::is_type<ngraph::opset1::Convolution>(op) || ngraph::is_type<ngraph::opset1::ConvolutionBackpropData>(op))
+        return ngraph::shape_size(weights) / weights[0];
+    if (ngraph::is_type<ngraph::opset1::GroupConvolution>(op) || ngraph::is_type<ngraph::opset1::GroupConvolutionBackpropData>(op))
+        return ngraph::shape_size(weights) / (weights[0] * weights[1]);
+    if (ngraph::is_type<FullyConnectedNode>(op))
+        return weights[1];
+    if (auto matMul = dynamic_cast<const ngraph::opset1::MatMul*>(op)) {
+        const auto& a = op->get_input_shape(0);
+        if (a.size() == 1)
+            return a[0];
+        return matMul->get_transpose_a() ? a[a.size() - 2] : a.back();
+    }
+    return 0;
+}
+
+}  // namespace
+
+NetworkPerformanceProperties GetNetworkPerformanceProperties(const std::shared_ptr<const ngraph::Function>& function, bool bf16) {
+    NetworkPerformanceProperties props;
+    for (const auto& op : function->get_ordered_ops()) {
+        const bool isDeconvolution = ngraph::is_type<ngraph::opset1::ConvolutionBackpropData>(op) ||
+                                     ngraph::is_type<ngraph::opset1::GroupConvolutionBackpropData>(op);
+        if (!isDeconvolution &&
+            !ngraph::is_type<ngraph::opset1::Convolution>(op) &&
+            !ngraph::is_type<ngraph::opset1::GroupConvolution>(op) &&
+            !ngraph::is_type<ngraph::opset1::MatMul>(op) &&
+            !ngraph::is_type<FullyConnectedNode>(op))
+            continue;
+        if (op->is_dynamic() || op->get_input_partial_shape(1).is_dynamic())
+            continue;
+
+        const size_t inputSize = ngraph::shape_size(op->get_input_shape(0));
+        const size_t weightsSize = ngraph::shape_size(op->get_input_shape(1));
+        const size_t outputSize = ngraph::shape_size(op->get_output_shape(0));
+        const double flops = 2.0 * (isDeconvolution ? inputSize : outputSize) * getReductionSize(op.get());
+
+        // Layers with quantized activations are executed in INT8
+        size_t elementSize = 4;
+        double balance = kBalanceFP32;
+        if (ngraph::is_type<ngraph::opset1::FakeQuantize>(op->get_input_node_ptr(0))) {
+            elementSize = 1;
+            balance = kBalanceINT8;
+        } else if (bf16) {
+            elementSize = 2;
+            balance = kBalanceBF16;
+        }
+
+        const bool constWeights = isWeights(op->input_value(1));
+        const double bytes = static_cast<double>(inputSize + outputSize + weightsSize) * elementSize;
+        props.totalFlops += flops;
+        if (bytes > 0 && flops / bytes < balance)
+            props.memoryBoundFlops += flops;
+        if (constWeights)
+            props.weightsSize += weightsSize * elementSize;
+    }
+    return props;
+}
+
+void ApplyPerformanceHints(Config& config, const std::shared_ptr<const ngraph::Function>& function) {
+    using namespace InferenceEngine;
+    if (config.perfHint.empty() || config.streamsExplicitlySet)
+        return;
+
+    auto& executorConfig = config.streamExecutorConfig;
+    const int sockets = std::max(1, static_cast<int>(getAvailableNUMANodes().size()));
+    if (config.perfHint == PluginConfigParams::LATENCY) {
+        // A single stream per NUMA node, so the request uses all cores of the node
+        executorConfig._streams = sockets;
+    } else {
+        const auto props = GetNetworkPerformanceProperties(function, config.enforceBF16);
+        const int cores = executorConfig._threads ? executorConfig._threads : getNumberOfCPUCores();
+
+        // Compute bound networks scale best with independent single threaded streams, while memory bound ones
+        // only compete for the memory bandwidth, so they get fewer streams
+        int threadsPerStream = kDefaultThreadsPerStream;
+        if (props.totalFlops > 0) {
+            const auto memoryBoundRatio = props.memoryBoundRatio();
+            if (memoryBoundRatio <= kComputeBoundRatio)
+                threadsPerStream = 1;
+            else if (memoryBoundRatio <= kMemoryBoundRatio)
+                threadsPerStream = 2;
+        }
+
+        // Every stream reads all weights. If they fit into L3, the stream should be wide enough to keep them in its L2 caches,
+        // otherwise the weights come from the memory anyway.
+        const auto l2 = static_cast<size_t>(std::max(1, mkldnn::utils::get_cache_size(2, true)));
+        const auto l3 = static_cast<size_t>(std::max(0, mkldnn::utils::get_cache_size(3, false)));
+        if (props.weightsSize <= l3) {
+            while (threadsPerStream < kDefaultThreadsPerStream && props.weightsSize > l2 * threadsPerStream)
+                threadsPerStream *= 2;
+        }
+        threadsPerStream = std::min(threadsPerStream, std::max(1, cores / sockets));
+
+        // Streams are distributed evenly between NUMA nodes
+        int streams = std::max(1, cores / threadsPerStream);
+        if (streams > sockets)
+            streams -= streams % sockets;
+        const bool limitedByRequests = config.perfHintNumRequests > 0 && config.perfHintNumRequests < streams;
+        if (limitedByRequests)
+            streams = config.perfHintNumRequests;
+
+        executorConfig._streams = streams;
+        // Only physical cores are used, streams limited by the number of requests share all of them
+        if (executorConfig._threads == 0)
+            executorConfig._threads = limitedByRequests ? cores : streams * threadsPerStream;
+    }
+
+    config._config.clear();
+    config.updateProperties();
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,38 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <ngraph/function.hpp>
+#include "config.h"
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Properties of the network which define how well it scales over streams
+ */
+struct NetworkPerformanceProperties {
+    double totalFlops = 0;          //!< Operations of convolutions and matrix multiplications
+    double memoryBoundFlops = 0;    //!< Part of totalFlops done by layers limited by the memory bandwidth
+    size_t weightsSize = 0;         //!< Size of constant weights of these layers in bytes
+
+    double memoryBoundRatio() const {
+        return totalFlops > 0 ? memoryBoundFlops / totalFlops : 0;
+    }
+};
+
+/**
+ * @brief Estimates the arithmetic intensity of compute heavy layers of the network
+ * @param function The network, layers with dynamic shapes are skipped
+ * @param bf16 Floating point layers are executed in BF16
+ */
+NetworkPerformanceProperties GetNetworkPerformanceProperties(const std::shared_ptr<const ngraph::Function>& function, bool bf16);
+
+/**
+ * @brief Resolves PERFORMANCE_HINT into the number of streams and threads unless streams are set explicitly
+ */
+void ApplyPerformanceHints(Config& config, const std::shared_ptr<const ngraph::Function>& function);
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,931 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "serialize.hpp"
+
+#include <ie_common.h>
+#include <ie_blob.h>
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset4.hpp>
+#include <ngraph/opsets/opset5.hpp>
+#include <ngraph/opsets/opset6.hpp>
+#include <ngraph/op/util/sub_graph_base.hpp>
+#include <ngraph/variant.hpp>
+#include <ngraph_ops/type_relaxed.hpp>
+#include <ngraph_ops/nms_ie_internal.hpp>
+#include <transformations/rt_info/dequantization_attribute.hpp>
+#include <transformations/rt_info/fused_names_attribute.hpp>
+#include <transformations/rt_info/primitives_priority_attribute.hpp>
+
+#include "ngraph_transformations/op/fully_connected.hpp"
+#include "ngraph_transformations/op/leaky_relu.hpp"
+#include "ngraph_transformations/op/power_static.hpp"
+#include "ngraph_transformations/op/scaled_dot_product_attention.hpp"
+#include "ngraph_transformations/op/swish_cpu.hpp"
+#include "utils/rt_info/memory_formats_attribute.hpp"
+
+#include <cstring>
+#include <functional>
+#include <set>
+#include <sstream>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+using namespace InferenceEngine;
+
+namespace MKLDNNPlugin {
+namespace {
+
+constexpr uint32_t networkMagic = 0x4e55504d;     // "MPUN"
+constexpr uint32_t networkVersion = 1;
+
+class BinaryWriter {
+public:
+    explicit BinaryWriter(std::ostream & stream) : _stream(stream) {}
+
+    template <typename T>
+    typename std::enable_if<std::is_arithmetic<T>::value>::type write(const T & value) {
+        _stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    void write(const std::string & value) {
+        write<uint64_t>(value.size());
+        _stream.write(value.data(), value.size());
+    }
+
+    template <typename T>
+    void write(const std::vector<T> & values) {
+        write<uint64_t>(values.size());
+        for (const auto & value : values)
+            write(value);
+    }
+
+    void write(const ngraph::element::Type & type) {
+        write<uint32_t>(static_cast<uint32_t>(static_cast<ngraph::element::Type_t>(type)));
+    }
+
+    void write(const ngraph::PartialShape & shape) {
+        write<uint8_t>(shape.rank().is_static());
+        if (shape.rank().is_dynamic())
+            return;
+        write<uint64_t>(shape.rank().get_length());
+        for (const auto & dim : shape) {
+            write<int64_t>(dim.get_min_length());
+            write<int64_t>(dim.get_max_length());
+        }
+    }
+
+    void writeBytes(const void * data, size_t size) {
+        write<uint64_t>(size);
+        _stream.write(static_cast<const char*>(data), size);
+    }
+
+private:
+    std::ostream & _stream;
+};
+
+class BinaryReader {
+public:
+    explicit BinaryReader(std::istream & stream) : _stream(stream) {}
+
+    template <typename T>
+    typename std::enable_if<std::is_arithmetic<T>::value>::type read(T & value) {
+        readRaw(&value, sizeof(T));
+    }
+
+    template <typename T>
+    T read() {
+        T value;
+        read(value);
+        return value;
+    }
+
+    void read(std::string & value) {
+        value.resize(read<uint64_t>());
+        readRaw(&value[0], value.size());
+    }
+
+    template <typename T>
+    void read(std::vector<T> & values) {
+        values.resize(read<uint64_t>());
+        for (size_t i = 0; i < values.size(); i++) {
+            T value;
+            read(value);
+            values[i] = value;
+        }
+    }
+
+    void read(ngraph::element::Type & type) {
+        type = ngraph::element::Type(static_cast<ngraph::element::Type_t>(read<uint32_t>()));
+    }
+
+    void read(ngraph::PartialShape & shape) {
+        if (!read<uint8_t>()) {
+            shape = ngraph::PartialShape::dynamic();
+            return;
+        }
+        std::vector<ngraph::Dimension> dims(read<uint64_t>());
+        for (auto & dim : dims) {
+            const auto minLength = read<int64_t>();
+            const auto maxLength = read<int64_t>();
+            dim = ngraph::Dimension(minLength, maxLength);
+        }
+        shape = ngraph::PartialShape(dims);
+    }
+
+    void readBytes(void * data, size_t size) {
+        if (read<uint64_t>() != size)
+            IE_THROW() << "Unexpected size of binary data in the imported network";
+        readRaw(data, size);
+    }
+
+    void readRaw(void * data, size_t size) {
+        _stream.read(static_cast<char*>(data), size);
+        if (!_stream.good())
+            IE_THROW() << "Unexpected end of the imported network stream";
+    }
+
+private:
+    std::istream & _stream;
+};
+
+/**
+ * Operations are looked up by the opset name written next to the type name. Type relaxed operations share
+ * type info with their original operations, so they are restored by ngraph::op::TypeRelaxedRegistration,
+ * where every type relaxed operation instantiated by the transformations is registered.
+ */
+struct OpsetRegistry {
+    explicit OpsetRegistry(const std::map<std::string, ngraph::OpSet>& extensionOpsets) {
+        opsets.emplace_back("opset1", ngraph::get_opset1());
+        opsets.emplace_back("opset2", ngraph::get_opset2());
+        opsets.emplace_back("opset3", ngraph::get_opset3());
+        opsets.emplace_back("opset4", ngraph::get_opset4());
+        opsets.emplace_back("opset5", ngraph::get_opset5());
+        opsets.emplace_back("opset6", ngraph::get_opset6());
+        opsets.emplace_back("opset7", ngraph::get_opset7());
+        opsets.emplace_back("opset8", ngraph::get_opset8());
+
+        ngraph::OpSet cpuOpset;
+        cpuOpset.insert<FullyConnectedNode>();
+        cpuOpset.insert<LeakyReluNode>();
+        cpuOpset.insert<PowerStaticNode>();
+        cpuOpset.insert<SwishNode>();
+        cpuOpset.insert<ScaledDotProductAttentionNode>();
+        opsets.emplace_back("cpu_plugin_opset", cpuOpset);
+
+        ngraph::OpSet ieInternalOpset;
+        ieInternalOpset.insert<ngraph::op::internal::NonMaxSuppressionIEInternal>();
+        opsets.emplace_back("ie_internal_opset", ieInternalOpset);
+
+        for (const auto& opset : extensionOpsets)
+            opsets.emplace_back(opset.first, opset.second);
+    }
+
+    const std::string & getOpsetName(const ngraph::Node * node) const {
+        for (const auto & opset : opsets) {
+            if (opset.second.contains_op_type(node))
+                return opset.first;
+        }
+        IE_THROW(NotImplemented) << "Operation " << node->get_type_name() << " with name " << node->get_friendly_name()
+                                 << " doesn't belong to any known opset";
+    }
+
+    bool hasTypeRelaxed(const ngraph::NodeTypeInfo & typeInfo) const {
+        return ngraph::op::TypeRelaxedRegistration::is_registered(typeInfo);
+    }
+
+    std::shared_ptr<ngraph::Node> create(const std::string & opsetName, const std::string & typeName, uint64_t version) const {
+        std::shared_ptr<ngraph::Node> node;
+        if (opsetName == typeRelaxedOpsetName) {
+            node = ngraph::op::TypeRelaxedRegistration::create(ngraph::NodeTypeInfo{typeName.c_str(), version});
+        } else {
+            for (const auto & opset : opsets) {
+                if (opset.first == opsetName) {
+                    node.reset(opset.second.create_insensitive(typeName));
+                    break;
+                }
+            }
+        }
+        if (!node)
+            IE_THROW() << "Cannot create operation " << typeName << " from " << opsetName << " for the imported network";
+        return node;
+    }
+
+    static constexpr const char * typeRelaxedOpsetName = "type_relaxed_opset";
+
+    std::vector<std::pair<std::string, ngraph::OpSet>> opsets;
+};
+
+constexpr const char * OpsetRegistry::typeRelaxedOpsetName;
+
+using Attributes = std::map<std::string, std::string>;
+
+class FunctionWriter;
+class FunctionReader;
+
+class AttributeWriter : public ngraph::AttributeVisitor {
+public:
+    AttributeWriter(Attributes & attributes, FunctionWriter & functionWriter)
+        : _attributes(attributes), _functionWriter(functionWriter) {}
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) override;
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::shared_ptr<ngraph::Function>>& adapter) override;
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::string>& adapter) override { put(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<bool>& adapter) override { put<uint8_t>(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int8_t>& adapter) override { put(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int16_t>& adapter) override { put(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int32_t>& adapter) override { put(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int64_t>& adapter) override { put(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint8_t>& adapter) override { put(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint16_t>& adapter) override { put(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint32_t>& adapter) override { put(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint64_t>& adapter) override { put(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<float>& adapter) override { put(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<double>& adapter) override { put(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int8_t>>& adapter) override { put(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int16_t>>& adapter) override { put(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int32_t>>& adapter) override { put(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int64_t>>& adapter) override { put(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint8_t>>& adapter) override { put(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint16_t>>& adapter) override { put(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint32_t>>& adapter) override { put(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint64_t>>& adapter) override { put(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<float>>& adapter) override { put(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<double>>& adapter) override { put(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::string>>& adapter) override { put(name, adapter.get()); }
+
+private:
+    template <typename T>
+    void put(const std::string & name, const T & value) {
+        std::ostringstream stream;
+        BinaryWriter(stream).write(value);
+        _attributes[name] = stream.str();
+    }
+
+    Attributes & _attributes;
+    FunctionWriter & _functionWriter;
+};
+
+class AttributeReader : public ngraph::AttributeVisitor {
+public:
+    AttributeReader(const Attributes & attributes, FunctionReader & functionReader)
+        : _attributes(attributes), _functionReader(functionReader) {}
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) override;
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::shared_ptr<ngraph::Function>>& adapter) override;
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::string>& adapter) override { get(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<bool>& adapter) override {
+        uint8_t value = 0;
+        if (get(name, value))
+            adapter.set(value != 0);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int8_t>& adapter) override { get(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int16_t>& adapter) override { get(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int32_t>& adapter) override { get(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int64_t>& adapter) override { get(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint8_t>& adapter) override { get(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint16_t>& adapter) override { get(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint32_t>& adapter) override { get(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint64_t>& adapter) override { get(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<float>& adapter) override { get(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<double>& adapter) override { get(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int8_t>>& adapter) override { get(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int16_t>>& adapter) override { get(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int32_t>>& adapter) override { get(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int64_t>>& adapter) override { get(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint8_t>>& adapter) override { get(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint16_t>>& adapter) override { get(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint32_t>>& adapter) override { get(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint64_t>>& adapter) override { get(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<float>>& adapter) override { get(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<double>>& adapter) override { get(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::string>>& adapter) override { get(name, adapter); }
+
+private:
+    template <typename T>
+    bool get(const std::string & name, T & value) {
+        const auto it = _attributes.find(name);
+        if (it == _attributes.end())
+            return false;
+        std::istringstream stream(it->second);
+        BinaryReader(stream).read(value);
+        return true;
+    }
+
+    template <typename T>
+    void get(const std::string & name, ngraph::ValueAccessor<T>& adapter) {
+        T value;
+        if (get(name, value))
+            adapter.set(value);
+    }
+
+    const Attributes & _attributes;
+    FunctionReader & _functionReader;
+};
+
+enum RuntimeInfoKind : uint8_t { String, Int64, FusedNames, PrimitivesPriority, Dequantization, InputMemoryFormats, OutputMemoryFormats };
+using RuntimeInfoEntry = std::pair<uint8_t, std::string>;
+
+bool toRuntimeInfoEntry(const std::shared_ptr<ngraph::Variant> & attr, RuntimeInfoEntry & entry) {
+    if (auto value = std::dynamic_pointer_cast<ngraph::VariantWrapper<std::string>>(attr)) {
+        entry = {String, value->get()};
+    } else if (auto value = std::dynamic_pointer_cast<ngraph::VariantWrapper<int64_t>>(attr)) {
+        entry = {Int64, std::to_string(value->get())};
+    } else if (auto value = std::dynamic_pointer_cast<ngraph::VariantWrapper<ngraph::FusedNames>>(attr)) {
+        entry = {FusedNames, value->get().getNames()};
+    } else if (auto value = std::dynamic_pointer_cast<ngraph::VariantWrapper<ngraph::PrimitivesPriority>>(attr)) {
+        entry = {PrimitivesPriority, value->get().getPrimitivesPriority()};
+    } else if (auto value = std::dynamic_pointer_cast<ngraph::VariantWrapper<ngraph::DequantizationAttr>>(attr)) {
+        entry = {Dequantization, value->get().getDequantizationAttr()};
+    } else if (auto value = std::dynamic_pointer_cast<ngraph::VariantWrapper<ngraph::MLKDNNInputMemoryFormats>>(attr)) {
+        entry = {InputMemoryFormats, value->get().getMemoryFormats()};
+    } else if (auto value = std::dynamic_pointer_cast<ngraph::VariantWrapper<ngraph::MLKDNNOutputMemoryFormats>>(attr)) {
+        entry = {OutputMemoryFormats, value->get().getMemoryFormats()};
+    } else {
+        return false;
+    }
+    return true;
+}
+
+/**
+ * The runtime info read by the CPU graph: the network with such an attribute of a type which can't be written
+ * is not exported. Other attributes (e.g. the low precision transformations ones) are used by the transformation
+ * pipeline only, which is not applied to the imported network, so they are skipped.
+ */
+bool isGraphRuntimeInfo(const std::string & name) {
+    static const std::set<std::string> graphRuntimeInfo = {
+        "originalLayersNames",
+        "seqAxis",
+        ngraph::VariantWrapper<ngraph::FusedNames>::type_info.name,
+        ngraph::VariantWrapper<ngraph::PrimitivesPriority>::type_info.name,
+        ngraph::VariantWrapper<ngraph::DequantizationAttr>::type_info.name,
+        ngraph::VariantWrapper<ngraph::MLKDNNInputMemoryFormats>::type_info.name,
+        ngraph::VariantWrapper<ngraph::MLKDNNOutputMemoryFormats>::type_info.name,
+    };
+    return graphRuntimeInfo.count(name) != 0;
+}
+
+std::vector<std::pair<std::string, RuntimeInfoEntry>> toRuntimeInfoEntries(const ngraph::Node & node) {
+    std::vector<std::pair<std::string, RuntimeInfoEntry>> entries;
+    for (const auto & item : node.get_rt_info()) {
+        RuntimeInfoEntry entry;
+        if (toRuntimeInfoEntry(item.second, entry))
+            entries.push_back({item.first, entry});
+        else if (isGraphRuntimeInfo(item.first))
+            IE_THROW(NotImplemented) << "Runtime info " << item.first << " of operation " << node.get_friendly_name()
+                                     << " can't be exported";
+    }
+    return entries;
+}
+
+void writeRuntimeInfo(BinaryWriter & writer, const ngraph::Node & node) {
+    const auto entries = toRuntimeInfoEntries(node);
+    writer.write<uint64_t>(entries.size());
+    for (const auto & entry : entries) {
+        writer.write(entry.first);
+        writer.write(entry.second.first);
+        writer.write(entry.second.second);
+    }
+}
+
+void readRuntimeInfo(BinaryReader & reader, ngraph::Node::RTMap & rtInfo) {
+    const auto count = reader.read<uint64_t>();
+    for (uint64_t i = 0; i < count; i++) {
+        std::string name, value;
+        reader.read(name);
+        const auto kind = reader.read<uint8_t>();
+        reader.read(value);
+
+        std::shared_ptr<ngraph::Variant> attr;
+        switch (kind) {
+        case String:
+            attr = std::make_shared<ngraph::VariantWrapper<std::string>>(value);
+            break;
+        case Int64:
+            attr = std::make_shared<ngraph::VariantWrapper<int64_t>>(std::stoll(value));
+            break;
+        case FusedNames: {
+            ngraph::FusedNames fusedNames;
+            std::istringstream names(value);
+            std::string fusedName;
+            while (getline(names, fusedName, ','))
+                fusedNames.fuseWith(ngraph::FusedNames(fusedName));
+            attr = std::make_shared<ngraph::VariantWrapper<ngraph::FusedNames>>(fusedNames);
+            break;
+        }
+        case PrimitivesPriority:
+            attr = std::make_shared<ngraph::VariantWrapper<ngraph::PrimitivesPriority>>(ngraph::PrimitivesPriority(value));
+            break;
+        case Dequantization:
+            attr = std::make_shared<ngraph::VariantWrapper<ngraph::DequantizationAttr>>(ngraph::DequantizationAttr(value));
+            break;
+        case InputMemoryFormats:
+            attr = std::make_shared<ngraph::VariantWrapper<ngraph::MLKDNNInputMemoryFormats>>(ngraph::MLKDNNInputMemoryFormats(value));
+            break;
+        case OutputMemoryFormats:
+            attr = std::make_shared<ngraph::VariantWrapper<ngraph::MLKDNNOutputMemoryFormats>>(ngraph::MLKDNNOutputMemoryFormats(value));
+            break;
+        default:
+            IE_THROW() << "Unknown runtime info attribute " << name << " in the imported network";
+        }
+        rtInfo[name] = attr;
+    }
+}
+
+class FunctionWriter {
+public:
+    explicit FunctionWriter(const OpsetRegistry & registry) : _registry(registry) {}
+
+    void write(BinaryWriter & writer, const std::shared_ptr<const ngraph::Function> & function) {
+        const auto ops = function->get_ordered_ops();
+        std::unordered_map<const ngraph::Node*, uint64_t> opIndices;
+        for (const auto & op : ops)
+            opIndices.emplace(op.get(), opIndices.size());
+
+        writer.write(function->get_friendly_name());
+        writer.write<uint64_t>(ops.size());
+        for (const auto & op : ops)
+            writeNode(writer, op, opIndices);
+
+        const auto writeIndices = [&](const std::vector<std::shared_ptr<ngraph::Node>> & nodes) {
+            writer.write<uint64_t>(nodes.size());
+            for (const auto & node : nodes)
+                writer.write(opIndices.at(node.get()));
+        };
+        const auto & parameters = function->get_parameters();
+        const auto & results = function->get_results();
+        const auto & sinks = function->get_sinks();
+        writeIndices(ngraph::NodeVector(parameters.begin(), parameters.end()));
+        writeIndices(ngraph::NodeVector(results.begin(), results.end()));
+        writeIndices(ngraph::NodeVector(sinks.begin(), sinks.end()));
+
+        writer.write<uint64_t>(function->get_variables().size());
+        for (const auto & variable : function->get_variables())
+            writeVariable(writer, variable);
+    }
+
+    /**
+     * Checks the function can be written before anything is written, so the network which can't be exported
+     * fails fast with NotImplemented instead of leaving a partially written stream.
+     */
+    void checkSupported(const std::shared_ptr<const ngraph::Function> & function) const {
+        for (const auto & op : function->get_ordered_ops()) {
+            getOpsetName(op);
+            toRuntimeInfoEntries(*op);
+            if (const auto subGraph = std::dynamic_pointer_cast<ngraph::op::util::SubGraphOp>(op))
+                checkSupported(subGraph->get_function());
+        }
+    }
+
+    void writeVariable(BinaryWriter & writer, const std::shared_ptr<ngraph::Variable> & variable) {
+        const auto & info = variable->get_info();
+        writer.write(info.variable_id);
+        writer.write(info.data_type);
+        writer.write(info.data_shape);
+    }
+
+private:
+    void writeNode(BinaryWriter & writer,
+                   const std::shared_ptr<ngraph::Node> & op,
+                   const std::unordered_map<const ngraph::Node*, uint64_t> & opIndices) {
+        const auto & typeInfo = op->get_type_info();
+        const auto typeRelaxed = std::dynamic_pointer_cast<ngraph::op::TypeRelaxedBase>(op);
+
+        writer.write(getOpsetName(op));
+        writer.write(std::string(typeInfo.name));
+        writer.write<uint64_t>(typeInfo.version);
+        writer.write(op->get_friendly_name());
+
+        writer.write<uint64_t>(op->get_input_size());
+        for (const auto & input : op->inputs()) {
+            const auto source = input.get_source_output();
+            writer.write(opIndices.at(source.get_node()));
+            writer.write<uint64_t>(source.get_index());
+        }
+        writer.write<uint64_t>(op->get_control_dependencies().size());
+        for (const auto & dependency : op->get_control_dependencies())
+            writer.write(opIndices.at(dependency.get()));
+
+        writer.write<uint64_t>(op->get_output_size());
+        for (const auto & output : op->outputs()) {
+            const auto & tensor = output.get_tensor();
+            writer.write(std::vector<std::string>(tensor.get_names().begin(), tensor.get_names().end()));
+            NGRAPH_SUPPRESS_DEPRECATED_START
+            writer.write(tensor.get_name());
+            NGRAPH_SUPPRESS_DEPRECATED_END
+        }
+
+        if (typeRelaxed) {
+            writer.write<uint64_t>(op->get_input_size());
+            for (size_t i = 0; i < op->get_input_size(); i++)
+                writer.write(typeRelaxed->get_origin_input_type(i));
+            writer.write<uint64_t>(op->get_output_size());
+            for (size_t i = 0; i < op->get_output_size(); i++)
+                writer.write(typeRelaxed->get_overridden_output_type(i));
+        }
+
+        Attributes attributes;
+        AttributeWriter visitor(attributes, *this);
+        if (!op->visit_attributes(visitor))
+            IE_THROW(NotImplemented) << "Operation " << op->get_friendly_name() << " doesn't support attributes visiting";
+        writer.write<uint64_t>(attributes.size());
+        for (const auto & attribute : attributes) {
+            writer.write(attribute.first);
+            writer.write(attribute.second);
+        }
+
+        writeRuntimeInfo(writer, *op);
+    }
+
+    std::string getOpsetName(const std::shared_ptr<ngraph::Node> & op) const {
+        if (!std::dynamic_pointer_cast<ngraph::op::TypeRelaxedBase>(op))
+            return _registry.getOpsetName(op.get());
+        if (!_registry.hasTypeRelaxed(op->get_type_info()))
+            IE_THROW(NotImplemented) << "Type relaxed operation " << op->get_type_info().name << " is not supported for export";
+        return OpsetRegistry::typeRelaxedOpsetName;
+    }
+
+    const OpsetRegistry & _registry;
+};
+
+class FunctionReader {
+public:
+    explicit FunctionReader(const OpsetRegistry & registry) : _registry(registry) {}
+
+    std::shared_ptr<ngraph::Function> read(BinaryReader & reader) {
+        std::string name;
+        reader.read(name);
+
+        std::vector<std::shared_ptr<ngraph::Node>> ops(reader.read<uint64_t>());
+        for (auto & op : ops)
+            op = readNode(reader, ops);
+
+        const auto readNodes = [&](std::function<void(const std::shared_ptr<ngraph::Node>&)> append) {
+            const auto count = reader.read<uint64_t>();
+            for (uint64_t i = 0; i < count; i++)
+                append(ops.at(reader.read<uint64_t>()));
+        };
+        ngraph::ParameterVector parameters;
+        ngraph::ResultVector results;
+        ngraph::SinkVector sinks;
+        readNodes([&](const std::shared_ptr<ngraph::Node> & node) {
+            parameters.push_back(ngraph::as_type_ptr<ngraph::op::Parameter>(node));
+        });
+        readNodes([&](const std::shared_ptr<ngraph::Node> & node) {
+            results.push_back(ngraph::as_type_ptr<ngraph::op::Result>(node));
+        });
+        readNodes([&](const std::shared_ptr<ngraph::Node> & node) {
+            sinks.push_back(std::dynamic_pointer_cast<ngraph::op::Sink>(node));
+        });
+
+        ngraph::VariableVector variables(reader.read<uint64_t>());
+        for (auto & variable : variables)
+            variable = readVariable(reader);
+
+        auto function = std::make_shared<ngraph::Function>(results, sinks, parameters, variables, name);
+        function->validate_nodes_and_infer_types();
+        return function;
+    }
+
+    std::shared_ptr<ngraph::Variable> readVariable(BinaryReader & reader) {
+        ngraph::VariableInfo info;
+        reader.read(info.variable_id);
+        reader.read(info.data_type);
+        reader.read(info.data_shape);
+
+        auto & variable = _variables[info.variable_id];
+        if (!variable)
+            variable = std::make_shared<ngraph::Variable>(info);
+        return variable;
+    }
+
+private:
+    std::shared_ptr<ngraph::Node> readNode(BinaryReader & reader, const std::vector<std::shared_ptr<ngraph::Node>> & ops) {
+        std::string opsetName, typeName, friendlyName;
+        reader.read(opsetName);
+        reader.read(typeName);
+        const auto version = reader.read<uint64_t>();
+        reader.read(friendlyName);
+
+        ngraph::OutputVector inputs(reader.read<uint64_t>());
+        for (auto & input : inputs) {
+            const auto & source = ops.at(reader.read<uint64_t>());
+            input = source->output(reader.read<uint64_t>());
+        }
+        std::vector<std::shared_ptr<ngraph::Node>> dependencies(reader.read<uint64_t>());
+        for (auto & dependency : dependencies)
+            dependency = ops.at(reader.read<uint64_t>());
+
+        std::vector<std::pair<std::vector<std::string>, std::string>> outputNames(reader.read<uint64_t>());
+        for (auto & names : outputNames) {
+            reader.read(names.first);
+            reader.read(names.second);
+        }
+
+        auto node = _registry.create(opsetName, typeName, version);
+        if (auto typeRelaxed = std::dynamic_pointer_cast<ngraph::op::TypeRelaxedBase>(node)) {
+            const auto inputTypesCount = reader.read<uint64_t>();
+            for (size_t i = 0; i < inputTypesCount; i++)
+                typeRelaxed->set_origin_input_type(reader.read<ngraph::element::Type>(), i);
+            const auto outputTypesCount = reader.read<uint64_t>();
+            for (size_t i = 0; i < outputTypesCount; i++)
+                typeRelaxed->set_overridden_output_type(reader.read<ngraph::element::Type>(), i);
+        }
+
+        Attributes attributes;
+        const auto attributesCount = reader.read<uint64_t>();
+        for (uint64_t i = 0; i < attributesCount; i++) {
+            std::string name;
+            reader.read(name);
+            reader.read(attributes[name]);
+        }
+
+        if (auto constant = std::dynamic_pointer_cast<ngraph::op::Constant>(node))
+            constant->alloc_buffer_on_visit_attributes(false);
+        node->set_arguments(inputs);
+        AttributeReader visitor(attributes, *this);
+        if (node->visit_attributes(visitor))
+            node->constructor_validate_and_infer_types();
+        // To be sure that all default values will be initialized
+        node = node->clone_with_new_inputs(node->input_values());
+
+        for (const auto & dependency : dependencies)
+            node->add_control_dependency(dependency);
+        node->set_friendly_name(friendlyName);
+        for (size_t i = 0; i < outputNames.size() && i < node->get_output_size(); i++) {
+            auto & tensor = node->get_output_tensor(i);
+            tensor.set_names({outputNames[i].first.begin(), outputNames[i].first.end()});
+            if (!outputNames[i].second.empty()) {
+                NGRAPH_SUPPRESS_DEPRECATED_START
+                tensor.set_name(outputNames[i].second);
+                NGRAPH_SUPPRESS_DEPRECATED_END
+            }
+        }
+
+        readRuntimeInfo(reader, node->get_rt_info());
+        return node;
+    }
+
+    const OpsetRegistry & _registry;
+    std::unordered_map<std::string, std::shared_ptr<ngraph::Variable>> _variables;
+};
+
+using InputDescriptions = std::vector<std::shared_ptr<ngraph::op::util::SubGraphOp::InputDescription>>;
+using OutputDescriptions = std::vector<std::shared_ptr<ngraph::op::util::SubGraphOp::OutputDescription>>;
+
+void AttributeWriter::on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) {
+    std::ostringstream stream;
+    BinaryWriter writer(stream);
+
+    if (auto a = ngraph::as_type<ngraph::AttributeAdapter<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(&adapter)) {
+        const auto & buffer = a->get();
+        writer.writeBytes(buffer->get_ptr(), buffer->size());
+    } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<std::shared_ptr<ngraph::Variable>>>(&adapter)) {
+        _functionWriter.writeVariable(writer, a->get());
+    } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<InputDescriptions>>(&adapter)) {
+        writer.write<uint64_t>(a->get().size());
+        for (const auto & description : a->get()) {
+            using namespace ngraph::op::util;
+            writer.write(std::string(description->get_type_info().name));
+            writer.write(description->m_input_index);
+            writer.write(description->m_body_parameter_index);
+            if (auto slice = ngraph::as_type_ptr<SubGraphOp::SliceInputDescription>(description)) {
+                writer.write(std::vector<int64_t>{slice->m_start, slice->m_stride, slice->m_part_size, slice->m_end, slice->m_axis});
+            } else if (auto merged = ngraph::as_type_ptr<SubGraphOp::MergedInputDescription>(description)) {
+                writer.write(merged->m_body_value_index);
+            }
+        }
+    } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<OutputDescriptions>>(&adapter)) {
+        writer.write<uint64_t>(a->get().size());
+        for (const auto & description : a->get()) {
+            using namespace ngraph::op::util;
+            writer.write(std::string(description->get_type_info().name));
+            writer.write(description->m_body_value_index);
+            writer.write(description->m_output_index);
+            if (auto concat = ngraph::as_type_ptr<SubGraphOp::ConcatOutputDescription>(description)) {
+                writer.write(std::vector<int64_t>{concat->m_start, concat->m_stride, concat->m_part_size, concat->m_end, concat->m_axis});
+            } else if (auto body = ngraph::as_type_ptr<SubGraphOp::BodyOutputDescription>(description)) {
+                writer.write(body->m_iteration);
+            }
+        }
+    } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<ngraph::op::v5::Loop::SpecialBodyPorts>>(&adapter)) {
+        writer.write(a->get().current_iteration_input_idx);
+        writer.write(a->get().body_condition_output_idx);
+    } else {
+        IE_THROW(NotImplemented) << "Unsupported attribute type for serialization: " << name;
+    }
+
+    _attributes[name] = stream.str();
+}
+
+void AttributeWriter::on_adapter(const std::string& name, ngraph::ValueAccessor<std::shared_ptr<ngraph::Function>>& adapter) {
+    std::ostringstream stream;
+    BinaryWriter writer(stream);
+    _functionWriter.write(writer, adapter.get());
+    _attributes[name] = stream.str();
+}
+
+void AttributeReader::on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) {
+    const auto it = _attributes.find(name);
+    if (it == _attributes.end())
+        return;
+    std::istringstream stream(it->second);
+    BinaryReader reader(stream);
+
+    if (auto a = ngraph::as_type<ngraph::AttributeAdapter<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(&adapter)) {
+        const auto size = reader.read<uint64_t>();
+        auto buffer = std::make_shared<ngraph::runtime::AlignedBuffer>(size);
+        reader.readRaw(buffer->get_ptr(), size);
+        a->set(buffer);
+    } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<std::shared_ptr<ngraph::Variable>>>(&adapter)) {
+        a->set(_functionReader.readVariable(reader));
+    } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<InputDescriptions>>(&adapter)) {
+        using namespace ngraph::op::util;
+        InputDescriptions descriptions(reader.read<uint64_t>());
+        for (auto & description : descriptions) {
+            const auto type = reader.read<std::string>();
+            const auto inputIndex = reader.read<uint64_t>();
+            const auto bodyParameterIndex = reader.read<uint64_t>();
+            if (type == SubGraphOp::SliceInputDescription::type_info.name) {
+                const auto p = reader.read<std::vector<int64_t>>();
+                description = std::make_shared<SubGraphOp::SliceInputDescription>(inputIndex, bodyParameterIndex, p[0], p[1], p[2], p[3], p[4]);
+            } else if (type == SubGraphOp::MergedInputDescription::type_info.name) {
+                description = std::make_shared<SubGraphOp::MergedInputDescription>(inputIndex, bodyParameterIndex, reader.read<uint64_t>());
+            } else if (type == SubGraphOp::InvariantInputDescription::type_info.name) {
+                description = std::make_shared<SubGraphOp::InvariantInputDescription>(inputIndex, bodyParameterIndex);
+            } else {
+                IE_THROW() << "Unknown input description " << type << " in the imported network";
+            }
+        }
+        a->set(descriptions);
+    } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<OutputDescriptions>>(&adapter)) {
+        using namespace ngraph::op::util;
+        OutputDescriptions descriptions(reader.read<uint64_t>());
+        for (auto & description : descriptions) {
+            const auto type = reader.read<std::string>();
+            const auto bodyValueIndex = reader.read<uint64_t>();
+            const auto outputIndex = reader.read<uint64_t>();
+            if (type == SubGraphOp::ConcatOutputDescription::type_info.name) {
+                const auto p = reader.read<std::vector<int64_t>>();
+                description = std::make_shared<SubGraphOp::ConcatOutputDescription>(bodyValueIndex, outputIndex, p[0], p[1], p[2], p[3], p[4]);
+            } else if (type == SubGraphOp::BodyOutputDescription::type_info.name) {
+                description = std::make_shared<SubGraphOp::BodyOutputDescription>(bodyValueIndex, outputIndex, reader.read<int64_t>());
+            } else {
+                IE_THROW() << "Unknown output description " << type << " in the imported network";
+            }
+        }
+        a->set(descriptions);
+    } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<ngraph::op::v5::Loop::SpecialBodyPorts>>(&adapter)) {
+        ngraph::op::v5::Loop::SpecialBodyPorts ports;
+        reader.read(ports.current_iteration_input_idx);
+        reader.read(ports.body_condition_output_idx);
+        a->set(ports);
+    } else {
+        IE_THROW() << "Unsupported attribute type for deserialization: " << name;
+    }
+}
+
+void AttributeReader::on_adapter(const std::string& name, ngraph::ValueAccessor<std::shared_ptr<ngraph::Function>>& adapter) {
+    const auto it = _attributes.find(name);
+    if (it == _attributes.end())
+        return;
+    std::istringstream stream(it->second);
+    BinaryReader reader(stream);
+    adapter.set(_functionReader.read(reader));
+}
+
+void writeTensorDesc(BinaryWriter & writer, const TensorDesc & desc) {
+    writer.write<int32_t>(desc.getPrecision());
+    writer.write<int32_t>(desc.getLayout());
+    writer.write(desc.getDims());
+}
+
+TensorDesc readTensorDesc(BinaryReader & reader) {
+    const auto precision = static_cast<Precision::ePrecision>(reader.read<int32_t>());
+    const auto layout = static_cast<Layout>(reader.read<int32_t>());
+    const auto dims = reader.read<std::vector<size_t>>();
+    return TensorDesc(precision, dims, layout);
+}
+
+void writePreProcessInfo(BinaryWriter & writer, const PreProcessInfo & info) {
+    writer.write<int32_t>(info.getResizeAlgorithm());
+    writer.write<int32_t>(info.getColorFormat());
+    writer.write<int32_t>(info.getMeanVariant());
+    writer.write<uint64_t>(info.getNumberOfChannels());
+    for (size_t i = 0; i < info.getNumberOfChannels(); i++) {
+        const auto & channel = info[i];
+        writer.write(channel->stdScale);
+        writer.write(channel->meanValue);
+        writer.write<uint8_t>(channel->meanData != nullptr);
+        if (channel->meanData) {
+            if (channel->meanData->getTensorDesc().getPrecision() != Precision::FP32)
+                IE_THROW(NotImplemented) << "Only FP32 mean image is supported for export";
+            writeTensorDesc(writer, channel->meanData->getTensorDesc());
+            writer.writeBytes(channel->meanData->cbuffer().as<const float*>(), channel->meanData->byteSize());
+        }
+    }
+}
+
+void readPreProcessInfo(BinaryReader & reader, PreProcessInfo & info) {
+    info.setResizeAlgorithm(static_cast<ResizeAlgorithm>(reader.read<int32_t>()));
+    info.setColorFormat(static_cast<ColorFormat>(reader.read<int32_t>()));
+    const auto meanVariant = static_cast<MeanVariant>(reader.read<int32_t>());
+    const auto channels = reader.read<uint64_t>();
+    if (channels != 0)
+        info.init(channels);
+    for (size_t i = 0; i < channels; i++) {
+        auto & channel = info[i];
+        reader.read(channel->stdScale);
+        reader.read(channel->meanValue);
+        if (reader.read<uint8_t>()) {
+            auto meanData = make_shared_blob<float>(readTensorDesc(reader));
+            meanData->allocate();
+            reader.readBytes(meanData->buffer().as<float*>(), meanData->byteSize());
+            info.setMeanImageForChannel(meanData, i);
+        }
+    }
+    info.setVariant(meanVariant);
+}
+
+}  // namespace
+
+CNNNetworkSerializer::CNNNetworkSerializer(std::ostream & ostream, const std::map<std::string, ngraph::OpSet>& extensionOpsets)
+    : _ostream(ostream)
+    , _extensionOpsets(extensionOpsets) {
+}
+
+void CNNNetworkSerializer::operator << (const CNNNetwork & network) {
+    const auto function = network.getFunction();
+    if (!function)
+        IE_THROW(NotImplemented) << "Only nGraph based networks can be exported";
+
+    OpsetRegistry registry(_extensionOpsets);
+    FunctionWriter functionWriter(registry);
+    functionWriter.checkSupported(function);
+
+    BinaryWriter writer(_ostream);
+    writer.write(networkMagic);
+    writer.write(networkVersion);
+    functionWriter.write(writer, function);
+
+    const auto inputsInfo = network.getInputsInfo();
+    writer.write<uint64_t>(inputsInfo.size());
+    for (const auto & input : inputsInfo) {
+        writer.write(input.first);
+        writeTensorDesc(writer, input.second->getTensorDesc());
+        writePreProcessInfo(writer, input.second->getPreProcess());
+    }
+
+    const auto outputsInfo = network.getOutputsInfo();
+    writer.write<uint64_t>(outputsInfo.size());
+    for (const auto & output : outputsInfo) {
+        writer.write(output.first);
+        writeTensorDesc(writer, output.second->getTensorDesc());
+    }
+}
+
+CNNNetworkDeserializer::CNNNetworkDeserializer(std::istream & istream, const std::map<std::string, ngraph::OpSet>& extensionOpsets)
+    : _istream(istream)
+    , _extensionOpsets(extensionOpsets) {
+}
+
+void CNNNetworkDeserializer::operator >> (CNNNetwork & network) {
+    BinaryReader reader(_istream);
+    if (reader.read<uint32_t>() != networkMagic || reader.read<uint32_t>() != networkVersion)
+        IE_THROW(NetworkNotRead) << "The stream doesn't contain a network exported by the CPU plugin";
+
+    OpsetRegistry registry(_extensionOpsets);
+    network = CNNNetwork(FunctionReader(registry).read(reader));
+
+    auto inputsInfo = network.getInputsInfo();
+    const auto inputsCount = reader.read<uint64_t>();
+    for (uint64_t i = 0; i < inputsCount; i++) {
+        const auto name = reader.read<std::string>();
+        const auto desc = readTensorDesc(reader);
+        const auto input = inputsInfo.find(name);
+        if (input == inputsInfo.end())
+            IE_THROW(NetworkNotRead) << "Input " << name << " is not found in the imported network";
+        input->second->setPrecision(desc.getPrecision());
+        input->second->setLayout(desc.getLayout());
+        readPreProcessInfo(reader, input->second->getPreProcess());
+    }
+
+    auto outputsInfo = network.getOutputsInfo();
+    const auto outputsCount = reader.read<uint64_t>();
+    for (uint64_t i = 0; i < outputsCount; i++) {
+        const auto name = reader.read<std::string>();
+        const auto desc = readTensorDesc(reader);
+        const auto output = outputsInfo.find(name);
+        if (output == outputsInfo.end())
+            IE_THROW(NetworkNotRead) << "Output " << name << " is not found in the imported network";
+        output->second->setPrecision(desc.getPrecision());
+        output->second->setLayout(desc.getLayout());
+    }
+}
+
+}  // namespace MKLDNNPlugin
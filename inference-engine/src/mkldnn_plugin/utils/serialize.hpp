@@ -0,0 +1,49 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cpp/ie_cnn_network.h>
+#include <ngraph/opsets/opset.hpp>
+
+#include <istream>
+#include <ostream>
+#include <map>
+#include <string>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Writes the network already processed by the CPU plugin transformation pipeline into a binary stream.
+ * The stream keeps the nGraph function with plugin specific operations, type relaxed operations
+ * and runtime info used by the CPU graph, together with the inputs/outputs information.
+ * The format is only meant to be read back by CNNNetworkDeserializer from the same plugin build.
+ * A network with operations or runtime info which can't be written throws NotImplemented before
+ * anything is written to the stream.
+ */
+class CNNNetworkSerializer {
+public:
+    CNNNetworkSerializer(std::ostream & ostream, const std::map<std::string, ngraph::OpSet>& extensionOpsets);
+    void operator << (const InferenceEngine::CNNNetwork & network);
+
+private:
+    std::ostream & _ostream;
+    std::map<std::string, ngraph::OpSet> _extensionOpsets;
+};
+
+/**
+ * Restores the network written by CNNNetworkSerializer. The restored network doesn't require
+ * the CPU plugin transformation pipeline to be applied again.
+ */
+class CNNNetworkDeserializer {
+public:
+    CNNNetworkDeserializer(std::istream & istream, const std::map<std::string, ngraph::OpSet>& extensionOpsets);
+    void operator >> (InferenceEngine::CNNNetwork & network);
+
+private:
+    std::istream & _istream;
+    std::map<std::string, ngraph::OpSet> _extensionOpsets;
+};
+
+}  // namespace MKLDNNPlugin
@@ -32,12 +32,26 @@ namespace PluginConfigInternalParams {
  */
 DECLARE_CONFIG_KEY(LP_TRANSFORMS_MODE);
 
+/**
+ * @brief Enables compilation of elementwise subgraphs into single kernels (snippets), NO by default.
+ *        Used by CPU plugin, NO keeps every elementwise operation a separate node
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(SNIPPETS_MODE);
+
 /**
  * @brief Limit \#threads that are used by CPU Executor Streams to execute `parallel_for` calls
  * @ingroup ie_dev_api_plugin_api
  */
 DECLARE_CONFIG_KEY(CPU_THREADS_PER_STREAM);
 
+/**
+ * @brief Number of attempts to find a task CPU Executor Streams threads make before they fall asleep, 0 by default.
+ *        Spinning reduces the latency of tasks started right after the previous ones at the cost of CPU time
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_SPIN_WAIT_ITERATIONS);
+
 /**
  * @brief This key should be used to force disable export while loading network even if global cache dir is defined
  *        Used by HETERO plugin to disable automatic caching of subnetworks (set value to YES)
@@ -93,6 +93,7 @@ public:
             BIG,
             ROUND_ROBIN // used w/multiple streams to populate the Big cores first, then the Little, then wrap around (for large #streams)
         }                  _threadPreferredCoreType = PreferredCoreType::ANY; //!< In case of @ref HYBRID_AWARE hints the TBB to affinitize
+        int                _threadSpinWaitIterations = 0;  //!< Number of attempts to find a task a stream thread makes before it falls asleep
 
         /**
          * @brief      A constructor with arguments
@@ -8,6 +8,7 @@
 #include <vector>
 #include <algorithm>
 #include <string>
+#include <type_traits>
 
 #include <transformations_visibility.hpp>
 
@@ -115,6 +116,31 @@ public:
     }
 };
 
+/// Registers the factory of a default constructed type relaxed operation by the type info of its original operation
+/// for the lifetime of the object. Every TypeRelaxed<BaseOp> with a default constructible BaseOp is registered by
+/// the library which instantiates it, so type relaxed operations can be restored by their type, e.g. on import of
+/// a compiled network.
+class NGRAPH_API TypeRelaxedRegistration {
+public:
+    using Factory = std::shared_ptr<Node> (*)();
+
+    /// The registration does nothing if the factory is nullptr
+    TypeRelaxedRegistration(const NodeTypeInfo& base_type_info, Factory factory);
+    ~TypeRelaxedRegistration();
+
+    TypeRelaxedRegistration(const TypeRelaxedRegistration&) = delete;
+    TypeRelaxedRegistration& operator=(const TypeRelaxedRegistration&) = delete;
+
+    /// Creates a default constructed type relaxed operation, returns nullptr if the type isn't registered
+    static std::shared_ptr<Node> create(const NodeTypeInfo& base_type_info);
+
+    static bool is_registered(const NodeTypeInfo& base_type_info);
+
+private:
+    NodeTypeInfo m_base_type_info;
+    Factory m_factory;
+};
+
 // TODO: remove once FusedOp is removed
 NGRAPH_SUPPRESS_DEPRECATED_START
 
@@ -166,10 +192,32 @@ public:
 
 private:
     void init() {
+        // Instantiates the registration of this type relaxed operation
+        (void)&registration;
         validate_and_infer_types();
     }
+
+    static const TypeRelaxedRegistration registration;
 };
 
+template <typename BaseOp>
+typename std::enable_if<std::is_default_constructible<BaseOp>::value, TypeRelaxedRegistration::Factory>::type
+type_relaxed_factory() {
+    return [] () -> std::shared_ptr<Node> {
+        return std::make_shared<TypeRelaxed<BaseOp>>();
+    };
+}
+
+template <typename BaseOp>
+typename std::enable_if<!std::is_default_constructible<BaseOp>::value, TypeRelaxedRegistration::Factory>::type
+type_relaxed_factory() {
+    return nullptr;
+}
+
+template <typename BaseOp>
+const TypeRelaxedRegistration TypeRelaxed<BaseOp>::registration{BaseOp::get_type_info_static(),
+                                                                type_relaxed_factory<BaseOp>()};
+
 template <typename BaseOp>
 void TypeRelaxed<BaseOp>::validate_and_infer_types() {
     // Remember all input data types
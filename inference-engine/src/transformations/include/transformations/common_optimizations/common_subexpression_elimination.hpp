@@ -0,0 +1,39 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+
+#include <transformations_visibility.hpp>
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace ngraph {
+namespace pass {
+
+class TRANSFORMATIONS_API CommonSubexpressionElimination;
+
+}  // namespace pass
+}  // namespace ngraph
+
+/**
+ * @ingroup ie_transformation_common_api
+ * @brief CommonSubexpressionElimination merges nodes which compute the same values: the operations of the same type
+ * and version with equal attributes which consume the same outputs. Consumers of the duplicates are switched
+ * to the first node met in topological order. Constants are merged by content when merge_constants is set.
+ *
+ * Parameters, Results, stateful operations, nodes with control dependencies and operations with attributes
+ * which can't be compared through AttributeVisitor (e.g. sub-graph bodies) are never merged.
+ */
+class ngraph::pass::CommonSubexpressionElimination: public ngraph::pass::FunctionPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    explicit CommonSubexpressionElimination(bool merge_constants = true) : m_merge_constants(merge_constants) {}
+
+    bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+
+private:
+    bool m_merge_constants;
+};
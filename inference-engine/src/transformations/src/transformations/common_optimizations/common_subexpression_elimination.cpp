@@ -0,0 +1,245 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "itt.hpp"
+#include <ngraph/graph_util.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/op/util/op_types.hpp>
+#include <ngraph/op/util/sub_graph_base.hpp>
+#include <ngraph/op/util/variable_extension.hpp>
+#include <transformations/common_optimizations/common_subexpression_elimination.hpp>
+#include <transformations/rt_info/dequantization_attribute.hpp>
+#include <transformations/rt_info/fused_names_attribute.hpp>
+#include <transformations/rt_info/primitives_priority_attribute.hpp>
+
+NGRAPH_RTTI_DEFINITION(ngraph::pass::CommonSubexpressionElimination, "CommonSubexpressionElimination", 0);
+
+namespace {
+
+/**
+ * Writes all the attributes of a node to a string, so two nodes of the same type have equal attributes
+ * if and only if the strings are equal. Attributes without textual representation make the node incomparable.
+ */
+class AttributesSerializer : public ngraph::AttributeVisitor {
+public:
+    AttributesSerializer() {
+        m_stream.precision(std::numeric_limits<double>::max_digits10);
+    }
+
+    bool is_comparable() const { return m_comparable; }
+    std::string get() const { return m_stream.str(); }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) override {
+        m_comparable = false;
+    }
+
+    void on_adapter(const std::string& name, ngraph::VisitorAdapter& adapter) override {
+        if (ngraph::is_type<ngraph::AttributeAdapter<ngraph::op::AutoBroadcastSpec>>(&adapter) ||
+            ngraph::is_type<ngraph::AttributeAdapter<ngraph::op::BroadcastModeSpec>>(&adapter)) {
+            adapter.visit_attributes(*this);
+        } else {
+            // references to other nodes and functions
+            m_comparable = false;
+        }
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::shared_ptr<ngraph::Function>>& adapter) override {
+        m_comparable = false;
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::string>& adapter) override { append(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<bool>& adapter) override { append(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int8_t>& adapter) override { append(name, int(adapter.get())); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int16_t>& adapter) override { append(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int32_t>& adapter) override { append(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int64_t>& adapter) override { append(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint8_t>& adapter) override { append(name, unsigned(adapter.get())); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint16_t>& adapter) override { append(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint32_t>& adapter) override { append(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint64_t>& adapter) override { append(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<float>& adapter) override { append(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<double>& adapter) override { append(name, adapter.get()); }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int8_t>>& adapter) override {
+        append_vector(name, std::vector<int>(adapter.get().begin(), adapter.get().end()));
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int16_t>>& adapter) override { append_vector(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int32_t>>& adapter) override { append_vector(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int64_t>>& adapter) override { append_vector(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint8_t>>& adapter) override {
+        append_vector(name, std::vector<unsigned>(adapter.get().begin(), adapter.get().end()));
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint16_t>>& adapter) override { append_vector(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint32_t>>& adapter) override { append_vector(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint64_t>>& adapter) override { append_vector(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<float>>& adapter) override { append_vector(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<double>>& adapter) override { append_vector(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::string>>& adapter) override { append_vector(name, adapter.get()); }
+
+private:
+    template <typename T>
+    void append(const std::string& name, const T& value) {
+        m_stream << name << '=' << value << ';';
+    }
+
+    template <typename T>
+    void append_vector(const std::string& name, const std::vector<T>& values) {
+        m_stream << name << "=[";
+        for (const auto& value : values)
+            m_stream << value << ',';
+        m_stream << "];";
+    }
+
+    std::ostringstream m_stream;
+    bool m_comparable = true;
+};
+
+bool is_mergeable(const std::shared_ptr<ngraph::Node>& node) {
+    return node->get_output_size() != 0 &&
+           !ngraph::op::is_parameter(node) &&
+           !ngraph::op::is_output(node) &&
+           !ngraph::op::is_sink(node) &&
+           !std::dynamic_pointer_cast<ngraph::VariableExtension>(node) &&
+           !std::dynamic_pointer_cast<ngraph::op::util::SubGraphOp>(node) &&
+           node->get_control_dependencies().empty() &&
+           node->get_control_dependents().empty();
+}
+
+size_t get_constant_byte_size(const std::shared_ptr<ngraph::opset1::Constant>& constant) {
+    return (ngraph::shape_size(constant->get_shape()) * constant->get_element_type().bitwidth() + 7) / 8;
+}
+
+size_t hash_bytes(const char* data, size_t size) {
+    // FNV-1a over 8 byte words, the tail is processed byte by byte
+    uint64_t hash = 14695981039346656037ull;
+    const uint64_t prime = 1099511628211ull;
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+        uint64_t word;
+        std::memcpy(&word, data + i, sizeof(word));
+        hash = (hash ^ word) * prime;
+    }
+    for (; i < size; i++)
+        hash = (hash ^ static_cast<uint8_t>(data[i])) * prime;
+    return static_cast<size_t>(hash);
+}
+
+/**
+ * Writes the value of a runtime attribute, returns false if the value has no textual representation
+ */
+bool append_rt_info_value(std::ostringstream& key, const std::shared_ptr<ngraph::Variant>& attr) {
+    if (auto value = std::dynamic_pointer_cast<ngraph::VariantWrapper<std::string>>(attr)) {
+        key << value->get();
+    } else if (auto value = std::dynamic_pointer_cast<ngraph::VariantWrapper<int64_t>>(attr)) {
+        key << value->get();
+    } else if (std::dynamic_pointer_cast<ngraph::VariantWrapper<ngraph::FusedNames>>(attr)) {
+        // names of the original operations differ by definition and don't affect further transformations
+    } else if (auto value = std::dynamic_pointer_cast<ngraph::VariantWrapper<ngraph::DequantizationAttr>>(attr)) {
+        key << value->get().getDequantizationAttr();
+    } else if (auto value = std::dynamic_pointer_cast<ngraph::VariantWrapper<ngraph::PrimitivesPriority>>(attr)) {
+        key << value->get().getPrimitivesPriority();
+    } else if (attr) {
+        const auto str = attr->to_string();
+        if (str.empty())
+            return false;
+        key << str;
+    }
+    return true;
+}
+
+/**
+ * Builds the part of the key common for all the nodes, returns false if the node can't be compared with other nodes
+ */
+bool get_common_key(const std::shared_ptr<ngraph::Node>& node, std::string& common_key) {
+    std::ostringstream key;
+    const auto& type_info = node->get_type_info();
+    key << type_info.name << ':' << type_info.version << '|';
+    for (const auto& input : node->input_values())
+        key << input.get_node()->get_instance_id() << ':' << input.get_index() << ',';
+    key << '|';
+    for (const auto& output : node->outputs())
+        key << output.get_element_type() << ',';
+    key << '|';
+    // runtime markers (e.g. dequantization) must be the same to keep decisions of the further transformations
+    for (const auto& item : node->get_rt_info()) {
+        key << item.first << '=';
+        if (!append_rt_info_value(key, item.second))
+            return false;
+        key << ',';
+    }
+    key << '|';
+    common_key = key.str();
+    return true;
+}
+
+}  // namespace
+
+bool ngraph::pass::CommonSubexpressionElimination::run_on_function(std::shared_ptr<ngraph::Function> f) {
+    RUN_ON_FUNCTION_SCOPE(CommonSubexpressionElimination);
+    bool graph_rewritten = false;
+
+    std::unordered_map<std::string, std::shared_ptr<Node>> unique_nodes;
+    std::unordered_map<std::string, std::vector<std::shared_ptr<opset1::Constant>>> unique_constants;
+
+    auto replace_outputs = [&](const std::shared_ptr<Node>& node, const std::shared_ptr<Node>& replacement) {
+        for (size_t i = 0; i < node->get_output_size(); ++i)
+            graph_rewritten |= replace_output_update_name(node->output(i), replacement->output(i));
+    };
+
+    // Topological order guarantees that all the inputs of a node are already deduplicated when the node is visited
+    for (const auto& node : f->get_ordered_ops()) {
+        // Recursively apply transformation for sub-graph based operations
+        if (auto sub_graph_node = std::dynamic_pointer_cast<op::util::SubGraphOp>(node))
+            if (auto sub_graph = sub_graph_node->get_function())
+                graph_rewritten |= run_on_function(sub_graph);
+
+        if (!is_mergeable(node))
+            continue;
+
+        if (auto constant = std::dynamic_pointer_cast<opset1::Constant>(node)) {
+            if (!m_merge_constants)
+                continue;
+            std::string common_key;
+            if (!get_common_key(node, common_key))
+                continue;
+            const auto byte_size = get_constant_byte_size(constant);
+            const auto data = constant->get_data_ptr<char>();
+            std::ostringstream key;
+            key << common_key << constant->get_shape() << '|' << hash_bytes(data, byte_size);
+
+            auto& candidates = unique_constants[key.str()];
+            bool merged = false;
+            for (const auto& candidate : candidates) {
+                if (candidate->get_shape() == constant->get_shape() &&
+                    std::memcmp(candidate->get_data_ptr<char>(), data, byte_size) == 0) {
+                    replace_outputs(node, candidate);
+                    merged = true;
+                    break;
+                }
+            }
+            if (!merged)
+                candidates.push_back(constant);
+            continue;
+        }
+
+        std::string common_key;
+        AttributesSerializer serializer;
+        if (!get_common_key(node, common_key) || !node->visit_attributes(serializer) || !serializer.is_comparable())
+            continue;
+
+        const auto key = common_key + serializer.get();
+        auto found = unique_nodes.emplace(key, node);
+        if (!found.second)
+            replace_outputs(node, found.first->second);
+    }
+    return graph_rewritten;
+}
@@ -9,6 +9,10 @@
 #include <chrono>
 #include <mutex>
 #include <functional>
+#ifdef __linux__
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
@@ -158,6 +162,8 @@ public:
     ~MkDirGuard() {
         if (!m_dir.empty()) {
             CommonTestUtils::removeFilesWithExt(m_dir, "blob");
+            CommonTestUtils::removeFilesWithExt(m_dir, "lock");
+            CommonTestUtils::removeFilesWithExt(m_dir, "tmp");
             CommonTestUtils::removeDir(m_dir);
         }
     }
@@ -779,6 +785,7 @@ TEST_P(CachingTest, TestCacheDirCreateRecursive) {
         });
     }
     CommonTestUtils::removeFilesWithExt(newCacheDir2, "blob");
+    CommonTestUtils::removeFilesWithExt(newCacheDir2, "lock");
     CommonTestUtils::removeDir(newCacheDir2);
     CommonTestUtils::removeDir(newCacheDir1);
 }
@@ -898,6 +905,25 @@ TEST_P(CachingTest, TestThrowOnExport) {
     }
 }
 
+TEST_P(CachingTest, TestNotImplementedExport) {
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(SUPPORTED_METRICS), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(IMPORT_EXPORT_SUPPORT), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(DEVICE_ARCHITECTURE), _)).Times(AnyNumber());
+    // The network which can't be exported is loaded without caching
+    for (int index = 0; index < 2; index++) {
+        EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _, _)).Times(m_remoteContext ? 1 : 0);
+        EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _)).Times(!m_remoteContext ? 1 : 0);
+        EXPECT_CALL(*mockPlugin, ImportNetwork(_, _, _)).Times(0);
+        EXPECT_CALL(*mockPlugin, ImportNetwork(_, _)).Times(0);
+        EXPECT_CALL(*net, Export(_)).Times(1).WillOnce(Throw(InferenceEngine::NotImplemented("Not implemented")));
+        testLoad([&](Core &ie) {
+            ie.SetConfig({{CONFIG_KEY(CACHE_DIR), m_cacheDir}});
+            EXPECT_NO_THROW(m_testFunction(ie));
+        });
+        EXPECT_EQ(CommonTestUtils::listFilesWithExt(m_cacheDir, "blob").size(), 0);
+    }
+}
+
 // TODO: temporary behavior is to no re-throw exception on import error (see 54335)
 // In future add separate 'no throw' test for 'blob_outdated' exception from plugin
 TEST_P(CachingTest, TestThrowOnImport) {
@@ -944,6 +970,80 @@ TEST_P(CachingTest, TestThrowOnImport) {
     }
 }
 
+#ifdef __linux__
+// Cache directory which can't be written (e.g. prepopulated and mounted read-only) must not fail loading
+TEST_P(CachingTest, TestReadOnlyCacheDir) {
+    struct ReadOnlyGuard {
+        std::string m_dir;
+        explicit ReadOnlyGuard(const std::string& dir): m_dir(dir) {
+            chmod(m_dir.c_str(), 0555);
+        }
+        ~ReadOnlyGuard() {
+            chmod(m_dir.c_str(), 0755);
+        }
+    };
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(SUPPORTED_METRICS), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(IMPORT_EXPORT_SUPPORT), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(DEVICE_ARCHITECTURE), _)).Times(AnyNumber());
+    { // Step 1: populate the cache
+        EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _, _)).Times(m_remoteContext ? 1 : 0);
+        EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _)).Times(!m_remoteContext ? 1 : 0);
+        EXPECT_CALL(*mockPlugin, ImportNetwork(_, _, _)).Times(0);
+        EXPECT_CALL(*mockPlugin, ImportNetwork(_, _)).Times(0);
+        EXPECT_CALL(*net, Export(_)).Times(1);
+        testLoad([&](Core &ie) {
+            ie.SetConfig({{CONFIG_KEY(CACHE_DIR), m_cacheDir}});
+            m_testFunction(ie);
+        });
+    }
+    ReadOnlyGuard readOnly(m_cacheDir);
+    if (access(m_cacheDir.c_str(), W_OK) == 0) {
+        // Permissions are not enforced for a privileged user
+        GTEST_SKIP();
+    }
+    { // Step 2: the network is imported from the read-only cache
+        EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _, _)).Times(0);
+        EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _)).Times(0);
+        EXPECT_CALL(*mockPlugin, ImportNetwork(_, _, _)).Times(m_remoteContext ? 1 : 0);
+        EXPECT_CALL(*mockPlugin, ImportNetwork(_, _)).Times(!m_remoteContext ? 1 : 0);
+        EXPECT_CALL(*net, Export(_)).Times(0);
+        testLoad([&](Core &ie) {
+            ie.SetConfig({{CONFIG_KEY(CACHE_DIR), m_cacheDir}});
+            EXPECT_NO_THROW(m_testFunction(ie));
+        });
+    }
+    { // Step 3: failed import can't remove the entry, the network is compiled and not exported
+        EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _, _)).Times(m_remoteContext ? 1 : 0);
+        EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _)).Times(!m_remoteContext ? 1 : 0);
+        if (m_remoteContext) {
+            EXPECT_CALL(*mockPlugin, ImportNetwork(_, _, _)).Times(1).WillOnce(Throw(1));
+            EXPECT_CALL(*mockPlugin, ImportNetwork(_, _)).Times(0);
+        } else {
+            EXPECT_CALL(*mockPlugin, ImportNetwork(_, _, _)).Times(0);
+            EXPECT_CALL(*mockPlugin, ImportNetwork(_, _)).Times(1).WillOnce(Throw(1));
+        }
+        EXPECT_CALL(*net, Export(_)).Times(0);
+        testLoad([&](Core &ie) {
+            ie.SetConfig({{CONFIG_KEY(CACHE_DIR), m_cacheDir}});
+            EXPECT_NO_THROW(m_testFunction(ie));
+        });
+    }
+    { // Step 4: empty read-only cache, the network is compiled and not exported
+        MkDirGuard emptyDir(m_cacheDir + "_empty");
+        ReadOnlyGuard emptyReadOnly(m_cacheDir + "_empty");
+        EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _, _)).Times(m_remoteContext ? 1 : 0);
+        EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _)).Times(!m_remoteContext ? 1 : 0);
+        EXPECT_CALL(*mockPlugin, ImportNetwork(_, _, _)).Times(0);
+        EXPECT_CALL(*mockPlugin, ImportNetwork(_, _)).Times(0);
+        EXPECT_CALL(*net, Export(_)).Times(0);
+        testLoad([&](Core &ie) {
+            ie.SetConfig({{CONFIG_KEY(CACHE_DIR), m_cacheDir + "_empty"}});
+            EXPECT_NO_THROW(m_testFunction(ie));
+        });
+    }
+}
+#endif
+
 TEST_P(CachingTest, TestNetworkModified) {
     EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(SUPPORTED_METRICS), _)).Times(AnyNumber());
     EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(IMPORT_EXPORT_SUPPORT), _)).Times(AnyNumber());
@@ -5,6 +5,7 @@
 #include <ie_core.hpp>
 #include <ie_plugin_config.hpp>
 #include <ie_extension.h>
+#include <ngraph/runtime/parallel.hpp>
 
 #include <file_utils.h>
 #include <ngraph_functions/subgraph_builders.hpp>
@@ -75,6 +76,23 @@ TEST_F(CoreThreadingTests, SetConfigPluginDoesNotExist) {
     }, 10000);
 }
 
+// tested function: Core constructor and destructor
+TEST_F(CoreThreadingTests, ParallelForOfReferenceKernelsIsRestored) {
+    const auto previous = ngraph::runtime::get_parallel_for();
+    {
+        InferenceEngine::Core ie;
+        const auto installed = ngraph::runtime::get_parallel_for();
+        ASSERT_NE(nullptr, installed);
+
+        runParallel([&] () {
+            InferenceEngine::Core localIE;
+            ASSERT_EQ(installed, ngraph::runtime::get_parallel_for());
+        }, 10);
+        ASSERT_EQ(installed, ngraph::runtime::get_parallel_for());
+    }
+    ASSERT_EQ(previous, ngraph::runtime::get_parallel_for());
+}
+
 // tested function: RegisterPlugin
 TEST_F(CoreThreadingTests, RegisterPlugin) {
     InferenceEngine::Core ie;
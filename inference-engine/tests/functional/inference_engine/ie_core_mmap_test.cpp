@@ -0,0 +1,90 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph_functions/subgraph_builders.hpp>
+#include <common_test_utils/file_utils.hpp>
+#include <common_test_utils/test_common.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace InferenceEngine;
+
+class CoreMmapTests : public CommonTestUtils::TestsCommon {
+protected:
+    std::string modelName, weightsName;
+
+    void SetUp() override {
+        const auto testName = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+        modelName = std::string("CoreMmapTests_") + testName + ".xml";
+        weightsName = std::string("CoreMmapTests_") + testName + ".bin";
+    }
+
+    void TearDown() override {
+        CommonTestUtils::removeIRFiles(modelName, weightsName);
+    }
+
+    CNNNetwork readNetwork(bool enableMmap) {
+        Core ie;
+        ie.SetConfig({{CONFIG_KEY(ENABLE_MMAP), enableMmap ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO)}});
+        return ie.ReadNetwork(modelName, weightsName);
+    }
+
+    static std::vector<std::vector<uint8_t>> getConstantsData(const CNNNetwork& network) {
+        std::vector<std::vector<uint8_t>> data;
+        for (const auto& op : network.getFunction()->get_ordered_ops()) {
+            if (auto constant = std::dynamic_pointer_cast<ngraph::opset1::Constant>(op)) {
+                auto begin = constant->get_data_ptr<uint8_t>();
+                auto size = ngraph::shape_size(constant->get_shape()) * constant->get_element_type().size();
+                data.emplace_back(begin, begin + size);
+            }
+        }
+        return data;
+    }
+};
+
+TEST_F(CoreMmapTests, mappedWeightsAreEqualToRead) {
+    CNNNetwork(ngraph::builder::subgraph::makeConvPoolRelu()).serialize(modelName, weightsName);
+
+    const auto expected = getConstantsData(readNetwork(false));
+    ASSERT_FALSE(expected.empty());
+    ASSERT_EQ(expected, getConstantsData(readNetwork(true)));
+}
+
+TEST_F(CoreMmapTests, mappedWeightsOutliveCore) {
+    CNNNetwork(ngraph::builder::subgraph::makeConvPoolRelu()).serialize(modelName, weightsName);
+
+    const auto expected = getConstantsData(readNetwork(false));
+    // The Core is destroyed by readNetwork, the mapping is kept alive by the constants
+    auto network = readNetwork(true);
+    CommonTestUtils::removeIRFiles(modelName, weightsName);
+    ASSERT_EQ(expected, getConstantsData(network));
+}
+
+TEST_F(CoreMmapTests, canReadEmptyWeights) {
+    auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3});
+    auto relu = std::make_shared<ngraph::opset1::Relu>(param);
+    auto function = std::make_shared<ngraph::Function>(relu, ngraph::ParameterVector{param});
+    CNNNetwork(function).serialize(modelName, weightsName);
+    ASSERT_EQ(0, CommonTestUtils::fileSize(weightsName));
+
+    CNNNetwork network;
+    ASSERT_NO_THROW(network = readNetwork(true));
+    ASSERT_EQ(1, network.getInputsInfo().size());
+}
+
+TEST_F(CoreMmapTests, throwsOnMissingWeights) {
+    CNNNetwork(ngraph::builder::subgraph::makeConvPoolRelu()).serialize(modelName, weightsName);
+    CommonTestUtils::removeFile(weightsName);
+
+    ASSERT_THROW(readNetwork(true), Exception);
+}
+
+TEST_F(CoreMmapTests, throwsOnWrongValue) {
+    Core ie;
+    ASSERT_THROW(ie.SetConfig({{CONFIG_KEY(ENABLE_MMAP), "ON"}}), Exception);
+}
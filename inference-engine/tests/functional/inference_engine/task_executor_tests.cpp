@@ -2,13 +2,18 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <atomic>
+#include <chrono>
 #include <future>
+#include <thread>
+#include <tuple>
 
 #include <gtest/gtest.h>
 
 #include <ie_parallel.hpp>
 #include <threading/ie_cpu_streams_executor.hpp>
 #include <threading/ie_immediate_executor.hpp>
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 #include <ie_system_conf.h>
 
 using namespace ::testing;
@@ -211,3 +216,85 @@ static auto AsyncExecutors = ::testing::Values(
 
 INSTANTIATE_TEST_SUITE_P(ASyncTaskExecutorTests, ASyncTaskExecutorTests, AsyncExecutors);
 
+
+// Single stream executors are used as serial queues, so tasks are executed in order
+// even if there are more pending tasks than the lock-free queue of the stream holds
+TEST(CPUStreamsExecutorTests, singleStreamExecutesTasksInOrder) {
+    auto taskExecutor = std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor", 1});
+    std::promise<void> unblock;
+    auto blocked = unblock.get_future().share();
+    taskExecutor->run([blocked] { blocked.wait(); });
+
+    constexpr int tasks = 3000;
+    std::vector<int> order;
+    order.reserve(tasks + 1);
+    std::promise<void> done;
+    // The first task frees a slot in the queue of the stream and enqueues the last task while older tasks overflow
+    taskExecutor->run([&] {
+        order.push_back(0);
+        taskExecutor->run([&] {
+            order.push_back(tasks);
+            done.set_value();
+        });
+    });
+    for (int i = 1; i < tasks; i++) {
+        taskExecutor->run([&order, i] { order.push_back(i); });
+    }
+    unblock.set_value();
+    done.get_future().wait();
+
+    ASSERT_EQ(static_cast<std::size_t>(tasks + 1), order.size());
+    for (int i = 0; i <= tasks; i++) {
+        ASSERT_EQ(i, order[i]);
+    }
+}
+
+TEST(CPUStreamsExecutorTests, spinWaitIterationsAreSetByConfig) {
+    IStreamsExecutor::Config config;
+    config.SetConfig(CONFIG_KEY_INTERNAL(CPU_SPIN_WAIT_ITERATIONS), "100");
+    ASSERT_EQ(100, config._threadSpinWaitIterations);
+    ASSERT_EQ(100, config.GetConfig(CONFIG_KEY_INTERNAL(CPU_SPIN_WAIT_ITERATIONS)).as<int>());
+    ASSERT_THROW(config.SetConfig(CONFIG_KEY_INTERNAL(CPU_SPIN_WAIT_ITERATIONS), "-1"), Exception);
+
+    config._streams = 2;
+    auto taskExecutor = std::make_shared<CPUStreamsExecutor>(config);
+    std::promise<void> done;
+    taskExecutor->run([&done] { done.set_value(); });
+    done.get_future().wait();
+}
+
+class CPUStreamsExecutorDispatchTests : public ::testing::TestWithParam<std::tuple<int, int>> {};
+
+// Measures the overhead of passing small tasks from several threads to the streams. It is a benchmark, so it is
+// disabled and run explicitly with --gtest_also_run_disabled_tests, the time per task is recorded as the
+// "nsPerTask" property of the test
+TEST_P(CPUStreamsExecutorDispatchTests, DISABLED_dispatchOverhead) {
+    int streams = 0, spinWaitIterations = 0;
+    std::tie(streams, spinWaitIterations) = GetParam();
+    IStreamsExecutor::Config config{"TestCPUStreamsExecutor", streams, 1};
+    config._threadSpinWaitIterations = spinWaitIterations;
+    constexpr int producers = 4;
+    constexpr int tasksPerProducer = 25000;
+    std::atomic_int executedTasks = {0};
+
+    auto start = std::chrono::steady_clock::now();
+    {
+        auto taskExecutor = std::make_shared<CPUStreamsExecutor>(config);
+        std::vector<std::thread> threads;
+        for (int i = 0; i < producers; i++) {
+            threads.emplace_back([&] {
+                for (int k = 0; k < tasksPerProducer; k++) {
+                    taskExecutor->run([&] {++executedTasks;});
+                }
+            });
+        }
+        for (auto&& thread : threads) thread.join();
+    }
+    auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    ASSERT_EQ(producers * tasksPerProducer, executedTasks);
+    RecordProperty("nsPerTask", static_cast<int>(elapsed / (producers * tasksPerProducer)));
+}
+
+INSTANTIATE_TEST_SUITE_P(CPUStreamsExecutorDispatchTests, CPUStreamsExecutorDispatchTests,
+                         ::testing::Combine(::testing::Values(1, 8, 64), ::testing::Values(0, 100)));
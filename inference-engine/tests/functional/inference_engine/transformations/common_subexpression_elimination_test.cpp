@@ -0,0 +1,176 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <memory>
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset7.hpp>
+#include <ngraph/variant.hpp>
+#include <transformations/common_optimizations/common_subexpression_elimination.hpp>
+#include <transformations/init_node_info.hpp>
+#include <ngraph/pass/manager.hpp>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+
+using namespace testing;
+using namespace ngraph;
+
+TEST(TransformationTests, CommonSubexpressionEliminationShapeOfChain) {
+    std::shared_ptr<Function> f(nullptr), f_ref(nullptr);
+    {
+        auto data = std::make_shared<opset7::Parameter>(element::f32, Shape{1, 3, 16, 16});
+        auto make_chain = [&]() {
+            auto shape_of = std::make_shared<opset7::ShapeOf>(data);
+            auto indices = opset7::Constant::create(element::i64, Shape{2}, {2, 3});
+            auto axis = opset7::Constant::create(element::i64, Shape{}, {0});
+            return std::make_shared<opset7::Gather>(shape_of, indices, axis);
+        };
+        auto concat = std::make_shared<opset7::Concat>(OutputVector{make_chain(), make_chain()}, 0);
+        f = std::make_shared<Function>(NodeVector{concat}, ParameterVector{data});
+
+        pass::Manager m;
+        m.register_pass<pass::InitNodeInfo>();
+        m.register_pass<pass::CommonSubexpressionElimination>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto data = std::make_shared<opset7::Parameter>(element::f32, Shape{1, 3, 16, 16});
+        auto shape_of = std::make_shared<opset7::ShapeOf>(data);
+        auto indices = opset7::Constant::create(element::i64, Shape{2}, {2, 3});
+        auto axis = opset7::Constant::create(element::i64, Shape{}, {0});
+        auto gather = std::make_shared<opset7::Gather>(shape_of, indices, axis);
+        auto concat = std::make_shared<opset7::Concat>(OutputVector{gather, gather}, 0);
+        f_ref = std::make_shared<Function>(NodeVector{concat}, ParameterVector{data});
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, CommonSubexpressionEliminationDifferentAttributes) {
+    std::shared_ptr<Function> f(nullptr), f_ref(nullptr);
+    auto create_function = []() {
+        auto data = std::make_shared<opset7::Parameter>(element::f32, Shape{1, 3, 16, 16});
+        auto shape_of_i64 = std::make_shared<opset7::ShapeOf>(data, element::i64);
+        auto shape_of_i32 = std::make_shared<opset7::ShapeOf>(data, element::i32);
+        auto convert = std::make_shared<opset7::Convert>(shape_of_i32, element::i64);
+        auto concat = std::make_shared<opset7::Concat>(OutputVector{shape_of_i64, convert}, 0);
+        return std::make_shared<Function>(NodeVector{concat}, ParameterVector{data});
+    };
+    f = create_function();
+
+    pass::Manager m;
+    m.register_pass<pass::InitNodeInfo>();
+    m.register_pass<pass::CommonSubexpressionElimination>();
+    m.run_passes(f);
+    ASSERT_NO_THROW(check_rt_info(f));
+
+    f_ref = create_function();
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, CommonSubexpressionEliminationConstants) {
+    std::shared_ptr<Function> f(nullptr), f_ref(nullptr);
+    {
+        auto data = std::make_shared<opset7::Parameter>(element::f32, Shape{2, 2});
+        auto add = std::make_shared<opset7::Add>(data, opset7::Constant::create(element::f32, Shape{2}, {1, 2}));
+        auto mul = std::make_shared<opset7::Multiply>(add, opset7::Constant::create(element::f32, Shape{2}, {1, 2}));
+        auto sub = std::make_shared<opset7::Subtract>(mul, opset7::Constant::create(element::f32, Shape{2}, {2, 1}));
+        f = std::make_shared<Function>(NodeVector{sub}, ParameterVector{data});
+
+        pass::Manager m;
+        m.register_pass<pass::InitNodeInfo>();
+        m.register_pass<pass::CommonSubexpressionElimination>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto data = std::make_shared<opset7::Parameter>(element::f32, Shape{2, 2});
+        auto constant = opset7::Constant::create(element::f32, Shape{2}, {1, 2});
+        auto add = std::make_shared<opset7::Add>(data, constant);
+        auto mul = std::make_shared<opset7::Multiply>(add, constant);
+        auto sub = std::make_shared<opset7::Subtract>(mul, opset7::Constant::create(element::f32, Shape{2}, {2, 1}));
+        f_ref = std::make_shared<Function>(NodeVector{sub}, ParameterVector{data});
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+    ASSERT_EQ(f->get_ops().size(), 7);
+}
+
+TEST(TransformationTests, CommonSubexpressionEliminationKeepConstants) {
+    auto data = std::make_shared<opset7::Parameter>(element::f32, Shape{2, 2});
+    auto add = std::make_shared<opset7::Add>(data, opset7::Constant::create(element::f32, Shape{2}, {1, 2}));
+    auto mul = std::make_shared<opset7::Multiply>(add, opset7::Constant::create(element::f32, Shape{2}, {1, 2}));
+    auto f = std::make_shared<Function>(NodeVector{mul}, ParameterVector{data});
+
+    pass::Manager m;
+    m.register_pass<pass::InitNodeInfo>();
+    m.register_pass<pass::CommonSubexpressionElimination>(false);
+    m.run_passes(f);
+    ASSERT_NO_THROW(check_rt_info(f));
+
+    ASSERT_EQ(f->get_ops().size(), 6);
+}
+
+namespace {
+
+// Runtime attribute without textual representation
+class OpaqueAttribute : public Variant {
+public:
+    static constexpr VariantTypeInfo type_info{"OpaqueAttribute", 0};
+    const VariantTypeInfo& get_type_info() const override { return type_info; }
+};
+
+constexpr VariantTypeInfo OpaqueAttribute::type_info;
+
+size_t count_shape_of_after_cse(const std::shared_ptr<Variant>& first_attr, const std::shared_ptr<Variant>& second_attr) {
+    auto data = std::make_shared<opset7::Parameter>(element::f32, Shape{1, 3, 16, 16});
+    auto shape_of_1 = std::make_shared<opset7::ShapeOf>(data);
+    auto shape_of_2 = std::make_shared<opset7::ShapeOf>(data);
+    shape_of_1->get_rt_info()["attr"] = first_attr;
+    shape_of_2->get_rt_info()["attr"] = second_attr;
+    auto concat = std::make_shared<opset7::Concat>(OutputVector{shape_of_1, shape_of_2}, 0);
+    auto f = std::make_shared<Function>(NodeVector{concat}, ParameterVector{data});
+
+    pass::Manager m;
+    m.register_pass<pass::CommonSubexpressionElimination>();
+    m.run_passes(f);
+
+    size_t count = 0;
+    for (const auto& op : f->get_ops())
+        count += is_type<opset7::ShapeOf>(op);
+    return count;
+}
+
+}  // namespace
+
+TEST(TransformationTests, CommonSubexpressionEliminationEqualRuntimeInfo) {
+    ASSERT_EQ(count_shape_of_after_cse(std::make_shared<VariantWrapper<std::string>>("a"),
+                                       std::make_shared<VariantWrapper<std::string>>("a")), 1);
+    ASSERT_EQ(count_shape_of_after_cse(std::make_shared<VariantWrapper<int64_t>>(1),
+                                       std::make_shared<VariantWrapper<int64_t>>(1)), 1);
+}
+
+TEST(TransformationTests, CommonSubexpressionEliminationDifferentRuntimeInfo) {
+    ASSERT_EQ(count_shape_of_after_cse(std::make_shared<VariantWrapper<std::string>>("a"),
+                                       std::make_shared<VariantWrapper<std::string>>("b")), 2);
+    ASSERT_EQ(count_shape_of_after_cse(std::make_shared<VariantWrapper<int64_t>>(0),
+                                       std::make_shared<VariantWrapper<int64_t>>(1)), 2);
+}
+
+TEST(TransformationTests, CommonSubexpressionEliminationOpaqueRuntimeInfo) {
+    // Values which can't be compared keep the nodes, even if they are the same objects
+    auto attr = std::make_shared<OpaqueAttribute>();
+    ASSERT_EQ(count_shape_of_after_cse(attr, attr), 2);
+}
@@ -295,4 +295,16 @@ TEST_F(TypeRelaxedTests, OneOutputMultipleInputPorts) {
         relaxed_op->validate_and_infer_types();
         ASSERT_EQ(param1->output(0).get_element_type(), element::i64);
     }
-}
\ No newline at end of file
+}
+TEST_F(TypeRelaxedTests, createByOriginalType) {
+    // TypeRelaxed<Select> is instantiated by the tests above, so it's registered
+    const auto& typeInfo = ngraph::opset1::Select::get_type_info_static();
+    ASSERT_TRUE(ngraph::op::TypeRelaxedRegistration::is_registered(typeInfo));
+    auto node = ngraph::op::TypeRelaxedRegistration::create(typeInfo);
+    ASSERT_NE(nullptr, node);
+    ASSERT_NE(nullptr, std::dynamic_pointer_cast<ngraph::op::TypeRelaxed<ngraph::opset1::Select>>(node));
+    ASSERT_EQ(typeInfo, node->get_type_info());
+
+    ASSERT_FALSE(ngraph::op::TypeRelaxedRegistration::is_registered(ngraph::opset1::Erf::get_type_info_static()));
+    ASSERT_EQ(nullptr, ngraph::op::TypeRelaxedRegistration::create(ngraph::opset1::Erf::get_type_info_static()));
+}
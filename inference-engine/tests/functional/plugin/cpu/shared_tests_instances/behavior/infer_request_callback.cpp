@@ -14,7 +14,8 @@ const std::vector<InferenceEngine::Precision> netPrecisions = {
 const std::vector<std::map<std::string, std::string>> configs = {
         {},
         {{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, InferenceEngine::PluginConfigParams::CPU_THROUGHPUT_AUTO}},
-        {{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "0"}, {InferenceEngine::PluginConfigParams::KEY_CPU_THREADS_NUM, "1"}}
+        {{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "0"}, {InferenceEngine::PluginConfigParams::KEY_CPU_THREADS_NUM, "1"}},
+        {{InferenceEngine::PluginConfigParams::KEY_CPU_AUTO_BATCH_SIZE, "4"}, {InferenceEngine::PluginConfigParams::KEY_CPU_AUTO_BATCH_TIMEOUT, "2"}}
 };
 
 const std::vector<std::map<std::string, std::string>> multiConfigs = {
@@ -7,10 +7,82 @@
 #include "hetero/synthetic.hpp"
 #include "ngraph_functions/builders.hpp"
 #include "ngraph_functions/subgraph_builders.hpp"
+#include <ie_plugin_config.hpp>
 
 namespace {
 using namespace HeteroTests;
 
+// Two branches which don't depend on each other, every branch is inferred by its own device
+FunctionParameter makeIndependentSubgraphs() {
+    auto params = ngraph::builder::makeParams(ngraph::element::f32, {{1, 3, 32, 32}, {1, 3, 32, 32}});
+    auto convA = ngraph::builder::makeConvolution(params[0], ngraph::element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1},
+                                                  {1, 1}, ngraph::op::PadType::EXPLICIT, 16);
+    convA->set_friendly_name("ConvA");
+    auto convB = ngraph::builder::makeConvolution(params[1], ngraph::element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1},
+                                                  {1, 1}, ngraph::op::PadType::EXPLICIT, 16);
+    convB->set_friendly_name("ConvB");
+    ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(convA),
+                                 std::make_shared<ngraph::opset1::Result>(convB)};
+    auto function = std::make_shared<ngraph::Function>(results, params, "IndependentSubgraphs");
+    return FunctionParameter{{"ConvA"}, function};
+}
+
+// Two subgraphs where the second one reads the output of the first one
+FunctionParameter makeLinearSubgraphs() {
+    auto params = ngraph::builder::makeParams(ngraph::element::f32, {{1, 3, 32, 32}});
+    auto convA = ngraph::builder::makeConvolution(params[0], ngraph::element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1},
+                                                  {1, 1}, ngraph::op::PadType::EXPLICIT, 16);
+    convA->set_friendly_name("ConvA");
+    auto convB = ngraph::builder::makeConvolution(convA, ngraph::element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1},
+                                                  {1, 1}, ngraph::op::PadType::EXPLICIT, 16);
+    convB->set_friendly_name("ConvB");
+    ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(convB)};
+    auto function = std::make_shared<ngraph::Function>(results, params, "LinearSubgraphs");
+    return FunctionParameter{{"ConvA"}, function};
+}
+
+using HeteroIndependentSubgraphsTest = HeteroSyntheticTest;
+using HeteroLinearSubgraphsTest = HeteroSyntheticTest;
+
+// Exclusive async requests serialize all requests of the device, so HETERO doesn't pass it to the devices
+// which infer independent subgraphs, and subgraphs of one HETERO request are inferred concurrently
+TEST_P(HeteroIndependentSubgraphsTest, independentSubgraphsOverlap) {
+    auto affinities = SetUpAffinity();
+    SCOPED_TRACE(affinities);
+    configuration[CONFIG_KEY(CPU_THROUGHPUT_STREAMS)] = "2";
+    Run();
+    if (!FuncTestUtils::SkipTestsConfig::currentTestIsDisabled()) {
+        ASSERT_TRUE(executableNetwork.GetConfig(CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)).as<bool>());
+        // streams of the devices are disabled in the exclusive mode
+        ASSERT_EQ("2", executableNetwork.GetConfig(CONFIG_KEY(CPU_THROUGHPUT_STREAMS)).as<std::string>());
+        InferConcurrently(4);
+    }
+}
+
+// Subgraphs of a linear split never run concurrently, so the devices keep the default exclusive mode
+TEST_P(HeteroLinearSubgraphsTest, linearSubgraphsKeepExclusiveMode) {
+    auto affinities = SetUpAffinity();
+    SCOPED_TRACE(affinities);
+    configuration[CONFIG_KEY(CPU_THROUGHPUT_STREAMS)] = "2";
+    Run();
+    if (!FuncTestUtils::SkipTestsConfig::currentTestIsDisabled()) {
+        ASSERT_TRUE(executableNetwork.GetConfig(CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)).as<bool>());
+        ASSERT_EQ("1", executableNetwork.GetConfig(CONFIG_KEY(CPU_THROUGHPUT_STREAMS)).as<std::string>());
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_LinearSubgraphs, HeteroLinearSubgraphsTest,
+                        ::testing::Combine(
+                                ::testing::Values(std::vector<PluginParameter>{{"CPU0", "MKLDNNPlugin"}, {"CPU1", "MKLDNNPlugin"}}),
+                                ::testing::Values(makeLinearSubgraphs())),
+                        HeteroSyntheticTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_IndependentSubgraphs, HeteroIndependentSubgraphsTest,
+                        ::testing::Combine(
+                                ::testing::Values(std::vector<PluginParameter>{{"CPU0", "MKLDNNPlugin"}, {"CPU1", "MKLDNNPlugin"}}),
+                                ::testing::Values(makeIndependentSubgraphs())),
+                        HeteroSyntheticTest::getTestCaseName);
+
 INSTANTIATE_TEST_SUITE_P(smoke_SingleMajorNode, HeteroSyntheticTest,
                         ::testing::Combine(
                                 ::testing::Values(std::vector<PluginParameter>{{"CPU0", "MKLDNNPlugin"}, {"CPU1", "MKLDNNPlugin"}}),
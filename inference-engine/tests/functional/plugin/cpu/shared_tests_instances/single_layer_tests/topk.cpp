@@ -51,4 +51,23 @@ INSTANTIATE_TEST_SUITE_P(smoke_TopK, TopKLayerTest,
                 ::testing::Values(std::vector<size_t>({10, 10, 10})),
                 ::testing::Values(CommonTestUtils::DEVICE_CPU)),
         TopKLayerTest::getTestCaseName);
+
+const std::vector<int64_t> kLargeAxis = {
+        10,
+        1000,
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_TopK_LargeAxis, TopKLayerTest,
+        ::testing::Combine(
+                ::testing::ValuesIn(kLargeAxis),
+                ::testing::Values(1),
+                ::testing::ValuesIn(modes),
+                ::testing::ValuesIn(sortTypes),
+                ::testing::Values(InferenceEngine::Precision::FP32),
+                ::testing::Values(InferenceEngine::Precision::UNSPECIFIED),
+                ::testing::Values(InferenceEngine::Precision::UNSPECIFIED),
+                ::testing::Values(InferenceEngine::Layout::ANY),
+                ::testing::Values(std::vector<size_t>({1, 50000}), std::vector<size_t>({4, 8192})),
+                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+        TopKLayerTest::getTestCaseName);
 }  // namespace
@@ -183,7 +183,16 @@ const std::vector<std::pair<SizeVector, SizeVector>> IS = {
     {{1, 2, 32, 120}, {120, 5}},
     {{7, 32, 120}, {3, 7, 120, 50}},
     {{10, 10, 10}, {10, 10, 10}},
-    {{55, 12}, {12, 55}}
+    {{55, 12}, {12, 55}},
+    {{2, 12, 64, 32}, {2, 12, 32, 64}}
+};
+
+std::vector<fusingSpecificParams> fusingParamsSet {
+        emptyFusingSpec,
+        fusingRelu,
+        fusingMultiplyPerTensor,
+        fusingMultiplyPerChannel,
+        fusingFakeQuantizePerTensorRelu
 };
 
 const auto gemmParams = ::testing::Combine(::testing::ValuesIn(IS),
@@ -194,7 +203,7 @@ const auto gemmParams = ::testing::Combine(::testing::ValuesIn(IS),
 
 const auto testParams = ::testing::Combine(gemmParams,
                                            ::testing::Values(MatMulNodeType::MatMul),
-                                           ::testing::Values(emptyFusingSpec));
+                                           ::testing::ValuesIn(fusingParamsSet));
 
 INSTANTIATE_TEST_SUITE_P(smoke_Check, MatMulLayerCPUTest, testParams, MatMulLayerCPUTest::getTestCaseName);
 
@@ -0,0 +1,100 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+
+#include <thread>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+// Requests started concurrently are inferred as one batch, each request must get the outputs of its own inputs
+class AutoBatchConcurrentRequestsTest : public testing::WithParamInterface<size_t>,
+                                        virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<size_t> obj) {
+        std::ostringstream result;
+        result << "Requests=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        numRequests = this->GetParam();
+        configuration.insert({PluginConfigParams::KEY_CPU_AUTO_BATCH_SIZE, "4"});
+        // The timeout is long enough for the requests to be collected into full batches
+        configuration.insert({PluginConfigParams::KEY_CPU_AUTO_BATCH_TIMEOUT, "1000"});
+        configuration.insert({PluginConfigParams::KEY_PERF_COUNT, PluginConfigParams::YES});
+
+        auto params = builder::makeParams(element::f32, {Shape{1, 3, 8, 8}});
+        auto conv = builder::makeConvolution(params[0], element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                             op::PadType::EXPLICIT, 8);
+        auto relu = std::make_shared<opset1::Relu>(conv);
+        function = std::make_shared<Function>(ResultVector{std::make_shared<opset1::Result>(relu)}, params,
+                                              "AutoBatchConcurrentRequests");
+    }
+
+    void Infer() override {
+        const auto& inputInfo = *cnnNetwork.getInputsInfo().begin();
+        std::vector<InferRequest> requests;
+        std::vector<Blob::Ptr> requestInputs;
+        for (size_t i = 0; i < numRequests; i++) {
+            requests.push_back(executableNetwork.CreateInferRequest());
+            requestInputs.push_back(FuncTestUtils::createAndFillBlob(inputInfo.second->getTensorDesc(), 10, -5, 1,
+                                                                     static_cast<int>(i)));
+            requests.back().SetBlob(inputInfo.first, requestInputs.back());
+        }
+
+        std::vector<std::thread> threads;
+        for (auto& request : requests)
+            threads.emplace_back([&request] { request.StartAsync(); });
+        for (auto& thread : threads)
+            thread.join();
+        for (auto& request : requests)
+            ASSERT_EQ(StatusCode::OK, request.Wait(InferRequest::WaitMode::RESULT_READY));
+
+        for (size_t i = 0; i < numRequests; i++) {
+            inputs = {requestInputs[i]};
+            std::vector<Blob::Ptr> outputs;
+            for (const auto& output : executableNetwork.GetOutputsInfo())
+                outputs.push_back(requests[i].GetBlob(output.first));
+            Compare(CalculateRefs(), outputs);
+
+            // Counters come from the batched graph which inferred the request
+            auto perfCounts = requests[i].GetPerformanceCounts();
+            ASSERT_FALSE(perfCounts.empty());
+            bool executed = false;
+            for (const auto& counter : perfCounts)
+                executed |= counter.second.status == InferenceEngineProfileInfo::EXECUTED;
+            ASSERT_TRUE(executed);
+        }
+    }
+
+    void Validate() override {
+        // Do nothing. Outputs of each request are validated in the Infer() method
+    }
+
+    size_t numRequests;
+};
+
+TEST_P(AutoBatchConcurrentRequestsTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_AutoBatch, AutoBatchConcurrentRequestsTest,
+                         ::testing::Values(4, 6, 8),
+                         AutoBatchConcurrentRequestsTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,149 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include <exec_graph_info.hpp>
+
+using namespace ngraph;
+
+namespace CPUSubgraphTestsDefinitions {
+enum class ScalesType {
+    PerRow,     // fused into the embedding node
+    PerTable,   // fused into the embedding node
+    PerColumn   // not supported by the embedding node, the dequantization is constant folded
+};
+
+std::ostream& operator<<(std::ostream& os, ScalesType type) {
+    switch (type) {
+        case ScalesType::PerRow: return os << "PerRow";
+        case ScalesType::PerTable: return os << "PerTable";
+        case ScalesType::PerColumn: return os << "PerColumn";
+    }
+    return os;
+}
+
+typedef std::tuple<
+        Shape,                  // Embedding table shape
+        element::Type,          // Table precision
+        ScalesType,             // Scale per row, one scale for the table or scale per column
+        std::string             // Device name
+> EmbeddingBagDequantizedTableTuple;
+
+/* The I8/U8 table is expected to be read by the embedding node directly, the dequantization is fused into it
+
+    Constant(I8/U8)
+          |
+       Convert   Constant(scales)
+            \      /
+            Multiply    Parameter(weights)
+                 \       /
+          EmbeddingBagOffsetsSum
+                   |
+                 Result
+*/
+class EmbeddingBagDequantizedTableTest : public testing::WithParamInterface<EmbeddingBagDequantizedTableTuple>,
+                                         virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<EmbeddingBagDequantizedTableTuple> &obj) {
+        Shape tableShape;
+        element::Type tablePrecision;
+        ScalesType scalesType;
+        std::string targetName;
+        std::tie(tableShape, tablePrecision, scalesType, targetName) = obj.param;
+        std::ostringstream results;
+
+        results << "TS=" << tableShape
+                << "_TablePRC=" << tablePrecision
+                << "_Scales=" << scalesType
+                << "_targetDevice=" << targetName;
+        return results.str();
+    }
+
+protected:
+    void SetUp() override {
+        Shape tableShape;
+        element::Type tablePrecision;
+        std::tie(tableShape, tablePrecision, scalesType, targetDevice) = this->GetParam();
+
+        const size_t rows = tableShape[0];
+        // Bags of different sizes including an empty one
+        const std::vector<int32_t> offsets = {0, 1, 1, 4, 11};
+        std::vector<int32_t> indices(17);
+        for (size_t i = 0; i < indices.size(); i++)
+            indices[i] = static_cast<int32_t>((i * 7 + 3) % rows);
+
+        const auto table = builder::makeConstant<int8_t>(tablePrecision, tableShape, {}, true, 100, 0);
+        const auto convert = std::make_shared<opset3::Convert>(table, element::f32);
+        Shape scalesShape(tableShape.size(), 1);
+        if (scalesType == ScalesType::PerRow)
+            scalesShape[0] = rows;
+        else if (scalesType == ScalesType::PerColumn)
+            scalesShape.back() = tableShape.back();
+        const auto scales = builder::makeConstant<float>(element::f32, scalesShape, {}, true, 0.1f, 0.01f);
+        const auto multiply = std::make_shared<opset3::Multiply>(convert, scales);
+
+        const auto weights = std::make_shared<opset3::Parameter>(element::f32, Shape{indices.size()});
+        const auto embedding = std::make_shared<opset3::EmbeddingBagOffsetsSum>(
+                multiply,
+                opset3::Constant::create(element::i32, {indices.size()}, indices),
+                opset3::Constant::create(element::i32, {offsets.size()}, offsets),
+                opset3::Constant::create(element::i32, {}, {0}),
+                weights);
+
+        ResultVector results{std::make_shared<opset3::Result>(embedding)};
+        function = std::make_shared<Function>(results, ParameterVector{weights}, "EmbeddingBagDequantizedTable");
+    }
+
+    void CheckDequantizationFused() {
+        auto function = executableNetwork.GetExecGraphInfo().getFunction();
+        ASSERT_NE(nullptr, function);
+        for (const auto &node : function->get_ops()) {
+            const auto &rtInfo = node->get_rt_info();
+            auto it = rtInfo.find(ExecGraphInfoSerialization::LAYER_TYPE);
+            ASSERT_NE(rtInfo.end(), it);
+            auto value = std::dynamic_pointer_cast<VariantImpl<std::string>>(it->second);
+            ASSERT_NE(nullptr, value);
+            ASSERT_NE("Convert", value->get());
+            ASSERT_NE("Eltwise", value->get());
+
+            if (value->get() != "EmbeddingBagOffsetsSum")
+                continue;
+            // The table is read in the quantized precision only if the dequantization is fused
+            const auto &tableRtInfo = node->get_input_node_ptr(0)->get_rt_info();
+            auto precisionIt = tableRtInfo.find(ExecGraphInfoSerialization::OUTPUT_PRECISIONS);
+            ASSERT_NE(tableRtInfo.end(), precisionIt);
+            auto precision = std::dynamic_pointer_cast<VariantImpl<std::string>>(precisionIt->second);
+            ASSERT_NE(nullptr, precision);
+            if (scalesType == ScalesType::PerColumn)
+                ASSERT_EQ("FP32", precision->get());
+            else
+                ASSERT_NE("FP32", precision->get());
+        }
+    }
+
+    ScalesType scalesType;
+};
+
+TEST_P(EmbeddingBagDequantizedTableTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckDequantizationFused();
+}
+
+namespace {
+std::vector<Shape> tableShapes {
+    {10, 35}, {20, 64}, {7, 4, 16}, {16, 512}
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_EmbeddingBagDequantizedTable, EmbeddingBagDequantizedTableTest,
+    ::testing::Combine(
+        ::testing::ValuesIn(tableShapes),
+        ::testing::Values(element::i8, element::u8),
+        ::testing::Values(ScalesType::PerRow, ScalesType::PerTable, ScalesType::PerColumn),
+        ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+    EmbeddingBagDequantizedTableTest::getTestCaseName);
+} // namespace
+} // namespace CPUSubgraphTestsDefinitions
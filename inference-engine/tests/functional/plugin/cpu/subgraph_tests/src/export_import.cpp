@@ -0,0 +1,102 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+
+#include <sstream>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+/* The network exported after the CPU transformation pipeline is imported and must infer the same outputs.
+   The quantized network is transformed by the low precision transformations into type relaxed operations.
+
+      Parameter                         Parameter
+          |                                 |
+          |                           FakeQuantize   Constant
+          |                                 |            |
+          |                                 |      FakeQuantize
+          |                                 |     /
+      Convolution                       Convolution
+          |                                 |
+        Relu                              Relu
+          |                                 |
+        Result                            Result
+*/
+class ExportImportTest : public testing::WithParamInterface<bool>,
+                         virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<bool> obj) {
+        std::ostringstream result;
+        result << "Quantized=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        const bool quantized = this->GetParam();
+
+        auto params = builder::makeParams(element::f32, {Shape{1, 3, 8, 8}});
+        std::shared_ptr<Node> conv;
+        if (quantized) {
+            auto dataFq = builder::makeFakeQuantize(params[0], element::f32, 256, {}, {0.f}, {2.55f}, {0.f}, {2.55f});
+            auto weights = builder::makeConstant<float>(element::f32, {8, 3, 3, 3}, {}, true, 1.f, -1.f);
+            auto weightsFq = builder::makeFakeQuantize(weights, element::f32, 255, {}, {-1.27f}, {1.27f}, {-1.27f}, {1.27f});
+            conv = std::make_shared<opset1::Convolution>(dataFq, weightsFq, Strides{1, 1}, CoordinateDiff{1, 1},
+                                                         CoordinateDiff{1, 1}, Strides{1, 1});
+        } else {
+            conv = builder::makeConvolution(params[0], element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                            op::PadType::EXPLICIT, 8);
+        }
+        auto relu = std::make_shared<opset1::Relu>(conv);
+        function = std::make_shared<Function>(ResultVector{std::make_shared<opset1::Result>(relu)}, params,
+                                              "ExportImport");
+    }
+};
+
+TEST_P(ExportImportTest, CompareWithLoaded) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    LoadNetwork();
+    std::stringstream blob;
+    executableNetwork.Export(blob);
+    auto importedNetwork = core->ImportNetwork(blob, targetDevice, configuration);
+
+    const auto& inputInfo = *executableNetwork.GetInputsInfo().begin();
+    ASSERT_EQ(1u, importedNetwork.GetInputsInfo().count(inputInfo.first));
+    auto input = FuncTestUtils::createAndFillBlob(inputInfo.second->getTensorDesc(), 10, -5);
+
+    auto request = executableNetwork.CreateInferRequest();
+    auto importedRequest = importedNetwork.CreateInferRequest();
+    request.SetBlob(inputInfo.first, input);
+    importedRequest.SetBlob(inputInfo.first, input);
+    request.Infer();
+    importedRequest.Infer();
+
+    for (const auto& output : executableNetwork.GetOutputsInfo()) {
+        ASSERT_EQ(1u, importedNetwork.GetOutputsInfo().count(output.first));
+        auto expected = request.GetBlob(output.first);
+        auto actual = importedRequest.GetBlob(output.first);
+        ASSERT_EQ(expected->getTensorDesc(), actual->getTensorDesc());
+        auto expectedData = expected->cbuffer().as<const float*>();
+        auto actualData = actual->cbuffer().as<const float*>();
+        for (size_t i = 0; i < expected->size(); i++)
+            ASSERT_EQ(expectedData[i], actualData[i]) << "at " << i;
+    }
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_ExportImport, ExportImportTest,
+                         ::testing::Values(false, true),
+                         ExportImportTest::getTestCaseName);
+
+} // namespace
+
+} // namespace CPUSubgraphTestsDefinitions
@@ -0,0 +1,148 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include <exec_graph_info.hpp>
+
+using namespace ngraph;
+
+namespace CPUSubgraphTestsDefinitions {
+enum class MaskType {
+    None,
+    Parameter,      // Add(scores, mask)
+    Bert            // Add(scores, Multiply(Subtract(1, mask), -10000)), the mask subgraph also ends with Multiply
+};
+
+std::ostream& operator<<(std::ostream& os, MaskType type) {
+    switch (type) {
+        case MaskType::None: return os << "None";
+        case MaskType::Parameter: return os << "Parameter";
+        case MaskType::Bert: return os << "Bert";
+    }
+    return os;
+}
+
+typedef std::tuple<
+        Shape,                  // Queries shape [.., L, E]
+        size_t,                 // Number of keys
+        bool,                   // Keys are transposed by the first MatMul
+        MaskType,               // Mask
+        std::string             // Device name
+> ScaledDotProductAttentionTuple;
+
+/* The pattern is expected to be executed by one ScaledDotProductAttention node
+
+    Parameter(Q)  Parameter(K)
+           \        /
+            MatMul
+              |
+           Multiply   mask (Parameter or BERT mask subgraph)
+               \        /
+                  Add
+                   |
+                Softmax   Parameter(V)
+                    \      /
+                     MatMul
+                       |
+                     Result
+*/
+class ScaledDotProductAttentionTest : public testing::WithParamInterface<ScaledDotProductAttentionTuple>,
+                                      virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ScaledDotProductAttentionTuple> &obj) {
+        Shape qShape;
+        size_t keys;
+        bool transposeK;
+        MaskType maskType;
+        std::string targetName;
+        std::tie(qShape, keys, transposeK, maskType, targetName) = obj.param;
+        std::ostringstream results;
+
+        results << "QS=" << qShape
+                << "_Keys=" << keys
+                << "_TransposeK=" << transposeK
+                << "_Mask=" << maskType
+                << "_targetDevice=" << targetName;
+        return results.str();
+    }
+
+protected:
+    void SetUp() override {
+        Shape qShape;
+        size_t keys;
+        bool transposeK;
+        MaskType maskType;
+        std::tie(qShape, keys, transposeK, maskType, targetDevice) = this->GetParam();
+
+        const auto rank = qShape.size();
+        auto kShape = qShape;
+        kShape[rank - 2] = transposeK ? keys : qShape[rank - 1];
+        kShape[rank - 1] = transposeK ? qShape[rank - 1] : keys;
+        auto vShape = qShape;
+        vShape[rank - 2] = keys;
+        Shape maskShape(rank, 1);
+        maskShape[0] = qShape[0];
+        maskShape[rank - 1] = keys;
+
+        auto params = builder::makeParams(element::f32, {qShape, kShape, vShape});
+        std::shared_ptr<Node> scores = std::make_shared<opset1::MatMul>(params[0], params[1], false, transposeK);
+        scores = std::make_shared<opset1::Multiply>(scores, opset1::Constant::create(element::f32, {}, {0.125f}));
+        if (maskType != MaskType::None) {
+            auto maskParam = std::make_shared<opset1::Parameter>(element::f32, maskShape);
+            params.push_back(maskParam);
+            std::shared_ptr<Node> mask = maskParam;
+            if (maskType == MaskType::Bert) {
+                mask = std::make_shared<opset1::Subtract>(opset1::Constant::create(element::f32, {}, {1.f}), mask);
+                mask = std::make_shared<opset1::Multiply>(mask, opset1::Constant::create(element::f32, {}, {-10000.f}));
+            }
+            scores = std::make_shared<opset1::Add>(scores, mask);
+        }
+        const auto softmax = std::make_shared<opset1::Softmax>(scores, rank - 1);
+        const auto attention = std::make_shared<opset1::MatMul>(softmax, params[2]);
+
+        ResultVector results{std::make_shared<opset1::Result>(attention)};
+        function = std::make_shared<Function>(results, params, "ScaledDotProductAttention");
+    }
+
+    void CheckAttentionFused() {
+        auto function = executableNetwork.GetExecGraphInfo().getFunction();
+        ASSERT_NE(nullptr, function);
+        size_t attentionCount = 0;
+        for (const auto &node : function->get_ops()) {
+            const auto &rtInfo = node->get_rt_info();
+            auto it = rtInfo.find(ExecGraphInfoSerialization::LAYER_TYPE);
+            ASSERT_NE(rtInfo.end(), it);
+            auto value = std::dynamic_pointer_cast<VariantImpl<std::string>>(it->second);
+            ASSERT_NE(nullptr, value);
+            ASSERT_NE("Softmax", value->get());
+            if (value->get() == "ScaledDotProductAttention")
+                attentionCount++;
+        }
+        ASSERT_EQ(1, attentionCount);
+    }
+};
+
+TEST_P(ScaledDotProductAttentionTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckAttentionFused();
+}
+
+namespace {
+std::vector<Shape> queriesShapes {
+    {2, 3, 16, 8}, {1, 2, 70, 32}, {3, 10, 16}
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_ScaledDotProductAttention, ScaledDotProductAttentionTest,
+    ::testing::Combine(
+        ::testing::ValuesIn(queriesShapes),
+        ::testing::Values(7, 300),
+        ::testing::Values(true, false),
+        ::testing::Values(MaskType::None, MaskType::Parameter, MaskType::Bert),
+        ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+    ScaledDotProductAttentionTest::getTestCaseName);
+} // namespace
+} // namespace CPUSubgraphTestsDefinitions
@@ -0,0 +1,207 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/fusing_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "ie_system_conf.h"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+// Elementwise chain without a node to fuse into is compiled into one Subgraph node on AVX2 hosts
+// if SNIPPETS_MODE=YES, by default the plain Eltwise nodes are kept
+class SnippetsEltwiseTest : public testing::WithParamInterface<std::string>,
+                            virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<std::string> obj) {
+        std::ostringstream result;
+        result << "SnippetsMode=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        snippetsMode = this->GetParam();
+        configuration.insert({PluginConfigInternalParams::KEY_SNIPPETS_MODE, snippetsMode});
+
+        const Shape inputShape{1, 16, 10, 10};
+        auto params = builder::makeParams(element::f32, {inputShape, inputShape});
+        auto add = std::make_shared<opset1::Add>(params[0], params[1]);
+        auto sigmoid = std::make_shared<opset1::Sigmoid>(add);
+        auto multiply = std::make_shared<opset1::Multiply>(sigmoid, params[1]);
+        auto constant = builder::makeConstant(element::f32, Shape{1, 16, 1, 1}, std::vector<float>{}, true);
+        auto subtract = std::make_shared<opset1::Subtract>(multiply, constant);
+
+        function = std::make_shared<Function>(ResultVector{std::make_shared<opset1::Result>(subtract)}, params, "SnippetsEltwise");
+    }
+
+    std::string snippetsMode;
+};
+
+TEST_P(SnippetsEltwiseTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    const bool snippetsEnabled = snippetsMode == PluginConfigParams::YES && with_cpu_x86_avx2();
+    CheckNodeOfTypeCount(executableNetwork, "Subgraph", snippetsEnabled ? 1 : 0);
+}
+
+enum class FusingParentType {
+    Convolution,
+    MVN,
+    Interpolate,
+    NormalizeL2
+};
+
+std::ostream& operator<<(std::ostream& os, FusingParentType type) {
+    switch (type) {
+        case FusingParentType::Convolution: return os << "Convolution";
+        case FusingParentType::MVN: return os << "MVN";
+        case FusingParentType::Interpolate: return os << "Interpolate";
+        case FusingParentType::NormalizeL2: return os << "NormalizeL2";
+    }
+    return os;
+}
+
+using SnippetsKeepFusingParams = std::tuple<FusingParentType, fusingSpecificParams>;
+
+// Elementwise operations which the graph optimizer fuses into the preceding node must stay fused
+// and must not be moved into snippets when they are enabled
+class SnippetsKeepFusingTest : public testing::WithParamInterface<SnippetsKeepFusingParams>, public CpuTestWithFusing,
+                               virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<SnippetsKeepFusingParams> obj) {
+        FusingParentType parentType;
+        fusingSpecificParams fusingParams;
+        std::tie(parentType, fusingParams) = obj.param;
+
+        std::ostringstream result;
+        result << "Parent=" << parentType;
+        result << CpuTestWithFusing::getTestCaseName(fusingParams);
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        fusingSpecificParams fusingParams;
+        std::tie(parentType, fusingParams) = this->GetParam();
+        std::tie(postOpMgrPtr, fusedOps) = fusingParams;
+        configuration.insert({PluginConfigInternalParams::KEY_SNIPPETS_MODE, PluginConfigParams::YES});
+
+        auto params = builder::makeParams(element::f32, {Shape{1, 16, 10, 10}});
+        std::shared_ptr<Node> parent;
+        switch (parentType) {
+            case FusingParentType::Convolution:
+                parent = builder::makeConvolution(params[0], element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                  op::PadType::EXPLICIT, 16);
+                break;
+            case FusingParentType::MVN:
+                parent = builder::makeMVN(params[0], false, true, 1e-9);
+                break;
+            case FusingParentType::Interpolate: {
+                op::v4::Interpolate::InterpolateAttrs attrs{op::v4::Interpolate::InterpolateMode::nearest,
+                                                            op::v4::Interpolate::ShapeCalcMode::sizes,
+                                                            {0, 0, 0, 0}, {0, 0, 0, 0}};
+                auto sizes = opset1::Constant::create(element::i64, Shape{4}, {1, 16, 20, 20});
+                auto scales = opset1::Constant::create(element::f32, Shape{4}, {1.f, 1.f, 2.f, 2.f});
+                auto axes = opset1::Constant::create(element::i64, Shape{4}, {0, 1, 2, 3});
+                parent = std::make_shared<op::v4::Interpolate>(params[0], sizes, scales, axes, attrs);
+                break;
+            }
+            case FusingParentType::NormalizeL2:
+                parent = builder::makeNormalizeL2(params[0], {1}, 1e-9f, op::EpsMode::ADD);
+                break;
+        }
+        std::ostringstream parentTypeName;
+        parentTypeName << parentType;
+        parentNodeType = parentTypeName.str();
+
+        function = makeNgraphFunction(element::f32, params, parent, "SnippetsKeepFusing");
+    }
+
+    FusingParentType parentType;
+    std::string parentNodeType;
+};
+
+TEST_P(SnippetsKeepFusingTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckFusingResults(executableNetwork, parentNodeType);
+    CheckNodeOfTypeCount(executableNetwork, "Subgraph", 0);
+}
+
+// Scale shift before FakeQuantize is fused into it and must not be moved into snippets
+class SnippetsKeepScaleShiftBeforeFakeQuantizeTest : public testing::WithParamInterface<std::string>,
+                                                     virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<std::string> obj) {
+        return "targetDevice=" + obj.param;
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = this->GetParam();
+        threshold = 0.1f;
+        configuration.insert({PluginConfigInternalParams::KEY_SNIPPETS_MODE, PluginConfigParams::YES});
+
+        const Shape inputShape{1, 4, 16, 16};
+        auto params = builder::makeParams(element::f32, {inputShape});
+        auto scale = opset1::Constant::create(element::f32, Shape{1, 4, 1, 1}, {2.f, 3.f, 4.f, 5.f});
+        auto shift = opset1::Constant::create(element::f32, Shape{1, 4, 1, 1}, {1.f, 0.5f, -0.5f, -1.f});
+        auto multiply = std::make_shared<opset1::Multiply>(params[0], scale);
+        auto add = std::make_shared<opset1::Add>(multiply, shift);
+        auto quantize = builder::makeFakeQuantize(add, element::f32, 256, Shape{1, 1, 1, 1},
+                                                  {-10.f}, {10.f}, {-10.f}, {10.f});
+
+        function = std::make_shared<Function>(ResultVector{std::make_shared<opset1::Result>(quantize)}, params,
+                                               "SnippetsKeepScaleShiftBeforeFakeQuantize");
+    }
+};
+
+TEST_P(SnippetsKeepScaleShiftBeforeFakeQuantizeTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckNodeOfTypeCount(executableNetwork, "Subgraph", 0);
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_Snippets, SnippetsEltwiseTest,
+                         ::testing::Values(PluginConfigParams::YES, PluginConfigParams::NO),
+                         SnippetsEltwiseTest::getTestCaseName);
+
+const std::vector<FusingParentType> fusingParentTypes {
+        FusingParentType::Convolution,
+        FusingParentType::MVN,
+        FusingParentType::Interpolate,
+        FusingParentType::NormalizeL2
+};
+
+const std::vector<fusingSpecificParams> fusingParamsSet {
+        fusingRelu,
+        fusingSigmoid,
+        fusingReluScaleShift
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_Snippets, SnippetsKeepFusingTest,
+                         ::testing::Combine(
+                                 ::testing::ValuesIn(fusingParentTypes),
+                                 ::testing::ValuesIn(fusingParamsSet)),
+                         SnippetsKeepFusingTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_Snippets, SnippetsKeepScaleShiftBeforeFakeQuantizeTest,
+                         ::testing::Values(CommonTestUtils::DEVICE_CPU),
+                         SnippetsKeepScaleShiftBeforeFakeQuantizeTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
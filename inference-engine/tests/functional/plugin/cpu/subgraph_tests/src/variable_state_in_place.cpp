@@ -0,0 +1,175 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+enum class AssignInput {
+    ReadValue,
+    Add,
+    Relu
+};
+
+std::ostream& operator<<(std::ostream& os, AssignInput input) {
+    switch (input) {
+        case AssignInput::ReadValue: return os << "ReadValue";
+        case AssignInput::Add: return os << "Add";
+        case AssignInput::Relu: return os << "Relu";
+    }
+    return os;
+}
+
+/* The state is double-buffered: ReadValue consumers read the current state buffer and Assign fills the next one.
+   The producer of the Assign input writes the next state in place only if Assign is its single consumer (Relu).
+   If the producer has other consumers (Add) or Assign reads ReadValue directly, the state is copied by Assign.
+
+      Parameter   ReadValue        Parameter   ReadValue        Parameter   ReadValue
+           \       /                    \       /                    \       /    \
+              Add                         Add                         Add      Assign
+            /     \                     /     \                        |
+        Result   Assign             Result    Relu                    Result
+                                                |
+                                              Assign
+*/
+class VariableStateInPlaceTest : public testing::WithParamInterface<AssignInput>,
+                                 virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<AssignInput> obj) {
+        std::ostringstream result;
+        result << "AssignInput=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        assignInput = this->GetParam();
+
+        auto params = builder::makeParams(element::f32, {shape});
+        auto init = opset3::Constant::create(element::f32, shape, std::vector<float>(shape_size(shape), 0.f));
+        auto readValue = std::make_shared<opset3::ReadValue>(init, variableId);
+        auto add = std::make_shared<opset3::Add>(params[0], readValue);
+        Output<Node> assignValue = add;
+        if (assignInput == AssignInput::ReadValue)
+            assignValue = readValue;
+        else if (assignInput == AssignInput::Relu)
+            // The inputs are positive, so the state is accumulated the same way
+            assignValue = std::make_shared<opset3::Relu>(add);
+        auto assign = std::make_shared<opset3::Assign>(assignValue, variableId);
+        function = std::make_shared<Function>(ResultVector{std::make_shared<opset3::Result>(add)}, SinkVector{assign},
+                                              params, "VariableStateInPlace");
+    }
+
+    Blob::Ptr makeBlob(float value) const {
+        auto blob = make_shared_blob<float>(TensorDesc(Precision::FP32, shape, Layout::NC));
+        blob->allocate();
+        auto data = blob->buffer().as<float*>();
+        std::fill(data, data + blob->size(), value);
+        return blob;
+    }
+
+    static void checkValues(const Blob::CPtr& blob, float expected) {
+        auto data = blob->cbuffer().as<const float*>();
+        for (size_t i = 0; i < blob->size(); i++)
+            ASSERT_EQ(expected, data[i]) << "at " << i;
+    }
+
+    // Runs the inference with all the inputs equal to the value and checks the output
+    void inferAndCheck(InferRequest& request, float value, float expectedOutput) {
+        request.SetBlob(cnnNetwork.getInputsInfo().begin()->first, makeBlob(value));
+        request.Infer();
+        checkValues(request.GetBlob(cnnNetwork.getOutputsInfo().begin()->first), expectedOutput);
+    }
+
+    const Shape shape{1, 16};
+    const std::string variableId = "state";
+    AssignInput assignInput;
+
+    // The state keeps its initial value if Assign writes back the value read by ReadValue
+    bool accumulates() const {
+        return assignInput != AssignInput::ReadValue;
+    }
+};
+
+TEST_P(VariableStateInPlaceTest, AccumulateState) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    LoadNetwork();
+    auto request = executableNetwork.CreateInferRequest();
+    auto states = request.QueryState();
+    ASSERT_EQ(1u, states.size());
+    auto& state = states.front();
+
+    float expectedState = 0.f;
+    for (float value : {1.f, 2.f, 3.f, 4.f}) {
+        inferAndCheck(request, value, expectedState + value);
+        if (accumulates())
+            expectedState += value;
+        checkValues(state.GetState(), expectedState);
+    }
+
+    state.Reset();
+    checkValues(state.GetState(), 0.f);
+    inferAndCheck(request, 5.f, 5.f);
+}
+
+TEST_P(VariableStateInPlaceTest, GetStateBlobIsStable) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    LoadNetwork();
+    auto request = executableNetwork.CreateInferRequest();
+    auto state = request.QueryState().front();
+
+    inferAndCheck(request, 1.f, 1.f);
+    auto stateBlob = state.GetState();
+    checkValues(stateBlob, accumulates() ? 1.f : 0.f);
+
+    // The state buffers are exchanged after every inference, the returned blob keeps its value
+    inferAndCheck(request, 2.f, accumulates() ? 3.f : 2.f);
+    inferAndCheck(request, 3.f, accumulates() ? 6.f : 3.f);
+    checkValues(stateBlob, accumulates() ? 1.f : 0.f);
+
+    // The same blob gets the current value
+    auto currentBlob = state.GetState();
+    ASSERT_EQ(stateBlob, currentBlob);
+    checkValues(currentBlob, accumulates() ? 6.f : 0.f);
+}
+
+TEST_P(VariableStateInPlaceTest, SetState) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    LoadNetwork();
+    auto request = executableNetwork.CreateInferRequest();
+    auto state = request.QueryState().front();
+
+    inferAndCheck(request, 1.f, 1.f);
+    auto newState = makeBlob(10.f);
+    state.SetState(newState);
+    // The blob of the user is copied, changing it doesn't change the state
+    std::fill_n(newState->buffer().as<float*>(), newState->size(), -1.f);
+    checkValues(state.GetState(), 10.f);
+    inferAndCheck(request, 1.f, 11.f);
+    inferAndCheck(request, 1.f, accumulates() ? 12.f : 11.f);
+
+    auto smallState = make_shared_blob<float>(TensorDesc(Precision::FP32, {1, 8}, Layout::NC));
+    smallState->allocate();
+    ASSERT_THROW(state.SetState(smallState), Exception);
+    checkValues(state.GetState(), accumulates() ? 12.f : 10.f);
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_VariableStateInPlace, VariableStateInPlaceTest,
+                         ::testing::Values(AssignInput::Add, AssignInput::Relu, AssignInput::ReadValue),
+                         VariableStateInPlaceTest::getTestCaseName);
+
+} // namespace
+
+} // namespace CPUSubgraphTestsDefinitions
@@ -0,0 +1,122 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstring>
+#include <vector>
+#include <memory>
+#include <tuple>
+#include <string>
+
+#include <ie_core.hpp>
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+
+typedef std::tuple<
+        size_t,                             // Number of affine layers
+        size_t,                             // Layer size
+        std::string,                        // Target Device
+        std::map<std::string, std::string>  // Configuration
+> CompactModeParams;
+
+namespace LayerTestsDefinitions {
+
+// In the compact mode the scratch memory of layers which are not alive at the same time is shared.
+// The outputs must be exactly the same as the ones of the network compiled without the compact mode.
+// The output of the first layer is added to the last one, so it stays alive over the whole chain.
+class CompactModeTest : public testing::WithParamInterface<CompactModeParams>,
+                        public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<CompactModeParams> obj) {
+        size_t layers, layerSize;
+        std::string targetDevice;
+        std::map<std::string, std::string> configuration;
+        std::tie(layers, layerSize, targetDevice, configuration) = obj.param;
+
+        std::ostringstream result;
+        result << "Layers=" << layers << "_";
+        result << "LS=" << layerSize << "_";
+        result << "targetDevice=" << targetDevice;
+        for (auto const& configItem : configuration) {
+            result << "_configItem=" << configItem.first << "_" << configItem.second;
+        }
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        size_t layers, layerSize;
+        std::tie(layers, layerSize, targetDevice, configuration) = this->GetParam();
+        auto ngPrc = ngraph::element::f32;
+
+        auto params = ngraph::builder::makeParams(ngPrc, {{1, layerSize}});
+        auto first = std::make_shared<ngraph::opset1::Relu>(
+                ngraph::builder::makeFullyConnected(params[0], ngPrc, layerSize));
+        std::shared_ptr<ngraph::Node> last = first;
+        for (size_t i = 1; i < layers; i++) {
+            auto fc = ngraph::builder::makeFullyConnected(last, ngPrc, layerSize);
+            if (i % 2)
+                last = std::make_shared<ngraph::opset1::Sigmoid>(fc);
+            else
+                last = std::make_shared<ngraph::opset1::Relu>(fc);
+        }
+        auto add = std::make_shared<ngraph::opset1::Add>(first, last);
+        function = std::make_shared<ngraph::Function>(add, params, "CompactMode");
+    }
+
+    std::vector<std::pair<ngraph::element::Type, std::vector<std::uint8_t>>> CalculateRefs() override {
+        auto config = configuration;
+        config["GNA_COMPACT_MODE"] = "NO";
+        auto referenceNetwork = core->LoadNetwork(cnnNetwork, targetDevice, config);
+        auto request = referenceNetwork.CreateInferRequest();
+        request.SetBlob(cnnNetwork.getInputsInfo().begin()->first, inputs[0]);
+        request.Infer();
+
+        std::vector<std::pair<ngraph::element::Type, std::vector<std::uint8_t>>> outputs;
+        for (const auto& output : cnnNetwork.getOutputsInfo()) {
+            auto blob = request.GetBlob(output.first);
+            std::vector<std::uint8_t> bytes(blob->byteSize());
+            std::memcpy(bytes.data(), blob->cbuffer().as<const std::uint8_t*>(), bytes.size());
+            outputs.push_back({ngraph::element::f32, bytes});
+        }
+        return outputs;
+    }
+
+    void Compare(const std::vector<std::pair<ngraph::element::Type, std::vector<std::uint8_t>>> &expectedOutputs,
+                 const std::vector<InferenceEngine::Blob::Ptr> &actualOutputs) override {
+        ASSERT_EQ(expectedOutputs.size(), actualOutputs.size());
+        for (size_t o = 0; o < actualOutputs.size(); o++) {
+            const auto size = actualOutputs[o]->size();
+            ASSERT_EQ(expectedOutputs[o].second.size(), size * sizeof(float));
+            auto expected = reinterpret_cast<const float*>(expectedOutputs[o].second.data());
+            auto actual = actualOutputs[o]->cbuffer().as<const float*>();
+            for (size_t i = 0; i < size; i++) {
+                ASSERT_EQ(expected[i], actual[i]) << "at output " << o << " element " << i;
+            }
+        }
+    }
+};
+
+TEST_P(CompactModeTest, CompareWithNonCompact) {
+    Run();
+}
+
+const std::vector<std::map<std::string, std::string>> configs = {
+        {
+                {"GNA_DEVICE_MODE", "GNA_SW_FP32"},
+                {"GNA_COMPACT_MODE", "YES"}
+        }
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_compact_mode, CompactModeTest,
+                        ::testing::Combine(
+                                ::testing::Values(2, 5),
+                                ::testing::Values(16, 64),
+                                ::testing::Values(CommonTestUtils::DEVICE_GNA),
+                                ::testing::ValuesIn(configs)),
+                        CompactModeTest::getTestCaseName);
+
+} // namespace LayerTestsDefinitions
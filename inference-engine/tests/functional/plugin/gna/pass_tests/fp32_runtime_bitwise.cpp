@@ -0,0 +1,135 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cmath>
+#include <cstring>
+#include <vector>
+#include <memory>
+#include <tuple>
+#include <string>
+
+#include <ie_core.hpp>
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+
+typedef std::tuple<
+        ngraph::helpers::ActivationTypes,   // Activation
+        size_t,                             // Number of inputs of the affine layer
+        size_t,                             // Number of outputs of the affine layer
+        std::string,                        // Target Device
+        std::map<std::string, std::string>  // Configuration
+> Fp32RuntimeBitwiseParams;
+
+namespace LayerTestsDefinitions {
+
+// The GNA_SW_FP32 runtime keeps the accumulation order of the scalar reference, so the outputs
+// of an affine layer with an activation must be exactly equal to the ones computed below
+class Fp32RuntimeBitwiseTest : public testing::WithParamInterface<Fp32RuntimeBitwiseParams>,
+                               public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<Fp32RuntimeBitwiseParams> obj) {
+        ngraph::helpers::ActivationTypes activation;
+        size_t inputSize, outputSize;
+        std::string targetDevice;
+        std::map<std::string, std::string> configuration;
+        std::tie(activation, inputSize, outputSize, targetDevice, configuration) = obj.param;
+
+        std::ostringstream result;
+        result << "Activation=" << activation << "_";
+        result << "IS=" << inputSize << "_";
+        result << "OS=" << outputSize << "_";
+        result << "targetDevice=" << targetDevice;
+        for (auto const& configItem : configuration) {
+            result << "_configItem=" << configItem.first << "_" << configItem.second;
+        }
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        std::tie(activation, inputSize, outputSize, targetDevice, configuration) = this->GetParam();
+        auto ngPrc = ngraph::element::f32;
+
+        auto params = ngraph::builder::makeParams(ngPrc, {{1, inputSize}});
+        weights = CommonTestUtils::generate_float_numbers(outputSize * inputSize, -0.5f, 0.5f);
+        auto weightsNode = ngraph::builder::makeConstant<float>(ngPrc, {outputSize, inputSize}, weights);
+        auto matmul = std::make_shared<ngraph::opset1::MatMul>(params[0], weightsNode, false, true);
+        auto act = ngraph::builder::makeActivation(matmul, ngPrc, activation);
+        function = std::make_shared<ngraph::Function>(act, params, "Fp32RuntimeBitwise");
+    }
+
+    std::vector<std::pair<ngraph::element::Type, std::vector<std::uint8_t>>> CalculateRefs() override {
+        auto input = inputs[0]->cbuffer().as<const float*>();
+        std::vector<float> output(outputSize);
+        for (size_t r = 0; r < outputSize; r++) {
+            float sum = 0.0f;
+            for (size_t k = 0; k < inputSize; k++) {
+                sum += weights[r * inputSize + k] * input[k];
+            }
+            switch (activation) {
+            case ngraph::helpers::ActivationTypes::Relu:
+                output[r] = sum < 0.0f ? sum * 0.0f : sum;
+                break;
+            case ngraph::helpers::ActivationTypes::Sigmoid:
+                output[r] = 0.5 * (1.0 + tanh(0.5 * sum));
+                break;
+            case ngraph::helpers::ActivationTypes::Tanh:
+                output[r] = tanh(sum);
+                break;
+            default:
+                IE_THROW() << "Unexpected activation " << activation;
+            }
+        }
+        std::vector<std::uint8_t> bytes(output.size() * sizeof(float));
+        std::memcpy(bytes.data(), output.data(), bytes.size());
+        return {{ngraph::element::f32, bytes}};
+    }
+
+    void Compare(const std::vector<std::pair<ngraph::element::Type, std::vector<std::uint8_t>>> &expectedOutputs,
+                 const std::vector<InferenceEngine::Blob::Ptr> &actualOutputs) override {
+        ASSERT_EQ(expectedOutputs.size(), 1);
+        ASSERT_EQ(actualOutputs.size(), 1);
+        ASSERT_EQ(actualOutputs[0]->size(), outputSize);
+        auto expected = reinterpret_cast<const float*>(expectedOutputs[0].second.data());
+        auto actual = actualOutputs[0]->cbuffer().as<const float*>();
+        for (size_t i = 0; i < outputSize; i++) {
+            ASSERT_EQ(expected[i], actual[i]) << "at output " << i;
+        }
+    }
+
+    ngraph::helpers::ActivationTypes activation;
+    size_t inputSize;
+    size_t outputSize;
+    std::vector<float> weights;
+};
+
+TEST_P(Fp32RuntimeBitwiseTest, CompareWithScalarReference) {
+    Run();
+}
+
+const std::vector<ngraph::helpers::ActivationTypes> activations = {
+        ngraph::helpers::ActivationTypes::Relu,
+        ngraph::helpers::ActivationTypes::Sigmoid,
+        ngraph::helpers::ActivationTypes::Tanh
+};
+
+const std::vector<std::map<std::string, std::string>> configs = {
+        {
+                {"GNA_DEVICE_MODE", "GNA_SW_FP32"}
+        }
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_fp32_runtime_bitwise, Fp32RuntimeBitwiseTest,
+                        ::testing::Combine(
+                                ::testing::ValuesIn(activations),
+                                ::testing::Values(200, 1024),
+                                ::testing::Values(8, 64, 2050),
+                                ::testing::Values(CommonTestUtils::DEVICE_GNA),
+                                ::testing::ValuesIn(configs)),
+                        Fp32RuntimeBitwiseTest::getTestCaseName);
+
+} // namespace LayerTestsDefinitions
@@ -35,6 +35,7 @@ struct HeteroSyntheticTest : public testing::WithParamInterface<HeteroSyntheticT
     void SetUp() override;
     void TearDown() override;
     std::string SetUpAffinity();
+    void InferConcurrently(std::size_t numRequests);
     static std::string getTestCaseName(const ::testing::TestParamInfo<HeteroSyntheticTestParameters>& obj);
     static std::vector<FunctionParameter> _singleMajorNodeFunctions;
     static std::vector<FunctionParameter> _randomMajorNodeFunctions;
@@ -151,6 +151,7 @@ void LoadNetworkCacheTestBase::SetUp() {
 
 void LoadNetworkCacheTestBase::TearDown() {
     CommonTestUtils::removeFilesWithExt(m_cacheFolderName, "blob");
+    CommonTestUtils::removeFilesWithExt(m_cacheFolderName, "lock");
     std::remove(m_cacheFolderName.c_str());
     core->SetConfig({{CONFIG_KEY(CACHE_DIR), {}}});
 }
@@ -5,8 +5,10 @@
 #include "hetero/synthetic.hpp"
 #include <ngraph/op/util/op_types.hpp>
 #include <ngraph/variant.hpp>
+#include <hetero/hetero_plugin_config.hpp>
 #include "ngraph_functions/builders.hpp"
 #include "ngraph_functions/subgraph_builders.hpp"
+#include "functional_test_utils/blob_utils.hpp"
 #include <random>
 namespace HeteroTests {
 
@@ -149,4 +151,44 @@ TEST_P(HeteroSyntheticTest, someLayersToMajorPluginOthersToFallback) {
     }
 }
 
+void HeteroSyntheticTest::InferConcurrently(std::size_t numRequests) {
+    std::vector<InferenceEngine::InferRequest> requests;
+    std::vector<std::vector<InferenceEngine::Blob::Ptr>> requestInputs;
+    for (std::size_t i = 0; i < numRequests; ++i) {
+        requests.push_back(executableNetwork.CreateInferRequest());
+        requestInputs.emplace_back();
+        for (auto&& input : executableNetwork.GetInputsInfo()) {
+            auto blob = FuncTestUtils::createAndFillBlob(input.second->getTensorDesc(), 10, -5, 1, static_cast<int>(i));
+            requests.back().SetBlob(input.first, blob);
+            requestInputs.back().push_back(blob);
+        }
+    }
+    // all requests are in flight at once, so subgraphs of different requests share the pooled device requests
+    for (auto&& request : requests) {
+        request.StartAsync();
+    }
+    for (auto&& request : requests) {
+        ASSERT_EQ(InferenceEngine::StatusCode::OK, request.Wait(InferenceEngine::InferRequest::WaitMode::RESULT_READY));
+    }
+    for (std::size_t i = 0; i < numRequests; ++i) {
+        inputs = requestInputs[i];
+        std::vector<InferenceEngine::Blob::Ptr> outputs;
+        for (auto&& output : executableNetwork.GetOutputsInfo()) {
+            outputs.push_back(requests[i].GetBlob(output.first));
+        }
+        Compare(CalculateRefs(), outputs);
+    }
+}
+
+TEST_P(HeteroSyntheticTest, someLayersToMajorPluginOthersToFallbackPipelineParallel) {
+    auto affinities = SetUpAffinity();
+    SCOPED_TRACE(affinities);
+    configuration[HETERO_CONFIG_KEY(PIPELINE_PARALLEL)] = CONFIG_VALUE(YES);
+    Run();
+    if (!FuncTestUtils::SkipTestsConfig::currentTestIsDisabled()) {
+        ASSERT_NE(nullptr, cnnNetwork.getFunction());
+        InferConcurrently(8);
+    }
+}
+
 }  //  namespace HeteroTests
@@ -0,0 +1,174 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+#include <ie_plugin_config.hpp>
+#include <ie_system_conf.h>
+#include <ngraph/opsets/opset1.hpp>
+
+#include "utils/performance_heuristics.hpp"
+
+using namespace MKLDNNPlugin;
+using namespace ngraph;
+
+namespace {
+
+// 3x3 convolution with 32 input and output channels over 56x56, far above the FP32 machine balance
+std::shared_ptr<Function> makeConvolution(bool constWeights, bool quantized = false) {
+    ParameterVector params{std::make_shared<opset1::Parameter>(element::f32, Shape{1, 32, 56, 56})};
+    Output<Node> data = params[0];
+    if (quantized) {
+        auto low = opset1::Constant::create(element::f32, {}, {0.f});
+        auto high = opset1::Constant::create(element::f32, {}, {2.55f});
+        data = std::make_shared<opset1::FakeQuantize>(data, low, high, low, high, 256);
+    }
+    std::shared_ptr<Node> weights;
+    if (constWeights) {
+        weights = opset1::Constant::create(element::f32, {32, 32, 3, 3}, std::vector<float>(32 * 32 * 9, 1.f));
+    } else {
+        params.push_back(std::make_shared<opset1::Parameter>(element::f32, Shape{32, 32, 3, 3}));
+        weights = params.back();
+    }
+    auto conv = std::make_shared<opset1::Convolution>(data, weights, Strides{1, 1}, CoordinateDiff{1, 1},
+                                                      CoordinateDiff{1, 1}, Strides{1, 1});
+    return std::make_shared<Function>(NodeVector{conv}, params);
+}
+
+// Matrix-vector multiplication reads every weight once, so it is limited by the memory bandwidth
+std::shared_ptr<Function> makeMatVec(bool constWeights) {
+    ParameterVector params{std::make_shared<opset1::Parameter>(element::f32, Shape{1, 1024})};
+    std::shared_ptr<Node> weights;
+    if (constWeights) {
+        weights = opset1::Constant::create(element::f32, {1024, 1024}, std::vector<float>(1024 * 1024, 1.f));
+    } else {
+        params.push_back(std::make_shared<opset1::Parameter>(element::f32, Shape{1024, 1024}));
+        weights = params.back();
+    }
+    auto matMul = std::make_shared<opset1::MatMul>(params[0], weights);
+    return std::make_shared<Function>(NodeVector{matMul}, params);
+}
+
+// A small compute bound convolution followed by a memory bound matrix-vector multiplication of a comparable cost
+std::shared_ptr<Function> makeMixed() {
+    auto data = std::make_shared<opset1::Parameter>(element::f32, Shape{1, 32, 14, 14});
+    auto convWeights = std::make_shared<opset1::Parameter>(element::f32, Shape{32, 32, 3, 3});
+    auto conv = std::make_shared<opset1::Convolution>(data, convWeights, Strides{1, 1}, CoordinateDiff{1, 1},
+                                                      CoordinateDiff{1, 1}, Strides{1, 1});
+    auto reshape = std::make_shared<opset1::Reshape>(
+            conv, opset1::Constant::create(element::i64, {2}, {1, 32 * 14 * 14}), false);
+    auto matMulWeights = std::make_shared<opset1::Parameter>(element::f32, Shape{32 * 14 * 14, 256});
+    auto matMul = std::make_shared<opset1::MatMul>(reshape, matMulWeights);
+    return std::make_shared<Function>(NodeVector{matMul}, ParameterVector{data, convWeights, matMulWeights});
+}
+
+constexpr double convolutionFlops = 2.0 * (32 * 56 * 56) * (32 * 3 * 3);
+constexpr double matVecFlops = 2.0 * 1024 * 1024;
+
+}  // namespace
+
+TEST(NetworkPerformancePropertiesTest, computeBoundConvolution) {
+    const auto props = GetNetworkPerformanceProperties(makeConvolution(true), false);
+    ASSERT_DOUBLE_EQ(convolutionFlops, props.totalFlops);
+    ASSERT_DOUBLE_EQ(0, props.memoryBoundFlops);
+    ASSERT_EQ(32 * 32 * 9 * sizeof(float), props.weightsSize);
+}
+
+TEST(NetworkPerformancePropertiesTest, memoryBoundMatVec) {
+    const auto props = GetNetworkPerformanceProperties(makeMatVec(true), false);
+    ASSERT_DOUBLE_EQ(matVecFlops, props.totalFlops);
+    ASSERT_DOUBLE_EQ(matVecFlops, props.memoryBoundFlops);
+    ASSERT_DOUBLE_EQ(1.0, props.memoryBoundRatio());
+    ASSERT_EQ(1024 * 1024 * sizeof(float), props.weightsSize);
+}
+
+TEST(NetworkPerformancePropertiesTest, lowPrecisionWeightsSize) {
+    ASSERT_EQ(1024u * 1024 * 2, GetNetworkPerformanceProperties(makeMatVec(true), true).weightsSize);
+    ASSERT_EQ(32u * 32 * 9, GetNetworkPerformanceProperties(makeConvolution(true, true), false).weightsSize);
+}
+
+TEST(NetworkPerformancePropertiesTest, nonConstantWeightsAreNotCounted) {
+    const auto props = GetNetworkPerformanceProperties(makeMatVec(false), false);
+    ASSERT_DOUBLE_EQ(matVecFlops, props.totalFlops);
+    ASSERT_EQ(0u, props.weightsSize);
+}
+
+TEST(NetworkPerformancePropertiesTest, mixedNetwork) {
+    const auto ratio = GetNetworkPerformanceProperties(makeMixed(), false).memoryBoundRatio();
+    ASSERT_GT(ratio, 0.1);
+    ASSERT_LE(ratio, 0.5);
+}
+
+class PerformanceHintsTest : public ::testing::Test {
+protected:
+    // The number of cores is fixed, so the result depends only on the network and the NUMA nodes
+    static constexpr int cores = 16;
+
+    static Config makeConfig(const std::string& hint) {
+        Config config;
+        config.perfHint = hint;
+        config.enforceBF16 = false;
+        config.streamExecutorConfig._threads = cores;
+        return config;
+    }
+
+    // Streams are distributed evenly between NUMA nodes
+    static int expectedStreams(int threadsPerStream) {
+        const int sockets = std::max(1, static_cast<int>(InferenceEngine::getAvailableNUMANodes().size()));
+        int streams = std::max(1, cores / std::min(threadsPerStream, std::max(1, cores / sockets)));
+        if (streams > sockets)
+            streams -= streams % sockets;
+        return streams;
+    }
+};
+
+constexpr int PerformanceHintsTest::cores;
+
+TEST_F(PerformanceHintsTest, computeBoundNetworkGetsSingleThreadedStreams) {
+    auto config = makeConfig(InferenceEngine::PluginConfigParams::THROUGHPUT);
+    ApplyPerformanceHints(config, makeConvolution(false));
+    ASSERT_EQ(expectedStreams(1), config.streamExecutorConfig._streams);
+    ASSERT_EQ(cores, config.streamExecutorConfig._threads);
+}
+
+TEST_F(PerformanceHintsTest, mixedNetworkGetsTwoThreadsPerStream) {
+    auto config = makeConfig(InferenceEngine::PluginConfigParams::THROUGHPUT);
+    ApplyPerformanceHints(config, makeMixed());
+    ASSERT_EQ(expectedStreams(2), config.streamExecutorConfig._streams);
+    ASSERT_EQ(cores, config.streamExecutorConfig._threads);
+}
+
+TEST_F(PerformanceHintsTest, memoryBoundNetworkGetsFewerStreams) {
+    auto config = makeConfig(InferenceEngine::PluginConfigParams::THROUGHPUT);
+    ApplyPerformanceHints(config, makeMatVec(false));
+    ASSERT_EQ(expectedStreams(4), config.streamExecutorConfig._streams);
+    ASSERT_EQ(cores, config.streamExecutorConfig._threads);
+}
+
+TEST_F(PerformanceHintsTest, streamsAreLimitedByRequests) {
+    auto config = makeConfig(InferenceEngine::PluginConfigParams::THROUGHPUT);
+    config.perfHintNumRequests = 2;
+    ApplyPerformanceHints(config, makeConvolution(false));
+    ASSERT_EQ(2, config.streamExecutorConfig._streams);
+    // The streams share all the cores
+    ASSERT_EQ(cores, config.streamExecutorConfig._threads);
+}
+
+TEST_F(PerformanceHintsTest, latencyGetsStreamPerNumaNode) {
+    auto config = makeConfig(InferenceEngine::PluginConfigParams::LATENCY);
+    ApplyPerformanceHints(config, makeConvolution(false));
+    const int sockets = std::max(1, static_cast<int>(InferenceEngine::getAvailableNUMANodes().size()));
+    ASSERT_EQ(sockets, config.streamExecutorConfig._streams);
+}
+
+TEST_F(PerformanceHintsTest, explicitStreamsAreKept) {
+    auto config = makeConfig(InferenceEngine::PluginConfigParams::THROUGHPUT);
+    config.streamsExplicitlySet = true;
+    config.streamExecutorConfig._streams = 3;
+    ApplyPerformanceHints(config, makeConvolution(false));
+    ASSERT_EQ(3, config.streamExecutorConfig._streams);
+}
@@ -0,0 +1,86 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "mkldnn_primitives_cache.hpp"
+
+using namespace MKLDNNPlugin;
+using namespace mkldnn;
+
+class PrimitivesCacheKeyTest : public ::testing::Test {
+protected:
+    std::string getKey(const primitive_attr& attr) const {
+        const memory::desc src({1, 8, 4, 4}, memory::data_type::f32, memory::format_tag::nchw);
+        const memory::desc weights({8, 8, 1, 1}, memory::data_type::f32, memory::format_tag::oihw);
+        const memory::desc dst({1, 8, 4, 4}, memory::data_type::f32, memory::format_tag::nchw);
+        const convolution_forward::desc desc(prop_kind::forward_scoring, algorithm::convolution_direct,
+                                             src, weights, dst, {1, 1}, {0, 0}, {0, 0});
+        return MKLDNNPrimitivesCache::getKey("conv", convolution_forward::primitive_desc(desc, attr, eng));
+    }
+
+    // f32 convolution doesn't support output scales, so they are checked on the reorder like the Reorder node does
+    std::string getReorderKey(const primitive_attr& attr) const {
+        const memory::desc src({1, 8, 4, 4}, memory::data_type::f32, memory::format_tag::nchw);
+        const memory::desc dst({1, 8, 4, 4}, memory::data_type::f32, memory::format_tag::nhwc);
+        return MKLDNNPrimitivesCache::getKey("reorder", reorder::primitive_desc(eng, src, eng, dst, attr));
+    }
+
+    static primitive_attr eltwiseAttr(algorithm alg, float alpha) {
+        post_ops ops;
+        ops.append_eltwise(1.f, alg, alpha, 0.f);
+        primitive_attr attr;
+        attr.set_post_ops(ops);
+        return attr;
+    }
+
+    static primitive_attr depthwiseAttr(const std::vector<float>& weights, const std::vector<float>& biases) {
+        post_ops ops;
+        ops.append_depthwise(algorithm::depthwise_scale_shift, weights.data(), biases.data());
+        primitive_attr attr;
+        attr.set_post_ops(ops);
+        return attr;
+    }
+
+    static primitive_attr scalesAttr(float scale) {
+        primitive_attr attr;
+        attr.set_output_scales(0, {scale});
+        return attr;
+    }
+
+    engine eng{engine::kind::cpu, 0};
+};
+
+TEST_F(PrimitivesCacheKeyTest, sameAttributesGiveSameKey) {
+    ASSERT_EQ(getKey(primitive_attr()), getKey(primitive_attr()));
+    ASSERT_EQ(getKey(eltwiseAttr(algorithm::eltwise_relu, 0.f)), getKey(eltwiseAttr(algorithm::eltwise_relu, 0.f)));
+    ASSERT_EQ(getReorderKey(scalesAttr(2.f)), getReorderKey(scalesAttr(2.f)));
+
+    const std::vector<float> weights(8, 2.f), biases(8, 1.f);
+    ASSERT_EQ(getKey(depthwiseAttr(weights, biases)), getKey(depthwiseAttr(weights, biases)));
+}
+
+TEST_F(PrimitivesCacheKeyTest, postOpsBuffersOfOtherGraphsChangeKey) {
+    // The primitive reads the post ops data by pointer, so it is not shared with a graph holding a copy of the data
+    const std::vector<float> weights(8, 2.f), biases(8, 1.f);
+    const auto weightsCopy = weights, biasesCopy = biases;
+    ASSERT_NE(getKey(depthwiseAttr(weights, biases)), getKey(depthwiseAttr(weightsCopy, biasesCopy)));
+}
+
+TEST_F(PrimitivesCacheKeyTest, postOpsChangeKey) {
+    ASSERT_NE(getKey(primitive_attr()), getKey(eltwiseAttr(algorithm::eltwise_relu, 0.f)));
+    ASSERT_NE(getKey(eltwiseAttr(algorithm::eltwise_relu, 0.f)), getKey(eltwiseAttr(algorithm::eltwise_relu, 0.1f)));
+    ASSERT_NE(getKey(eltwiseAttr(algorithm::eltwise_relu, 0.f)), getKey(eltwiseAttr(algorithm::eltwise_tanh, 0.f)));
+
+    const std::vector<float> weights(8, 2.f), biases(8, 1.f);
+    auto otherBiases = biases;
+    otherBiases.back() = 3.f;
+    ASSERT_NE(getKey(depthwiseAttr(weights, biases)), getKey(depthwiseAttr(weights, otherBiases)));
+}
+
+TEST_F(PrimitivesCacheKeyTest, outputScalesChangeKey) {
+    ASSERT_NE(getReorderKey(primitive_attr()), getReorderKey(scalesAttr(2.f)));
+    ASSERT_NE(getReorderKey(scalesAttr(2.f)), getReorderKey(scalesAttr(3.f)));
+}
@@ -0,0 +1,221 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "ie_cache_manager.hpp"
+#include "common_test_utils/file_utils.hpp"
+
+using namespace InferenceEngine;
+using namespace ::testing;
+using namespace std::chrono;
+
+class FileStorageCacheManagerTests : public Test {
+public:
+    std::string m_cacheDir;
+    std::shared_ptr<ICacheManager> m_cacheManager;
+
+    void SetUp() override {
+        auto testInfo = UnitTest::GetInstance()->current_test_info();
+        std::stringstream ss;
+        auto ts = duration_cast<microseconds>(high_resolution_clock::now().time_since_epoch());
+        ss << testInfo->name() << "_" << std::this_thread::get_id() << "_" << ts.count() << "_cache";
+        m_cacheDir = ss.str();
+        CommonTestUtils::createDirectory(m_cacheDir);
+        m_cacheManager = std::make_shared<FileStorageCacheManager>(std::string(m_cacheDir));
+    }
+
+    void TearDown() override {
+        m_cacheManager.reset();
+        if (CommonTestUtils::directoryExists(lockFile()))
+            CommonTestUtils::removeDir(lockFile());
+        CommonTestUtils::removeFilesWithExt(m_cacheDir, "blob");
+        CommonTestUtils::removeFilesWithExt(m_cacheDir, "lock");
+        CommonTestUtils::removeFilesWithExt(m_cacheDir, "tmp");
+        CommonTestUtils::removeDir(m_cacheDir);
+    }
+
+    std::string blobFile(const std::string& id) const {
+        return FileUtils::makePath(m_cacheDir, id + ".blob");
+    }
+
+    std::string lockFile() const {
+        return FileUtils::makePath(m_cacheDir, std::string("cache.lock"));
+    }
+
+    bool hasTemporaryFiles() const {
+        return !listFiles(m_cacheDir, ".tmp").empty();
+    }
+
+    void write(const std::string& id, const std::string& content) {
+        m_cacheManager->writeCacheEntry(id, [&](std::ostream& stream) {
+            stream << content;
+        });
+    }
+
+    std::string read(const std::string& id) {
+        std::string content = "<not read>";
+        m_cacheManager->readCacheEntry(id, [&](std::istream& stream) {
+            std::ostringstream ostr;
+            ostr << stream.rdbuf();
+            content = ostr.str();
+        });
+        return content;
+    }
+};
+
+TEST_F(FileStorageCacheManagerTests, WriteAndRead) {
+    write("entry", "SomeNetworkData");
+    EXPECT_EQ(read("entry"), "SomeNetworkData");
+    EXPECT_EQ(read("unknown"), "<not read>");
+    EXPECT_FALSE(hasTemporaryFiles());
+
+    write("entry", "OtherNetworkData");
+    EXPECT_EQ(read("entry"), "OtherNetworkData");
+
+    m_cacheManager->removeCacheEntry("entry");
+    EXPECT_FALSE(FileUtils::fileExist(blobFile("entry")));
+    EXPECT_EQ(read("entry"), "<not read>");
+}
+
+TEST_F(FileStorageCacheManagerTests, ReadLargeEntry) {
+    // Several checksum chunks with a partial one at the end
+    std::string content(3 * 1024 * 1024 + 17, '\0');
+    for (size_t i = 0; i < content.size(); i++)
+        content[i] = static_cast<char>(i * 31 % 251);
+    m_cacheManager->writeCacheEntry("entry", [&](std::ostream& stream) {
+        for (size_t i = 0; i < content.size(); i += 1000) {
+            stream.write(content.data() + i, std::min<size_t>(1000, content.size() - i));
+            stream.flush();
+        }
+    });
+    EXPECT_EQ(read("entry"), content);
+}
+
+TEST_F(FileStorageCacheManagerTests, CorruptedEntryIsRemoved) {
+    write("entry", "SomeNetworkData");
+    {
+        std::fstream file(blobFile("entry"), std::ios_base::binary | std::ios_base::in | std::ios_base::out);
+        file.seekp(-1, std::ios_base::end);
+        file.put('X');
+    }
+    // Damaged content is detected before the reader is called
+    EXPECT_EQ(read("entry"), "<not read>");
+    EXPECT_FALSE(FileUtils::fileExist(blobFile("entry")));
+
+    write("entry", "SomeNetworkData");
+    {
+        std::ofstream file(blobFile("entry"), std::ios_base::binary | std::ios_base::app);
+        file << "Tail";
+    }
+    EXPECT_EQ(read("entry"), "<not read>");
+    EXPECT_FALSE(FileUtils::fileExist(blobFile("entry")));
+}
+
+TEST_F(FileStorageCacheManagerTests, ReaderCanSeek) {
+    std::string content(3 * 1024 * 1024 + 17, '\0');
+    for (size_t i = 0; i < content.size(); i++)
+        content[i] = static_cast<char>(i * 31 % 251);
+    write("entry", content);
+
+    std::string tail, head;
+    m_cacheManager->readCacheEntry("entry", [&](std::istream& stream) {
+        stream.seekg(-10, std::ios_base::end);
+        EXPECT_EQ(static_cast<size_t>(stream.tellg()), content.size() - 10);
+        tail.resize(10);
+        stream.read(&tail[0], 10);
+        stream.seekg(0, std::ios_base::beg);
+        head.resize(10);
+        stream.read(&head[0], 10);
+    });
+    EXPECT_EQ(tail, content.substr(content.size() - 10));
+    EXPECT_EQ(head, content.substr(0, 10));
+
+    {
+        std::fstream file(blobFile("entry"), std::ios_base::binary | std::ios_base::in | std::ios_base::out);
+        file.seekp(2 * 1024 * 1024, std::ios_base::beg);
+        file.put('X');
+    }
+    // Chunks the reader would skip are verified too
+    bool called = false;
+    m_cacheManager->readCacheEntry("entry", [&](std::istream&) {
+        called = true;
+    });
+    EXPECT_FALSE(called);
+    EXPECT_FALSE(FileUtils::fileExist(blobFile("entry")));
+}
+
+TEST_F(FileStorageCacheManagerTests, UnusableCacheIsNotFatal) {
+    write("entry", "SomeNetworkData");
+    // The lock can't be taken even by a privileged user if its path is a directory
+    std::remove(lockFile().c_str());
+    ASSERT_EQ(CommonTestUtils::createDirectory(lockFile()), 0);
+
+    EXPECT_NO_THROW(write("entry", "OtherNetworkData"));
+    EXPECT_FALSE(hasTemporaryFiles());
+    EXPECT_EQ(read("entry"), "SomeNetworkData");
+    EXPECT_NO_THROW(m_cacheManager->removeCacheEntry("entry"));
+    EXPECT_EQ(read("entry"), "SomeNetworkData");
+}
+
+TEST_F(FileStorageCacheManagerTests, FailedWriteKeepsOldEntry) {
+    write("entry", "SomeNetworkData");
+    EXPECT_THROW(m_cacheManager->writeCacheEntry("entry", [&](std::ostream& stream) {
+        stream << "Partial";
+        throw std::runtime_error("Export failed");
+    }), std::runtime_error);
+    EXPECT_FALSE(hasTemporaryFiles());
+    EXPECT_EQ(read("entry"), "SomeNetworkData");
+}
+
+TEST_F(FileStorageCacheManagerTests, LeastRecentlyUsedEntriesAreEvicted) {
+    const std::string content(1000, 'a');
+    // Limit fits two entries with their headers, but not three
+    m_cacheManager = std::make_shared<FileStorageCacheManager>(std::string(m_cacheDir), 2500);
+    auto pause = [] { std::this_thread::sleep_for(milliseconds(20)); };
+
+    write("first", content);
+    pause();
+    write("second", content);
+    pause();
+    EXPECT_EQ(read("first"), content);
+    pause();
+    write("third", content);
+
+    EXPECT_TRUE(FileUtils::fileExist(blobFile("first")));
+    EXPECT_FALSE(FileUtils::fileExist(blobFile("second")));
+    EXPECT_TRUE(FileUtils::fileExist(blobFile("third")));
+}
+
+TEST_F(FileStorageCacheManagerTests, TemporaryFilesOfCrashedWritersAreRemoved) {
+    const std::string content(1000, 'a');
+    m_cacheManager = std::make_shared<FileStorageCacheManager>(std::string(m_cacheDir), 2500);
+    auto createTmpFile = [&](uint64_t pid) {
+        const auto name = blobFile("orphan") + "." + std::to_string(pid) + "_0.tmp";
+        std::ofstream(name, std::ios_base::binary) << content;
+        return name;
+    };
+    // Greater than any process id on Linux and Windows
+    const auto crashedWriter = createTmpFile(std::numeric_limits<int32_t>::max());
+    const auto liveWriter = createTmpFile(getProcessId());
+
+    write("first", content);
+    EXPECT_FALSE(FileUtils::fileExist(crashedWriter));
+    EXPECT_TRUE(FileUtils::fileExist(liveWriter));
+    EXPECT_TRUE(FileUtils::fileExist(blobFile("first")));
+
+    // The file of the live writer counts towards the size
+    write("second", content);
+    EXPECT_FALSE(FileUtils::fileExist(blobFile("first")));
+    EXPECT_TRUE(FileUtils::fileExist(blobFile("second")));
+    EXPECT_TRUE(FileUtils::fileExist(liveWriter));
+}
@@ -349,6 +349,57 @@ TEST(NetworkContext_CNNNetwork, HashWithDifferentMeanValues) {
               NetworkCompilationContext::computeHash(net3, {}));
 }
 
+TEST(NetworkContext_CNNNetwork, HashWithSwappedConstantValues) {
+    auto net1 = createNetwork();
+    auto net2 = createNetwork();
+    // Values of the Multiply and Add constants are exchanged, the network has the same set of constant values
+    auto swapConstants = [](CNNNetwork& network) {
+        std::shared_ptr<ngraph::opset6::Constant> mulConstant, addConstant;
+        for (const auto& op : network.getFunction()->get_ops()) {
+            if (op->get_friendly_name() == "mul_constant") {
+                mulConstant = std::dynamic_pointer_cast<ngraph::opset6::Constant>(op);
+            } else if (op->get_friendly_name() == "add_constant") {
+                addConstant = std::dynamic_pointer_cast<ngraph::opset6::Constant>(op);
+            }
+        }
+        ASSERT_NE(nullptr, mulConstant);
+        ASSERT_NE(nullptr, addConstant);
+        ASSERT_NE(mulConstant->cast_vector<int8_t>(), addConstant->cast_vector<int8_t>());
+
+        auto swappedMul = ngraph::opset6::Constant::create(ngraph::element::i8, ngraph::Shape{1},
+                                                           addConstant->cast_vector<int8_t>());
+        swappedMul->set_friendly_name(mulConstant->get_friendly_name());
+        auto swappedAdd = ngraph::opset6::Constant::create(ngraph::element::i8, ngraph::Shape{1},
+                                                           mulConstant->cast_vector<int8_t>());
+        swappedAdd->set_friendly_name(addConstant->get_friendly_name());
+        ngraph::replace_node(mulConstant, swappedMul);
+        ngraph::replace_node(addConstant, swappedAdd);
+    };
+    swapConstants(net2);
+    ASSERT_NE(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net2, {}));
+    // Swapping the values back gives the original network
+    swapConstants(net2);
+    ASSERT_EQ(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net2, {}));
+}
+
+TEST(NetworkContext_CNNNetwork, HashWithDifferentAttributes) {
+    auto createSoftmaxNetwork = [](size_t axis) {
+        auto data = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{3, 2});
+        data->set_friendly_name("Parameter");
+        auto softmax = std::make_shared<ngraph::opset6::Softmax>(data, axis);
+        softmax->set_friendly_name("softmax");
+        auto res = std::make_shared<ngraph::opset6::Result>(softmax);
+        res->set_friendly_name("res");
+        return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{res}, ngraph::ParameterVector{data}));
+    };
+    ASSERT_NE(NetworkCompilationContext::computeHash(createSoftmaxNetwork(0), {}),
+              NetworkCompilationContext::computeHash(createSoftmaxNetwork(1), {}));
+    ASSERT_EQ(NetworkCompilationContext::computeHash(createSoftmaxNetwork(1), {}),
+              NetworkCompilationContext::computeHash(createSoftmaxNetwork(1), {}));
+}
+
 // Verify all internal hash calculations are thread-safe (like ngraph::function serialization)
 TEST(NetworkContext_CNNNetwork, HashOfSameMultiThreading) {
     auto net1 = createNetwork();
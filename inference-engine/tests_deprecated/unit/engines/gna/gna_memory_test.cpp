@@ -436,4 +436,74 @@ TEST_F(GNAMemoryTest, canUpdateSizeOfPushRequestWithBindRequestWhenAlloc) {
     ASSERT_FLOAT_EQ(pFutureInput[0], 1);
     ASSERT_FLOAT_EQ(pFutureInput[1], 2);
     ASSERT_FLOAT_EQ(pFutureInput[2], 3);
-}
\ No newline at end of file
+}
+
+TEST_F(GNAMemoryTest, canShareMemoryOfRequestsNotAliveAtSameTime) {
+    float *pFuture1 = nullptr;
+    float *pFuture2 = nullptr;
+    float *pFuture3 = nullptr;
+    float *pInput2 = nullptr;
+    float *pInput3 = nullptr;
+
+    // each layer reads output of the previous one
+    mem.set_life_index(0);
+    mem.reserve_ptr(&pFuture1, 64, 64);
+    mem.set_life_index(1);
+    mem.bind_ptr(&pInput2, &pFuture1);
+    mem.reserve_ptr(&pFuture2, 64, 64);
+    mem.set_life_index(2);
+    mem.bind_ptr(&pInput3, &pFuture2);
+    mem.reserve_ptr(&pFuture3, 64, 64);
+    mem.set_life_index(-1);
+
+    mem.commit();
+
+    ASSERT_EQ(mem.getTotalBytes(), 128);
+    ASSERT_EQ(mem.getReusedBytes(), 64);
+    ASSERT_EQ(pFuture1, pFuture3);
+    ASSERT_NE(pFuture1, pFuture2);
+    ASSERT_EQ(pInput2, pFuture1);
+    ASSERT_EQ(pInput3, pFuture2);
+}
+
+TEST_F(GNAMemoryTest, canNotShareMemoryBoundOutOfLayers) {
+    float *pFuture1 = nullptr;
+    float *pFuture2 = nullptr;
+    float *pFuture3 = nullptr;
+    float *pOutput = nullptr;
+
+    mem.set_life_index(0);
+    mem.reserve_ptr(&pFuture1, 64, 64);
+    mem.set_life_index(1);
+    mem.reserve_ptr(&pFuture2, 64, 64);
+    mem.set_life_index(2);
+    mem.reserve_ptr(&pFuture3, 64, 64);
+    mem.set_life_index(-1);
+    // output of the first layer is read after inference
+    mem.bind_ptr(&pOutput, &pFuture1);
+
+    mem.commit();
+
+    ASSERT_EQ(mem.getTotalBytes(), 128);
+    ASSERT_EQ(pFuture2, pFuture3);
+    ASSERT_NE(pFuture1, pFuture2);
+    ASSERT_EQ(pOutput, pFuture1);
+}
+
+TEST_F(GNAMemoryTest, canKeepAliveMemoryOfLayer) {
+    float *pFuture1 = nullptr;
+    float *pFuture2 = nullptr;
+
+    mem.set_life_index(0);
+    mem.reserve_ptr(&pFuture1, 64, 64);
+    mem.set_life_index(1);
+    mem.reserve_ptr(&pFuture2, 64, 64);
+    mem.set_life_index(-1);
+    mem.keep_alive(&pFuture1);
+
+    mem.commit();
+
+    ASSERT_EQ(mem.getTotalBytes(), 128);
+    ASSERT_EQ(mem.getReusedBytes(), 0);
+    ASSERT_NE(pFuture1, pFuture2);
+}
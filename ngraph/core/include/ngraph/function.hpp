@@ -8,6 +8,7 @@
 #include <initializer_list>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -86,7 +87,7 @@ namespace ngraph
                  const SinkVector& sinks,
                  const std::string& name = "");
 
-        virtual ~Function() = default;
+        virtual ~Function();
         /// Return the number of outputs for this function.
         size_t get_output_size() const;
 
@@ -253,12 +254,22 @@ namespace ngraph
         /// function and registers them, otherwise checks all the Parameters are registered.
         void prerequirements(bool detect_variables, bool detect_parameters);
 
+        /// \brief Drops the cached topological order, is called on changes of the function
+        /// parameters, results and sinks which aren't tracked by nodes.
+        void invalidate_topological_cache();
+
         static std::atomic<size_t> m_next_instance_id;
         std::string m_name;
         const std::string m_unique_name;
         size_t m_placement{0};
         topological_sort_t m_topological_sorter;
 
+        // Topological order is cached until any node of the function changes its inputs or
+        // control dependencies. Weak pointers let the removed nodes die with the cache alive.
+        std::shared_ptr<SharedRTInfo> m_shared_rt_info;
+        mutable std::vector<std::weak_ptr<Node>> m_cached_ordered_ops;
+        mutable std::mutex m_topological_cache_mutex;
+
         ResultVector m_results;
         // List of the nodes with side effect in graph.
         // These nodes are not outputs of graph but should not be removed even if have no children.
@@ -0,0 +1,91 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/node.hpp"
+#include "ngraph/runtime/host_tensor.hpp"
+
+namespace ngraph
+{
+    /// \brief Prepared evaluation of a function for repeated calls
+    ///
+    /// The nodes are ordered, the tensors are mapped to slots and the lifetimes of the
+    /// intermediate tensors are computed once at construction. Intermediate tensors with static
+    /// shapes share a pool of buffers allocated once, so evaluate() allocates memory only for
+    /// the outputs of the nodes with dynamic shapes. Constants are passed to their consumers
+    /// without copying.
+    ///
+    /// With more than one thread the nodes are grouped into levels of mutually independent
+    /// nodes, and the nodes of a level are evaluated in parallel with runtime::parallel_for, so
+    /// they run on the threads of the installed threading backend. Without a backend the nodes
+    /// are evaluated serially. Nodes which access variables are always evaluated by the calling
+    /// thread.
+    ///
+    /// The evaluator owns the intermediate buffers, so it must not be used by several threads
+    /// at the same time. The function must not be changed while the evaluator is alive.
+    class NGRAPH_API FunctionEvaluator
+    {
+    public:
+        /// \brief Prepares the evaluation of the function
+        /// \param function The function to evaluate
+        /// \param num_threads The maximum number of nodes evaluated in parallel, 0 means the
+        ///        number of hardware threads
+        FunctionEvaluator(const std::shared_ptr<const Function>& function,
+                          size_t num_threads = 1);
+
+        /// \brief Evaluates the function, the same as Function::evaluate
+        /// \param output_tensors Tensors for the results of the function
+        /// \param input_tensors Tensors for the parameters of the function
+        /// \param evaluation_context Storage of the variables and other context
+        bool evaluate(const HostTensorVector& output_tensors,
+                      const HostTensorVector& input_tensors,
+                      EvaluationContext evaluation_context = EvaluationContext());
+
+        /// \brief The evaluated function
+        const std::shared_ptr<const Function>& get_function() const { return m_function; }
+
+        /// \brief Size in bytes of the buffers shared by the intermediate tensors
+        size_t get_intermediate_buffers_size() const;
+
+        /// \brief Number of groups of nodes evaluated one after another
+        size_t get_level_count() const { return m_levels.size(); }
+
+    private:
+        struct Step
+        {
+            Node* node;
+            std::vector<size_t> inputs;
+            std::vector<size_t> outputs;
+            bool serial;
+        };
+
+        struct DynamicSlot
+        {
+            size_t slot;
+            element::Type element_type;
+            PartialShape shape;
+        };
+
+        void evaluate_step(const Step& step, const EvaluationContext& evaluation_context);
+        void evaluate_level(const std::vector<Step>& level,
+                            const EvaluationContext& evaluation_context);
+
+        std::shared_ptr<const Function> m_function;
+        size_t m_num_threads;
+        std::vector<std::vector<Step>> m_levels;
+        /// Tensors by slot: bound to the buffers, constants and, during evaluate(), to the
+        /// function inputs and outputs
+        HostTensorVector m_tensors;
+        std::vector<size_t> m_parameter_slots;
+        std::vector<size_t> m_result_slots;
+        /// Slots of the intermediate tensors which get a new tensor on every evaluation
+        std::vector<DynamicSlot> m_dynamic_slots;
+        HostTensorVector m_buffers;
+    };
+} // namespace ngraph
@@ -10,6 +10,7 @@
 #include <iostream>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 #include <tuple>
@@ -49,6 +50,7 @@ namespace ngraph
     class Node;
 
     class Function;
+    class SharedRTInfo;
 
     namespace runtime
     {
@@ -136,6 +138,9 @@ namespace ngraph
         template <typename NodeType>
         friend class Output;
 
+        // For access to m_shared_rt_info.
+        friend class Function;
+
     public:
         /// \brief Verifies that attributes and inputs are consistent and computes output shapes
         /// and element types. Must be implemented by concrete child classes so that it
@@ -493,6 +498,15 @@ namespace ngraph
         descriptor::Input& get_input_descriptor(size_t position);
         descriptor::Output& get_output_descriptor(size_t position);
 
+        /// \brief Marks topological orders cached by the functions this node belongs to as
+        /// outdated. Must be called on every change of node inputs or control dependencies.
+        void invalidate_topological_caches();
+
+        /// \brief Attaches or detaches the information of a function which order contains the
+        /// node. Different functions may share the node, so the set is guarded by the node.
+        void insert_shared_rt_info(const std::shared_ptr<SharedRTInfo>& info);
+        void erase_shared_rt_info(const std::shared_ptr<SharedRTInfo>& info);
+
         std::vector<Node*> m_control_dependents;
         std::vector<std::shared_ptr<Node>> m_control_dependencies;
         std::string m_node_type;
@@ -502,6 +516,9 @@ namespace ngraph
         static std::atomic<size_t> m_next_instance_id;
         std::unordered_set<std::string> m_provenance_tags;
         std::set<std::shared_ptr<Node>> m_provenance_group;
+        // Declared before m_inputs as inputs access it on destruction
+        std::set<std::shared_ptr<SharedRTInfo>> m_shared_rt_info;
+        mutable std::mutex m_shared_rt_info_mutex;
         std::deque<descriptor::Input> m_inputs;
         std::deque<descriptor::Output> m_outputs;
         std::shared_ptr<ngraph::op::util::OpAnnotations> m_op_annotations;
@@ -4,6 +4,10 @@
 
 #pragma once
 
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
 #include "ngraph/pass/pass.hpp"
 
 namespace ngraph
@@ -14,6 +18,12 @@ namespace ngraph
          * @brief Constant folding iterates over the function and tries to evaluate nodes
          *        with constant inputs. Such nodes are then replaced with new Constants containing
          *        the result of a folded operation.
+         *
+         *        Independent nodes with constant inputs are folded in parallel with the threading
+         *        backend of the reference kernels (see ngraph::runtime::set_parallel_for). Only
+         *        the nodes with a replaced or changed input are validated again, and the folded
+         *        nodes are released right away, so the intermediate constants are freed once
+         *        all their consumers are folded.
          */
         class NGRAPH_API ConstantFolding : public FunctionPass
         {
@@ -22,11 +32,28 @@ namespace ngraph
             bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
 
         private:
+            using NodeSet = std::unordered_set<Node*>;
+
             void copy_runtime_info_to_target_inputs(const std::shared_ptr<Node>& node,
                                                     const Output<Node>& replacement);
             /// \brief Folds pre-calculated output tensor values to constants in case lower and
             /// upper estimations are equal. Traverses graph backwards starting from the results.
-            bool pre_calculated_values_folding(const std::shared_ptr<ngraph::Function>& f);
+            /// Consumers of the new constants are added to nodes_to_validate.
+            bool pre_calculated_values_folding(const std::shared_ptr<ngraph::Function>& f,
+                                               NodeSet& nodes_to_validate);
+            /// \brief Folds the nodes which depend on constants only, level by level. The nodes
+            /// of a level are folded in parallel. Sets processed[i] for the nodes it tried.
+            /// node_indices maps the nodes to their positions in nodes.
+            bool fold_constant_subgraphs(
+                std::vector<std::shared_ptr<Node>>& nodes,
+                std::vector<bool>& processed,
+                const std::unordered_map<Node*, size_t>& node_indices,
+                NodeSet& nodes_to_validate);
+            /// \brief Replaces the outputs of a folded node and adds the consumers of the
+            /// replacements to nodes_to_validate
+            bool replace_outputs(const std::shared_ptr<Node>& node,
+                                 const OutputVector& replacements,
+                                 NodeSet& nodes_to_validate);
         };
     } // namespace pass
 } // namespace ngraph
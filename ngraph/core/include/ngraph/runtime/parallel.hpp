@@ -0,0 +1,40 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+#include "ngraph/ngraph_visibility.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        /// \brief Body of a parallel loop, processes the items [begin, end)
+        using parallel_body_t = std::function<void(size_t begin, size_t end)>;
+
+        /// \brief Runs the body over disjoint ranges covering [0, work_amount), possibly in
+        ///        parallel, and returns when all ranges are processed
+        using parallel_for_t = void (*)(size_t work_amount, const parallel_body_t& body);
+
+        /// \brief Default number of work items below which a loop is not split
+        constexpr size_t default_parallel_grain = 1 << 15;
+
+        /// \brief Installs the threading backend of the reference kernels. nullptr, the default,
+        ///        makes all kernels serial. The Inference Engine installs a backend based on its
+        ///        own threading library.
+        NGRAPH_API void set_parallel_for(parallel_for_t parallel_for);
+
+        NGRAPH_API parallel_for_t get_parallel_for();
+
+        /// \brief Runs the body over [0, work_amount) with the installed threading backend.
+        ///        Every range has at least grain_size items, so small loops run serially on the
+        ///        calling thread.
+        NGRAPH_API void parallel_for(size_t work_amount,
+                                     size_t grain_size,
+                                     const parallel_body_t& body);
+    } // namespace runtime
+} // namespace ngraph
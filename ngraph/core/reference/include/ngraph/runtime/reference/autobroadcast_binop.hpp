@@ -10,6 +10,7 @@
 #include <utility>
 #include "ngraph/coordinate_transform.hpp"
 #include "ngraph/op/util/attr_types.hpp"
+#include "ngraph/runtime/parallel.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph
@@ -84,43 +85,16 @@ namespace ngraph
                         --axis;
                     return axis;
                 }
-            } // namespace internal
 
-            /// \brief Helper function to implement autobroadcasting elementwise binop references.
-            ///
-            /// \tparam T Element type of the input tensors.
-            /// \tparam U Element type of the output tensor.
-            /// \tparam Functor Type of the functor for the elementwise operation. Must support
-            ///                 operator()(T,T), and operator()(T,T) must return a value of type
-            ///                 U.
-            ///
-            /// \param arg0 Pointer to the buffer for left operand input tensor.
-            /// \param arg1 Pointer to the buffer for right operand input tensor.
-            /// \param out Pointer to the buffer for output tensor. This must be pre-allocated by
-            ///            the caller, and must be large enough to hold a tensor of the correct
-            ///            shape.
-            /// \param broadcast_spec Specification of the auto-broadcasting scheme.
-            /// \param elementwise_functor Functor implementing the elementwise operation to be
-            ///                            applied across the input tensors. Must accept two
-            ///                            arguments of type T, and return a value of type U.
-            template <typename T, typename U, typename Functor>
-            void autobroadcast_binop(const T* arg0,
-                                     const T* arg1,
-                                     U* out,
-                                     const Shape& arg0_shape,
-                                     const Shape& arg1_shape,
-                                     const op::AutoBroadcastSpec& broadcast_spec,
-                                     Functor elementwise_functor)
-            {
-                switch (broadcast_spec.m_type)
+                /// \brief Serial NUMPY broadcasting of the whole tensors
+                template <typename T, typename U, typename Functor>
+                void serial_numpy_autobroadcast_binop(const T* arg0,
+                                                      const T* arg1,
+                                                      U* out,
+                                                      const Shape& arg0_shape,
+                                                      const Shape& arg1_shape,
+                                                      Functor elementwise_functor)
                 {
-                case op::AutoBroadcastType::NONE:
-                    for (size_t i = 0; i < shape_size(arg0_shape); i++)
-                    {
-                        out[i] = elementwise_functor(arg0[i], arg1[i]);
-                    }
-                    break;
-                case op::AutoBroadcastType::NUMPY:
                     // We'll be using CoordinateTransform to handle the broadcasting. The general
                     // procedure is as follows:
                     //
@@ -143,8 +117,6 @@ namespace ngraph
                     //                 ------------
                     //                 [ 3, 2, 6]
                     {
-                        using namespace internal;
-
                         size_t const shape_rank =
                             std::max(arg0_shape.size(), arg1_shape.size()) + 1;
 
@@ -251,6 +223,136 @@ namespace ngraph
                                                             elementwise_functor);
 #endif
                     }
+                }
+
+                /// \brief NUMPY broadcasting split over the leading dimensions of the output.
+                ///        Each task broadcasts the slices of the inputs over the trailing ones.
+                template <typename T, typename U, typename Functor>
+                void parallel_numpy_autobroadcast_binop(const T* arg0,
+                                                        const T* arg1,
+                                                        U* out,
+                                                        const Shape& arg0_shape,
+                                                        const Shape& arg1_shape,
+                                                        Functor elementwise_functor)
+                {
+                    // Slices smaller than this are not worth the setup of the broadcasting
+                    constexpr size_t min_slice_size = 1024;
+
+                    const size_t rank = std::max(arg0_shape.size(), arg1_shape.size());
+                    Shape shape0(rank - arg0_shape.size(), 1);
+                    shape0.insert(shape0.end(), arg0_shape.begin(), arg0_shape.end());
+                    Shape shape1(rank - arg1_shape.size(), 1);
+                    shape1.insert(shape1.end(), arg1_shape.begin(), arg1_shape.end());
+                    Shape output_shape(rank);
+                    for (size_t i = 0; i < rank; i++)
+                    {
+                        output_shape[i] = std::max(shape0[i], shape1[i]);
+                    }
+                    const size_t output_size = shape_size(output_shape);
+
+                    if (shape0 == shape1)
+                    {
+                        parallel_for(output_size,
+                                     default_parallel_grain,
+                                     [&](size_t begin, size_t end) {
+                                         for (size_t i = begin; i < end; ++i)
+                                             out[i] = elementwise_functor(arg0[i], arg1[i]);
+                                     });
+                        return;
+                    }
+
+                    size_t split_axis = 0;
+                    size_t outer_size = 1;
+                    if (output_size >= 2 * default_parallel_grain)
+                    {
+                        while (split_axis + 1 < rank &&
+                               output_size / (outer_size * output_shape[split_axis]) >=
+                                   min_slice_size)
+                        {
+                            outer_size *= output_shape[split_axis++];
+                        }
+                    }
+                    if (outer_size < 2)
+                    {
+                        serial_numpy_autobroadcast_binop(
+                            arg0, arg1, out, arg0_shape, arg1_shape, elementwise_functor);
+                        return;
+                    }
+
+                    const Shape slice_shape0(shape0.begin() + split_axis, shape0.end());
+                    const Shape slice_shape1(shape1.begin() + split_axis, shape1.end());
+                    const size_t slice_size = output_size / outer_size;
+                    const auto strides0 = ngraph::row_major_strides(shape0);
+                    const auto strides1 = ngraph::row_major_strides(shape1);
+                    parallel_for(
+                        outer_size,
+                        std::max<size_t>(1, default_parallel_grain / slice_size),
+                        [&](size_t begin, size_t end) {
+                            for (size_t slice = begin; slice < end; ++slice)
+                            {
+                                size_t offset0 = 0;
+                                size_t offset1 = 0;
+                                for (size_t i = split_axis, index = slice; i-- > 0;)
+                                {
+                                    const size_t coordinate = index % output_shape[i];
+                                    index /= output_shape[i];
+                                    if (shape0[i] != 1)
+                                        offset0 += coordinate * strides0[i];
+                                    if (shape1[i] != 1)
+                                        offset1 += coordinate * strides1[i];
+                                }
+                                serial_numpy_autobroadcast_binop(arg0 + offset0,
+                                                                 arg1 + offset1,
+                                                                 out + slice * slice_size,
+                                                                 slice_shape0,
+                                                                 slice_shape1,
+                                                                 elementwise_functor);
+                            }
+                        });
+                }
+            } // namespace internal
+
+            /// \brief Helper function to implement autobroadcasting elementwise binop references.
+            ///
+            /// \tparam T Element type of the input tensors.
+            /// \tparam U Element type of the output tensor.
+            /// \tparam Functor Type of the functor for the elementwise operation. Must support
+            ///                 operator()(T,T), and operator()(T,T) must return a value of type
+            ///                 U.
+            ///
+            /// \param arg0 Pointer to the buffer for left operand input tensor.
+            /// \param arg1 Pointer to the buffer for right operand input tensor.
+            /// \param out Pointer to the buffer for output tensor. This must be pre-allocated by
+            ///            the caller, and must be large enough to hold a tensor of the correct
+            ///            shape.
+            /// \param broadcast_spec Specification of the auto-broadcasting scheme.
+            /// \param elementwise_functor Functor implementing the elementwise operation to be
+            ///                            applied across the input tensors. Must accept two
+            ///                            arguments of type T, and return a value of type U.
+            template <typename T, typename U, typename Functor>
+            void autobroadcast_binop(const T* arg0,
+                                     const T* arg1,
+                                     U* out,
+                                     const Shape& arg0_shape,
+                                     const Shape& arg1_shape,
+                                     const op::AutoBroadcastSpec& broadcast_spec,
+                                     Functor elementwise_functor)
+            {
+                switch (broadcast_spec.m_type)
+                {
+                case op::AutoBroadcastType::NONE:
+                    parallel_for(shape_size(arg0_shape),
+                                 default_parallel_grain,
+                                 [&](size_t begin, size_t end) {
+                                     for (size_t i = begin; i < end; i++)
+                                     {
+                                         out[i] = elementwise_functor(arg0[i], arg1[i]);
+                                     }
+                                 });
+                    break;
+                case op::AutoBroadcastType::NUMPY:
+                    internal::parallel_numpy_autobroadcast_binop(
+                        arg0, arg1, out, arg0_shape, arg1_shape, elementwise_functor);
                     break;
                 case op::AutoBroadcastType::PDPD:
                     // We'll be using CoordinateTransform to handle the broadcasting. No need to
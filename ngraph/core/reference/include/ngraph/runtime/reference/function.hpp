@@ -8,6 +8,7 @@
 #include <cstddef>
 #include <vector>
 #include "ngraph/function.hpp"
+#include "ngraph/function_evaluator.hpp"
 
 namespace ngraph
 {
@@ -18,6 +19,12 @@ namespace ngraph
             void function(const std::shared_ptr<Function>& function,
                           const HostTensorVector& inputs,
                           HostTensorVector& outputs);
+
+            /// \brief Evaluates the function with a prepared evaluator, for the functions which
+            ///        are evaluated repeatedly, e.g. the bodies of loops
+            void function(FunctionEvaluator& evaluator,
+                          const HostTensorVector& inputs,
+                          HostTensorVector& outputs);
         }
     } // namespace runtime
 } // namespace ngraph
@@ -4,8 +4,10 @@
 
 #pragma once
 
+#include <algorithm>
 #include <numeric>
 
+#include "ngraph/runtime/parallel.hpp"
 #include "ngraph/shape.hpp"
 #include "utils/span.hpp"
 
@@ -37,30 +39,36 @@ namespace ngraph
                 int64_t batch_indices_mul = shape_size(span(indices_shape).subspan(batch_dims));
 
                 int64_t axis_size = data_shape[axis];
-                int64_t data_offset, out_offset, idx;
 
-                for (int64_t batch = 0; batch < batch_size; batch++)
-                    for (int64_t outer_idx = 0; outer_idx < outer_size; outer_idx++)
+                // Every copied slice of inner_size elements is independent
+                const size_t slices_count = batch_size * outer_size * indices_size;
+                const size_t slice_size = std::max<int64_t>(inner_size, 1);
+                const size_t grain = std::max<size_t>(1, default_parallel_grain / slice_size);
+                parallel_for(slices_count, grain, [&](size_t begin, size_t end) {
+                    for (size_t slice = begin; slice < end; ++slice)
                     {
-                        data_offset = batch_data_mul * batch + inner_size * axis_size * outer_idx;
-                        out_offset = batch_out_mul * batch + indices_size * inner_size * outer_idx;
-                        for (int64_t i = 0; i < indices_size; i++)
-                        {
-                            idx = indices[i + batch_indices_mul * batch];
-                            // clang-format off
-                            // todo: check if bound check is needed
-                            // if (idx >= axis_size || (idx < 0 && -idx >= axis_size))
-                            //    throw std::domain_error{"indices values of Gather exceed size along axis"};
-                            // clang-format on
-                            if (idx < 0)
-                                idx += axis_size;
+                        const int64_t i = slice % indices_size;
+                        const int64_t outer_idx = (slice / indices_size) % outer_size;
+                        const int64_t batch = slice / (indices_size * outer_size);
+                        const int64_t data_offset =
+                            batch_data_mul * batch + inner_size * axis_size * outer_idx;
+                        const int64_t out_offset =
+                            batch_out_mul * batch + indices_size * inner_size * outer_idx;
+                        int64_t idx = indices[i + batch_indices_mul * batch];
+                        // clang-format off
+                        // todo: check if bound check is needed
+                        // if (idx >= axis_size || (idx < 0 && -idx >= axis_size))
+                        //    throw std::domain_error{"indices values of Gather exceed size along axis"};
+                        // clang-format on
+                        if (idx < 0)
+                            idx += axis_size;
 
-                            const auto src_begin = std::next(data, data_offset + inner_size * idx);
-                            const auto src_end = std::next(src_begin, inner_size);
-                            const auto out_ptr = std::next(out, out_offset + inner_size * i);
-                            std::copy(src_begin, src_end, out_ptr);
-                        }
+                        const auto src_begin = std::next(data, data_offset + inner_size * idx);
+                        const auto src_end = std::next(src_begin, inner_size);
+                        const auto out_ptr = std::next(out, out_offset + inner_size * i);
+                        std::copy(src_begin, src_end, out_ptr);
                     }
+                });
             }
 
         } // namespace reference
@@ -4,12 +4,14 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 #include <numeric>
 #include <utility>
 #include <vector>
 
 #include "ngraph/runtime/opt_kernel/reshape.hpp"
+#include "ngraph/runtime/parallel.hpp"
 #include "ngraph/runtime/reference/broadcast.hpp"
 #include "ngraph/shape_util.hpp"
 
@@ -21,15 +23,43 @@ namespace ngraph
         {
             namespace details
             {
+                /// \brief Multiplies rows of {rows, K} by {K, J}, the inner loop is contiguous
                 template <typename T>
-                void dot(const T* arg0,
-                         const T* arg1,
-                         T* out,
-                         const Shape& arg0_shape,
-                         const Shape& arg1_shape,
-                         const Shape& out_shape)
+                void dot_rows(const T* arg0,
+                              const T* arg1,
+                              T* out,
+                              size_t rows,
+                              size_t K_dim,
+                              size_t J_dim)
+                {
+                    std::fill(out, out + rows * J_dim, T{0});
+                    for (size_t i = 0; i < rows; ++i)
+                    {
+                        for (size_t k = 0; k < K_dim; ++k)
+                        {
+                            const T a = arg0[i * K_dim + k];
+                            const T* b = arg1 + k * J_dim;
+                            T* c = out + i * J_dim;
+                            for (size_t j = 0; j < J_dim; ++j)
+                            {
+                                c[j] += a * b[j];
+                            }
+                        }
+                    }
+                }
+
+                /// \brief Computes batches of dot products in parallel over the output rows
+                template <typename T>
+                void batched_dot(const T* arg0,
+                                 const T* arg1,
+                                 T* out,
+                                 const Shape& arg0_shape,
+                                 const Shape& arg1_shape,
+                                 size_t batch_size,
+                                 size_t arg0_offset,
+                                 size_t arg1_offset,
+                                 size_t output_offset)
                 {
-                    std::fill(out, out + shape_size(out_shape), T{0});
                     const size_t arg0_rank = arg0_shape.size();
                     const size_t arg1_rank = arg1_shape.size();
 
@@ -41,19 +71,35 @@ namespace ngraph
                     const size_t K_dim =
                         arg1_rank == 1 ? arg1_shape[arg1_rank - 1] : arg1_shape[arg1_rank - 2];
 
-                    for (size_t i = 0; i < I_dim; ++i)
-                    {
-                        for (size_t k = 0; k < K_dim; ++k)
-                        {
-                            const size_t a_idx = i * K_dim + k;
-                            for (size_t j = 0; j < J_dim; ++j)
-                            {
-                                const size_t b_idx = k * J_dim + j;
-                                const size_t out_idx = i * J_dim + j;
-                                out[out_idx] += arg0[a_idx] * arg1[b_idx];
-                            }
-                        }
-                    }
+                    const size_t row_work = std::max<size_t>(1, J_dim * K_dim);
+                    parallel_for(batch_size * I_dim,
+                                 std::max<size_t>(1, default_parallel_grain / row_work),
+                                 [&](size_t begin, size_t end) {
+                                     for (size_t row = begin; row < end;)
+                                     {
+                                         const size_t batch = row / I_dim;
+                                         const size_t i = row % I_dim;
+                                         const size_t rows = std::min(end - row, I_dim - i);
+                                         dot_rows(arg0 + batch * arg0_offset + i * K_dim,
+                                                  arg1 + batch * arg1_offset,
+                                                  out + batch * output_offset + i * J_dim,
+                                                  rows,
+                                                  K_dim,
+                                                  J_dim);
+                                         row += rows;
+                                     }
+                                 });
+                }
+
+                template <typename T>
+                void dot(const T* arg0,
+                         const T* arg1,
+                         T* out,
+                         const Shape& arg0_shape,
+                         const Shape& arg1_shape,
+                         const Shape& out_shape)
+                {
+                    batched_dot(arg0, arg1, out, arg0_shape, arg1_shape, 1, 0, 0, 0);
                 }
 
                 std::vector<size_t> get_transpose_order(const Shape& input_shape);
@@ -235,15 +281,15 @@ namespace ngraph
                 const size_t arg0_offset = (arg0_rank > 2) ? shape_size(dot_arg0_shape) : 0;
                 const size_t arg1_offset = (arg1_rank > 2) ? shape_size(dot_arg1_shape) : 0;
                 const size_t output_offset = shape_size(dot_output_shape);
-                for (size_t i = 0; i < output_batch_size; i++)
-                {
-                    details::dot(arg0_data + i * arg0_offset,
-                                 arg1_data + i * arg1_offset,
-                                 out + i * output_offset,
-                                 dot_arg0_shape,
-                                 dot_arg1_shape,
-                                 dot_output_shape);
-                }
+                details::batched_dot(arg0_data,
+                                     arg1_data,
+                                     out,
+                                     dot_arg0_shape,
+                                     dot_arg1_shape,
+                                     output_batch_size,
+                                     arg0_offset,
+                                     arg1_offset,
+                                     output_offset);
             }
         } // namespace reference
     }     // namespace runtime
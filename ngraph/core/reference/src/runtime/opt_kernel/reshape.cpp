@@ -7,6 +7,7 @@
 
 #include "ngraph/check.hpp"
 #include "ngraph/runtime/opt_kernel/reshape.hpp"
+#include "ngraph/runtime/parallel.hpp"
 #include "ngraph/runtime/reference/reshape.hpp"
 
 using namespace ngraph;
@@ -50,7 +51,9 @@ namespace
                      const Shape& in_shape,
                      const AxisVector& in_axis_order,
                      const Shape& out_shape,
-                     size_t elem_size)
+                     size_t elem_size,
+                     size_t begin,
+                     size_t end)
     {
         size_t size[2];
         size_t in_index[2];
@@ -60,7 +63,7 @@ namespace
             size[i] = in_shape[in_axis_order[i]];
             map_index[in_axis_order[i]] = &in_index[i];
         }
-        for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
+        for (in_index[0] = begin; in_index[0] < end; ++in_index[0])
         {
             for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
             {
@@ -80,7 +83,9 @@ namespace
                      const Shape& in_shape,
                      const AxisVector& in_axis_order,
                      const Shape& out_shape,
-                     size_t elem_size)
+                     size_t elem_size,
+                     size_t begin,
+                     size_t end)
     {
         size_t size[3];
         size_t in_index[3];
@@ -90,7 +95,7 @@ namespace
             size[i] = in_shape[in_axis_order[i]];
             map_index[in_axis_order[i]] = &in_index[i];
         }
-        for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
+        for (in_index[0] = begin; in_index[0] < end; ++in_index[0])
         {
             for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
             {
@@ -114,7 +119,9 @@ namespace
                      const Shape& in_shape,
                      const AxisVector& in_axis_order,
                      const Shape& out_shape,
-                     size_t elem_size)
+                     size_t elem_size,
+                     size_t begin,
+                     size_t end)
     {
         size_t size[4];
         size_t in_index[4];
@@ -124,7 +131,7 @@ namespace
             size[i] = in_shape[in_axis_order[i]];
             map_index[in_axis_order[i]] = &in_index[i];
         }
-        for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
+        for (in_index[0] = begin; in_index[0] < end; ++in_index[0])
         {
             for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
             {
@@ -152,7 +159,9 @@ namespace
                      const Shape& in_shape,
                      const AxisVector& in_axis_order,
                      const Shape& out_shape,
-                     size_t elem_size)
+                     size_t elem_size,
+                     size_t begin,
+                     size_t end)
     {
         size_t size[5];
         size_t in_index[5];
@@ -162,7 +171,7 @@ namespace
             size[i] = in_shape[in_axis_order[i]];
             map_index[in_axis_order[i]] = &in_index[i];
         }
-        for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
+        for (in_index[0] = begin; in_index[0] < end; ++in_index[0])
         {
             for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
             {
@@ -194,7 +203,9 @@ namespace
                      const Shape& in_shape,
                      const AxisVector& in_axis_order,
                      const Shape& out_shape,
-                     size_t elem_size)
+                     size_t elem_size,
+                     size_t begin,
+                     size_t end)
     {
         size_t size[6];
         size_t in_index[6];
@@ -204,7 +215,7 @@ namespace
             size[i] = in_shape[in_axis_order[i]];
             map_index[in_axis_order[i]] = &in_index[i];
         }
-        for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
+        for (in_index[0] = begin; in_index[0] < end; ++in_index[0])
         {
             for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
             {
@@ -255,15 +266,36 @@ void runtime::opt_kernel::reshape(const char* in,
         return;
     }
 
+    decltype(&reshape_in2) reshape_in = nullptr;
     switch (in_shape.size())
     {
-    case 0: reshape_in0(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 1: reshape_in1(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 2: reshape_in2(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 3: reshape_in3(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 4: reshape_in4(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 5: reshape_in5(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 6: reshape_in6(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    default: reference::reshape(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
+    case 0: reshape_in0(in, out, in_shape, in_axis_order, out_shape, elem_size); return;
+    case 1: reshape_in1(in, out, in_shape, in_axis_order, out_shape, elem_size); return;
+    case 2: reshape_in = reshape_in2; break;
+    case 3: reshape_in = reshape_in3; break;
+    case 4: reshape_in = reshape_in4; break;
+    case 5: reshape_in = reshape_in5; break;
+    case 6: reshape_in = reshape_in6; break;
+    default: reference::reshape(in, out, in_shape, in_axis_order, out_shape, elem_size); return;
+    }
+
+    if (shape_size(in_shape) == 0)
+    {
+        return;
     }
+    // Output rows along the outermost output axis are independent
+    const size_t rows = in_shape[in_axis_order[0]];
+    const size_t row_size = shape_size(in_shape) / rows;
+    runtime::parallel_for(rows,
+                          std::max<size_t>(1, runtime::default_parallel_grain / row_size),
+                          [&](size_t begin, size_t end) {
+                              reshape_in(in,
+                                         out + begin * row_size * elem_size,
+                                         in_shape,
+                                         in_axis_order,
+                                         out_shape,
+                                         elem_size,
+                                         begin,
+                                         end);
+                          });
 }
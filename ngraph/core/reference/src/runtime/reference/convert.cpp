@@ -216,18 +216,21 @@ namespace ngraph
                 {
                     auto converter = jit_convert_array::get<TI, TO>();
 
-                    if (converter)
-                    {
-                        jit_convert_array::args_t args = {arg, out, count};
-                        converter(&args);
-                    }
-                    else
-                    {
-                        for (size_t i = 0; i < count; ++i)
+                    parallel_for(count, default_parallel_grain, [&](size_t begin, size_t end) {
+                        if (converter)
                         {
-                            out[i] = static_cast<TO>(arg[i]);
+                            jit_convert_array::args_t args = {
+                                arg + begin, out + begin, end - begin};
+                            converter(&args);
                         }
-                    }
+                        else
+                        {
+                            for (size_t i = begin; i < end; ++i)
+                            {
+                                out[i] = static_cast<TO>(arg[i]);
+                            }
+                        }
+                    });
                 }
             } // namespace
 
@@ -85,16 +85,14 @@ namespace ngraph
                 return true;
             }
 
-            void function(const std::shared_ptr<ngraph::Function>& function,
-                          const HostTensorVector& inputs,
-                          HostTensorVector& outputs)
+            static void check_inputs(const Function& function, const HostTensorVector& inputs)
             {
-                const auto& parameters = function->get_parameters();
+                const auto& parameters = function.get_parameters();
                 const auto& parametersNumber = parameters.size();
                 const auto& inputsNumber = inputs.size();
                 NGRAPH_CHECK(parametersNumber == inputsNumber,
                              "Got function (",
-                             function->get_friendly_name(),
+                             function.get_friendly_name(),
                              ") with ",
                              parametersNumber,
                              " parameters, but ",
@@ -103,7 +101,7 @@ namespace ngraph
 
                 for (const auto& parameter : parameters)
                 {
-                    const auto& parameterIndex = function->get_parameter_index(parameter);
+                    const auto& parameterIndex = function.get_parameter_index(parameter);
                     const auto& parameterShape = parameter->get_shape();
                     const auto& parameterType = parameter->get_element_type();
                     const auto& parameterSize = shape_size(parameterShape) * parameterType.size();
@@ -121,6 +119,13 @@ namespace ngraph
                                  inputSize,
                                  " bytes");
                 }
+            }
+
+            void function(const std::shared_ptr<ngraph::Function>& function,
+                          const HostTensorVector& inputs,
+                          HostTensorVector& outputs)
+            {
+                check_inputs(*function, inputs);
 
                 const auto& results = function->get_results();
                 outputs.reserve(results.size());
@@ -130,6 +135,22 @@ namespace ngraph
                 }
                 call(outputs, inputs, function);
             }
+
+            void function(FunctionEvaluator& evaluator,
+                          const HostTensorVector& inputs,
+                          HostTensorVector& outputs)
+            {
+                const auto& function = evaluator.get_function();
+                check_inputs(*function, inputs);
+
+                const auto& results = function->get_results();
+                outputs.reserve(results.size());
+                for (size_t i = 0; i < results.size(); ++i)
+                {
+                    outputs.push_back(std::make_shared<HostTensor>());
+                }
+                evaluator.evaluate(outputs, inputs);
+            }
         } // namespace reference
     }     // namespace runtime
 } // namespace ngraph
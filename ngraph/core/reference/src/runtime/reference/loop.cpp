@@ -157,6 +157,9 @@ namespace ngraph
                     // Allocate vectors for store output values
                     std::vector<HostTensorVector> values_to_concat(concat_outputs.size());
                     HostTensorVector body_outputs;
+                    // The body is prepared once and its intermediate buffers are shared by
+                    // all iterations
+                    FunctionEvaluator body_evaluator(func);
 
                     // Negative value means infinity count of iterations
                     trip_count = trip_count >= 0 ? trip_count : std::numeric_limits<int64_t>::max();
@@ -172,7 +175,7 @@ namespace ngraph
 
                         // Evaluate body
                         body_outputs.clear();
-                        reference::function(func, inputs_to_body, body_outputs);
+                        reference::function(body_evaluator, inputs_to_body, body_outputs);
 
                         // Store values for later concatenation
                         for (size_t i = 0; i < values_to_concat.size(); ++i)
@@ -97,6 +97,13 @@ namespace ngraph
                 // Allocate vectors for store output values
                 std::vector<HostTensorVector> values_to_concat(concat_outputs.size());
                 HostTensorVector body_outputs;
+                // The body is prepared once and its intermediate buffers are shared by all
+                // iterations
+                std::unique_ptr<FunctionEvaluator> body_evaluator;
+                if (!evaluate)
+                {
+                    body_evaluator.reset(new FunctionEvaluator(func));
+                }
 
                 for (uint64_t cur_iter = 0; cur_iter < num_iterations; ++cur_iter)
                 {
@@ -112,7 +119,7 @@ namespace ngraph
                     body_outputs.clear();
                     if (!evaluate)
                     {
-                        reference::function(func, inputs_to_body, body_outputs);
+                        reference::function(*body_evaluator, inputs_to_body, body_outputs);
                     }
                     else
                     {
@@ -45,6 +45,7 @@ void descriptor::Input::replace_output(Output& new_output)
     new_output.add_input(this);
     m_output = &new_output;
     m_src_node = std::shared_ptr<Node>(new_output.get_node());
+    m_node->invalidate_topological_caches();
 
     if (getenv_bool("NGRAPH_ENABLE_REPLACE_CHECK"))
     {
@@ -67,6 +68,7 @@ void descriptor::Input::remove_output()
         m_output->remove_input(this);
         m_src_node = nullptr;
         m_output = nullptr;
+        m_node->invalidate_topological_caches();
     }
 }
 
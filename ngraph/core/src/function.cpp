@@ -16,6 +16,7 @@
 #include "ngraph/op/util/variable_extension.hpp"
 #include "ngraph/opsets/opset7.hpp"
 #include "ngraph/validation_util.hpp"
+#include "shared_node_info.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -94,6 +95,7 @@ Function::Function(const ResultVector& results,
     : m_name(name)
     , m_unique_name("Function_" + to_string(m_next_instance_id.fetch_add(1)))
     , m_topological_sorter(topological_sort<std::vector<std::shared_ptr<Node>>>)
+    , m_shared_rt_info(std::make_shared<SharedRTInfo>())
     , m_results(results)
     , m_parameters(parameters)
 {
@@ -106,6 +108,7 @@ Function::Function(const OutputVector& results,
     : m_name(name)
     , m_unique_name("Function_" + to_string(m_next_instance_id.fetch_add(1)))
     , m_topological_sorter(topological_sort<std::vector<std::shared_ptr<Node>>>)
+    , m_shared_rt_info(std::make_shared<SharedRTInfo>())
     , m_results(as_result_vector(results))
     , m_parameters(parameters)
 {
@@ -118,6 +121,7 @@ Function::Function(const NodeVector& results,
     : m_name(name)
     , m_unique_name("Function_" + to_string(m_next_instance_id.fetch_add(1)))
     , m_topological_sorter(topological_sort<std::vector<std::shared_ptr<Node>>>)
+    , m_shared_rt_info(std::make_shared<SharedRTInfo>())
     , m_results(as_result_vector(as_output_vector(results)))
     , m_parameters(parameters)
 {
@@ -138,6 +142,7 @@ Function::Function(const ResultVector& results,
     : m_name(name)
     , m_unique_name("Function_" + to_string(m_next_instance_id.fetch_add(1)))
     , m_topological_sorter(topological_sort<std::vector<std::shared_ptr<Node>>>)
+    , m_shared_rt_info(std::make_shared<SharedRTInfo>())
     , m_results(results)
     , m_sinks(sinks)
     , m_parameters(parameters)
@@ -161,6 +166,7 @@ Function::Function(const ResultVector& results,
     : m_name(name)
     , m_unique_name("Function_" + to_string(m_next_instance_id.fetch_add(1)))
     , m_topological_sorter(topological_sort<std::vector<std::shared_ptr<Node>>>)
+    , m_shared_rt_info(std::make_shared<SharedRTInfo>())
     , m_results(results)
     , m_sinks(sinks)
     , m_parameters(parameters)
@@ -198,6 +204,7 @@ Function::Function(const OutputVector& results, const SinkVector& sinks, const s
     : m_name(name)
     , m_unique_name("Function_" + to_string(m_next_instance_id.fetch_add(1)))
     , m_topological_sorter(topological_sort<std::vector<std::shared_ptr<Node>>>)
+    , m_shared_rt_info(std::make_shared<SharedRTInfo>())
     , m_results(as_result_vector(results))
     , m_sinks(sinks)
 {
@@ -280,6 +287,26 @@ std::vector<shared_ptr<Node>> Function::get_ordered_ops() const
 {
     OV_ITT_SCOPED_TASK(itt::domains::nGraph, "Function::get_ordered_ops");
 
+    std::lock_guard<std::mutex> lock(m_topological_cache_mutex);
+    if (m_shared_rt_info->get_use_topological_cache())
+    {
+        vector<shared_ptr<Node>> order;
+        order.reserve(m_cached_ordered_ops.size());
+        for (const auto& weak_node : m_cached_ordered_ops)
+        {
+            auto node = weak_node.lock();
+            if (!node)
+            {
+                break;
+            }
+            order.push_back(std::move(node));
+        }
+        if (order.size() == m_cached_ordered_ops.size())
+        {
+            return order;
+        }
+    }
+
     vector<shared_ptr<Node>> nodes;
     for (auto& r : get_results())
     {
@@ -294,7 +321,46 @@ std::vector<shared_ptr<Node>> Function::get_ordered_ops() const
         nodes.push_back(param);
     }
 
-    return m_topological_sorter(nodes);
+    auto order = m_topological_sorter(nodes);
+    // Nodes which left the function don't refer to it anymore, so their changes don't drop the
+    // cache and the function isn't kept alive by them
+    unordered_set<Node*> ordered_nodes;
+    for (const auto& node : order)
+    {
+        ordered_nodes.insert(node.get());
+    }
+    for (const auto& weak_node : m_cached_ordered_ops)
+    {
+        auto node = weak_node.lock();
+        if (node && ordered_nodes.count(node.get()) == 0)
+        {
+            node->erase_shared_rt_info(m_shared_rt_info);
+        }
+    }
+    m_cached_ordered_ops.assign(order.begin(), order.end());
+    for (const auto& node : order)
+    {
+        node->insert_shared_rt_info(m_shared_rt_info);
+    }
+    m_shared_rt_info->set_use_topological_cache(true);
+    return order;
+}
+
+Function::~Function()
+{
+    // Nodes may outlive the function
+    for (const auto& weak_node : m_cached_ordered_ops)
+    {
+        if (auto node = weak_node.lock())
+        {
+            node->erase_shared_rt_info(m_shared_rt_info);
+        }
+    }
+}
+
+void Function::invalidate_topological_cache()
+{
+    m_shared_rt_info->set_use_topological_cache(false);
 }
 
 void Function::map_unordered_ops(std::function<void(Node*)> f) const
@@ -458,11 +524,13 @@ void Function::replace_parameter(size_t parameter_index, const shared_ptr<op::Pa
                  " parameters.");
     replace_node(m_parameters[parameter_index], parameter);
     m_parameters[parameter_index] = parameter;
+    invalidate_topological_cache();
 }
 
 void Function::set_topological_sort(topological_sort_t sorter)
 {
     m_topological_sorter = sorter;
+    invalidate_topological_cache();
 }
 
 int64_t Function::get_parameter_index(const std::shared_ptr<op::Parameter>& parameter) const
@@ -540,12 +608,14 @@ bool Function::visit_attributes(AttributeVisitor& visitor)
 {
     visitor.on_attribute("parameters", m_parameters);
     visitor.on_attribute("results", m_results);
+    invalidate_topological_cache();
     return true;
 }
 
 void Function::add_sinks(const SinkVector& sinks)
 {
     m_sinks.insert(m_sinks.end(), sinks.begin(), sinks.end());
+    invalidate_topological_cache();
     for (const auto& sink : sinks)
     {
         if (const auto& variable_op = dynamic_pointer_cast<VariableExtension>(sink))
@@ -565,11 +635,13 @@ void Function::remove_sink(const std::shared_ptr<op::Sink>& sink)
                                  m_sinks.end(),
                                  [&sink](std::shared_ptr<op::Sink>& s) { return s == sink; }),
                   m_sinks.end());
+    invalidate_topological_cache();
 }
 
 void Function::add_results(const ResultVector& results)
 {
     m_results.insert(m_results.end(), results.begin(), results.end());
+    invalidate_topological_cache();
 }
 
 void Function::remove_result(const std::shared_ptr<op::Result>& result)
@@ -579,6 +651,7 @@ void Function::remove_result(const std::shared_ptr<op::Result>& result)
                        m_results.end(),
                        [&result](std::shared_ptr<op::v0::Result>& r) { return r == result; }),
         m_results.end());
+    invalidate_topological_cache();
 }
 
 void Function::add_parameters(const ParameterVector& params)
@@ -595,6 +668,7 @@ void Function::add_parameters(const ParameterVector& params)
         }
     }
     m_parameters.insert(m_parameters.end(), params.begin(), params.end());
+    invalidate_topological_cache();
 }
 
 void Function::remove_parameter(const std::shared_ptr<op::Parameter>& param)
@@ -604,6 +678,7 @@ void Function::remove_parameter(const std::shared_ptr<op::Parameter>& param)
                        m_parameters.end(),
                        [&param](std::shared_ptr<op::v0::Parameter>& r) { return r == param; }),
         m_parameters.end());
+    invalidate_topological_cache();
 }
 
 void Function::add_variables(const VariableVector& variables)
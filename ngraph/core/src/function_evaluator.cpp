@@ -0,0 +1,367 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <thread>
+
+#include "ngraph/function_evaluator.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/util/op_types.hpp"
+#include "ngraph/op/util/variable_context.hpp"
+#include "ngraph/op/util/variable_extension.hpp"
+#include "ngraph/runtime/parallel.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    // Intermediate tensor with a static shape and the range of levels it is alive
+    struct Lifetime
+    {
+        size_t slot;
+        int64_t start;
+        int64_t finish;
+        size_t size;
+        element::Type element_type;
+        Shape shape;
+    };
+} // namespace
+
+FunctionEvaluator::FunctionEvaluator(const shared_ptr<const Function>& function,
+                                     size_t num_threads)
+    : m_function(function)
+    , m_num_threads(num_threads)
+{
+    NGRAPH_CHECK(m_function, "FunctionEvaluator requires a function");
+    if (m_num_threads == 0)
+    {
+        m_num_threads = max(1u, thread::hardware_concurrency());
+    }
+
+    map<RawNodeOutput, size_t> slots;
+    auto add_slot = [&](const Output<Node>& output) {
+        const auto slot = m_tensors.size();
+        slots[output] = slot;
+        m_tensors.emplace_back();
+        return slot;
+    };
+    for (const auto& parameter : m_function->get_parameters())
+    {
+        m_parameter_slots.push_back(add_slot(parameter->output(0)));
+    }
+    for (const auto& result : m_function->get_results())
+    {
+        m_result_slots.push_back(add_slot(result->output(0)));
+    }
+
+    // Sequentially every node is a level of its own, in parallel a node goes to the level
+    // following the levels of all nodes it depends on
+    const bool parallel = m_num_threads > 1;
+    map<Node*, int64_t> node_levels;
+    map<size_t, Lifetime> lifetimes;
+    for (const auto& node : m_function->get_ordered_ops())
+    {
+        if (op::is_parameter(node))
+        {
+            node_levels[node.get()] = -1;
+            continue;
+        }
+        if (const auto constant = as_type_ptr<op::v0::Constant>(node))
+        {
+            node_levels[node.get()] = -1;
+            const auto slot = add_slot(constant->output(0));
+            m_tensors[slot] =
+                make_shared<runtime::HostTensor>(constant->get_element_type(),
+                                                 constant->get_output_shape(0),
+                                                 const_cast<void*>(constant->get_data_ptr()));
+            continue;
+        }
+
+        int64_t level = static_cast<int64_t>(m_levels.size());
+        if (parallel)
+        {
+            level = 0;
+            for (const auto& input_value : node->input_values())
+            {
+                level = max(level, node_levels.at(input_value.get_node()) + 1);
+            }
+            for (const auto& dependency : node->get_control_dependencies())
+            {
+                const auto it = node_levels.find(dependency.get());
+                if (it != node_levels.end())
+                {
+                    level = max(level, it->second + 1);
+                }
+            }
+        }
+        node_levels[node.get()] = level;
+        if (level >= static_cast<int64_t>(m_levels.size()))
+        {
+            m_levels.resize(level + 1);
+        }
+
+        Step step;
+        step.node = node.get();
+        step.serial = op::is_sink(node) || dynamic_pointer_cast<VariableExtension>(node);
+        for (const auto& input_value : node->input_values())
+        {
+            const auto slot = slots.at(input_value);
+            step.inputs.push_back(slot);
+            const auto it = lifetimes.find(slot);
+            if (it != lifetimes.end())
+            {
+                it->second.finish = max(it->second.finish, level);
+            }
+        }
+        for (const auto& output : node->outputs())
+        {
+            const auto it = slots.find(output);
+            if (it != slots.end())
+            {
+                // Results write to the tensors passed to evaluate()
+                step.outputs.push_back(it->second);
+                continue;
+            }
+            const auto slot = add_slot(output);
+            step.outputs.push_back(slot);
+            if (output.get_partial_shape().is_static() && output.get_element_type().is_static())
+            {
+                lifetimes[slot] = {slot,
+                                   level,
+                                   level,
+                                   output.get_tensor().size(),
+                                   output.get_element_type(),
+                                   output.get_shape()};
+            }
+            else
+            {
+                m_dynamic_slots.push_back(
+                    {slot, output.get_element_type(), output.get_partial_shape()});
+            }
+        }
+        m_levels[level].push_back(step);
+    }
+
+    // Tensors which are not alive at the same level share a buffer. The buffers are assigned
+    // greedily in the order of the first use, preferring the smallest free buffer which fits.
+    vector<Lifetime> order;
+    for (const auto& lifetime : lifetimes)
+    {
+        order.push_back(lifetime.second);
+    }
+    stable_sort(order.begin(), order.end(), [](const Lifetime& l, const Lifetime& r) {
+        return l.start < r.start;
+    });
+    vector<size_t> buffer_sizes;
+    vector<size_t> slot_buffers(order.size());
+    vector<pair<int64_t, size_t>> busy_buffers;
+    vector<size_t> free_buffers;
+    for (size_t i = 0; i < order.size(); ++i)
+    {
+        const auto& lifetime = order[i];
+        for (auto it = busy_buffers.begin(); it != busy_buffers.end();)
+        {
+            if (it->first < lifetime.start)
+            {
+                free_buffers.push_back(it->second);
+                it = busy_buffers.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        auto best = free_buffers.end();
+        for (auto it = free_buffers.begin(); it != free_buffers.end(); ++it)
+        {
+            if (best == free_buffers.end())
+            {
+                best = it;
+                continue;
+            }
+            const auto size = buffer_sizes[*it];
+            const auto best_size = buffer_sizes[*best];
+            const bool fits = size >= lifetime.size;
+            const bool best_fits = best_size >= lifetime.size;
+            if ((fits && (!best_fits || size < best_size)) ||
+                (!fits && !best_fits && size > best_size))
+            {
+                best = it;
+            }
+        }
+        size_t buffer = buffer_sizes.size();
+        if (best == free_buffers.end())
+        {
+            buffer_sizes.push_back(lifetime.size);
+        }
+        else
+        {
+            buffer = *best;
+            free_buffers.erase(best);
+            buffer_sizes[buffer] = max(buffer_sizes[buffer], lifetime.size);
+        }
+        slot_buffers[i] = buffer;
+        busy_buffers.emplace_back(lifetime.finish, buffer);
+    }
+
+    for (const auto size : buffer_sizes)
+    {
+        m_buffers.push_back(make_shared<runtime::HostTensor>(element::u8, Shape{size}));
+    }
+    for (size_t i = 0; i < order.size(); ++i)
+    {
+        m_tensors[order[i].slot] = make_shared<runtime::HostTensor>(
+            order[i].element_type, order[i].shape, m_buffers[slot_buffers[i]]->get_data_ptr());
+    }
+}
+
+size_t FunctionEvaluator::get_intermediate_buffers_size() const
+{
+    size_t size = 0;
+    for (const auto& buffer : m_buffers)
+    {
+        size += buffer->get_size_in_bytes();
+    }
+    return size;
+}
+
+bool FunctionEvaluator::evaluate(const HostTensorVector& output_tensors,
+                                 const HostTensorVector& input_tensors,
+                                 EvaluationContext evaluation_context)
+{
+    NGRAPH_CHECK(input_tensors.size() == m_parameter_slots.size(),
+                 "Got ",
+                 input_tensors.size(),
+                 " input tensors for ",
+                 m_parameter_slots.size(),
+                 " parameters");
+    NGRAPH_CHECK(output_tensors.size() == m_result_slots.size(),
+                 "Got ",
+                 output_tensors.size(),
+                 " output tensors for ",
+                 m_result_slots.size(),
+                 " results");
+    if (evaluation_context.find("VariableContext") == evaluation_context.end())
+        evaluation_context["VariableContext"] =
+            std::make_shared<VariantWrapper<VariableContext>>(VariableContext());
+
+    for (size_t i = 0; i < m_parameter_slots.size(); ++i)
+    {
+        m_tensors[m_parameter_slots[i]] = input_tensors[i];
+    }
+    for (size_t i = 0; i < m_result_slots.size(); ++i)
+    {
+        m_tensors[m_result_slots[i]] = output_tensors[i];
+    }
+    for (const auto& dynamic_slot : m_dynamic_slots)
+    {
+        m_tensors[dynamic_slot.slot] =
+            make_shared<runtime::HostTensor>(dynamic_slot.element_type, dynamic_slot.shape);
+    }
+
+    for (const auto& level : m_levels)
+    {
+        evaluate_level(level, evaluation_context);
+    }
+
+    // Do not keep the tensors of the caller and the dynamic intermediates alive
+    for (const auto slot : m_parameter_slots)
+    {
+        m_tensors[slot].reset();
+    }
+    for (const auto slot : m_result_slots)
+    {
+        m_tensors[slot].reset();
+    }
+    for (const auto& dynamic_slot : m_dynamic_slots)
+    {
+        m_tensors[dynamic_slot.slot].reset();
+    }
+    return true;
+}
+
+void FunctionEvaluator::evaluate_step(const Step& step,
+                                      const EvaluationContext& evaluation_context)
+{
+    HostTensorVector inputs;
+    inputs.reserve(step.inputs.size());
+    for (const auto slot : step.inputs)
+    {
+        inputs.push_back(m_tensors[slot]);
+    }
+    HostTensorVector outputs;
+    outputs.reserve(step.outputs.size());
+    for (const auto slot : step.outputs)
+    {
+        outputs.push_back(m_tensors[slot]);
+    }
+    NGRAPH_CHECK(step.node->evaluate(outputs, inputs, evaluation_context),
+                 "Evaluation failed on ",
+                 step.node);
+}
+
+void FunctionEvaluator::evaluate_level(const std::vector<Step>& level,
+                                       const EvaluationContext& evaluation_context)
+{
+    const auto num_workers = min(m_num_threads, level.size());
+    if (num_workers <= 1)
+    {
+        for (const auto& step : level)
+        {
+            evaluate_step(step, evaluation_context);
+        }
+        return;
+    }
+
+    // Every worker takes the next unevaluated node until the level is done. The workers run on
+    // the threads of the runtime::parallel_for backend instead of threads of their own.
+    atomic<size_t> next_step{0};
+    mutex exception_mutex;
+    exception_ptr exception;
+    auto worker = [&] {
+        for (size_t i = next_step++; i < level.size(); i = next_step++)
+        {
+            if (level[i].serial)
+            {
+                continue;
+            }
+            try
+            {
+                evaluate_step(level[i], evaluation_context);
+            }
+            catch (...)
+            {
+                lock_guard<mutex> lock(exception_mutex);
+                if (!exception)
+                {
+                    exception = current_exception();
+                }
+            }
+        }
+    };
+    runtime::parallel_for(num_workers, 1, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i)
+        {
+            worker();
+        }
+    });
+    if (exception)
+    {
+        rethrow_exception(exception);
+    }
+
+    // Variables live in the evaluation context, which is not synchronized
+    for (const auto& step : level)
+    {
+        if (step.serial)
+        {
+            evaluate_step(step, evaluation_context);
+        }
+    }
+}
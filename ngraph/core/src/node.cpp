@@ -16,6 +16,7 @@
 #include "ngraph/op/parameter.hpp"
 #include "ngraph/op/result.hpp"
 #include "ngraph/pattern/matcher.hpp"
+#include "shared_node_info.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -55,6 +56,7 @@ Node& Node::operator=(const Node& node)
     this->m_inputs = node.m_inputs;
     this->m_op_annotations = node.m_op_annotations;
     this->m_rt_info = node.m_rt_info;
+    invalidate_topological_caches();
     // cannot do it without copying node.m_inputs first due to too limiting const qualifiers
     for (auto& input : m_inputs)
     {
@@ -473,6 +475,7 @@ void Node::add_control_dependency(std::shared_ptr<Node> node)
         m_control_dependencies.end())
     {
         m_control_dependencies.push_back(node);
+        invalidate_topological_caches();
         if (find(node->m_control_dependents.begin(), node->m_control_dependents.end(), this) ==
             node->m_control_dependents.end())
         {
@@ -510,6 +513,7 @@ void Node::remove_control_dependency(std::shared_ptr<Node> node)
         if (it != m_control_dependencies.end())
         {
             m_control_dependencies.erase(it);
+            invalidate_topological_caches();
         }
     }
     {
@@ -532,6 +536,28 @@ void Node::clear_control_dependencies()
         }
     }
     m_control_dependencies.clear();
+    invalidate_topological_caches();
+}
+
+void Node::invalidate_topological_caches()
+{
+    std::lock_guard<std::mutex> lock(m_shared_rt_info_mutex);
+    for (const auto& info : m_shared_rt_info)
+    {
+        info->set_use_topological_cache(false);
+    }
+}
+
+void Node::insert_shared_rt_info(const std::shared_ptr<SharedRTInfo>& info)
+{
+    std::lock_guard<std::mutex> lock(m_shared_rt_info_mutex);
+    m_shared_rt_info.insert(info);
+}
+
+void Node::erase_shared_rt_info(const std::shared_ptr<SharedRTInfo>& info)
+{
+    std::lock_guard<std::mutex> lock(m_shared_rt_info_mutex);
+    m_shared_rt_info.erase(info);
 }
 
 void Node::clear_control_dependents()
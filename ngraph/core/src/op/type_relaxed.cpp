@@ -3,7 +3,9 @@
 //
 
 #include <algorithm>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include "ngraph_ops/type_relaxed.hpp"
@@ -14,5 +16,79 @@ namespace ngraph
     {
         TypeRelaxedBase::~TypeRelaxedBase() {}
 
+        namespace
+        {
+            // Several libraries may register the same type, the earliest registration which is
+            // still alive is used
+            struct TypeRelaxedFactories
+            {
+                std::mutex mutex;
+                std::map<NodeTypeInfo, std::vector<const TypeRelaxedRegistration*>> registrations;
+            };
+
+            TypeRelaxedFactories& get_type_relaxed_factories()
+            {
+                static TypeRelaxedFactories factories;
+                return factories;
+            }
+        } // namespace
+
+        TypeRelaxedRegistration::TypeRelaxedRegistration(const NodeTypeInfo& base_type_info,
+                                                         Factory factory)
+            : m_base_type_info(base_type_info)
+            , m_factory(factory)
+        {
+            if (!m_factory)
+            {
+                return;
+            }
+            auto& factories = get_type_relaxed_factories();
+            std::lock_guard<std::mutex> lock(factories.mutex);
+            factories.registrations[m_base_type_info].push_back(this);
+        }
+
+        TypeRelaxedRegistration::~TypeRelaxedRegistration()
+        {
+            if (!m_factory)
+            {
+                return;
+            }
+            auto& factories = get_type_relaxed_factories();
+            std::lock_guard<std::mutex> lock(factories.mutex);
+            auto it = factories.registrations.find(m_base_type_info);
+            if (it == factories.registrations.end())
+            {
+                return;
+            }
+            auto& registrations = it->second;
+            registrations.erase(std::remove(registrations.begin(), registrations.end(), this),
+                                registrations.end());
+            if (registrations.empty())
+            {
+                factories.registrations.erase(it);
+            }
+        }
+
+        std::shared_ptr<Node> TypeRelaxedRegistration::create(const NodeTypeInfo& base_type_info)
+        {
+            Factory factory = nullptr;
+            {
+                auto& factories = get_type_relaxed_factories();
+                std::lock_guard<std::mutex> lock(factories.mutex);
+                auto it = factories.registrations.find(base_type_info);
+                if (it != factories.registrations.end())
+                {
+                    factory = it->second.front()->m_factory;
+                }
+            }
+            return factory ? factory() : nullptr;
+        }
+
+        bool TypeRelaxedRegistration::is_registered(const NodeTypeInfo& base_type_info)
+        {
+            auto& factories = get_type_relaxed_factories();
+            std::lock_guard<std::mutex> lock(factories.mutex);
+            return factories.registrations.count(base_type_info) != 0;
+        }
     } // namespace op
 } // namespace ngraph
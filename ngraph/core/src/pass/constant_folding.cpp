@@ -3,70 +3,315 @@
 //
 
 #include "ngraph/pass/constant_folding.hpp"
+#include <algorithm>
+#include <exception>
 #include <ngraph/op/constant.hpp>
+#include <unordered_map>
+#include "ngraph/op/util/op_types.hpp"
 #include "ngraph/op/util/sub_graph_base.hpp"
+#include "ngraph/op/util/variable_extension.hpp"
 #include "ngraph/rt_info.hpp"
+#include "ngraph/runtime/parallel.hpp"
 
 using namespace std;
 using namespace ngraph;
 
 NGRAPH_RTTI_DEFINITION(ngraph::pass::ConstantFolding, "ConstantFolding", 0);
 
+namespace
+{
+    void add_consumers(const Output<Node>& output, unordered_set<Node*>& nodes)
+    {
+        for (const auto& input : output.get_target_inputs())
+        {
+            nodes.insert(input.get_node());
+        }
+    }
+
+    // Validates the node if one of its inputs was replaced or changed. The consumers are
+    // validated in turn only if the types or the shapes of the outputs have changed.
+    void validate_if_needed(Node* node, unordered_set<Node*>& nodes_to_validate)
+    {
+        if (nodes_to_validate.erase(node) == 0)
+        {
+            return;
+        }
+        vector<pair<element::Type, PartialShape>> output_types;
+        for (const auto& output : node->outputs())
+        {
+            output_types.emplace_back(output.get_element_type(), output.get_partial_shape());
+        }
+        node->validate_and_infer_types();
+        for (const auto& output : node->outputs())
+        {
+            const auto& output_type = output_types.at(output.get_index());
+            if (output.get_element_type() != output_type.first ||
+                output.get_partial_shape() != output_type.second)
+            {
+                add_consumers(output, nodes_to_validate);
+            }
+        }
+    }
+
+    bool has_consumers(const Node& node)
+    {
+        for (const auto& output : node.outputs())
+        {
+            if (!output.get_target_inputs().empty())
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Releases the folded node if nothing consumes it anymore, together with its constant inputs
+    // left without consumers, so the original constants do not outlive the folding
+    void release_if_unused(vector<shared_ptr<Node>>& nodes,
+                           vector<bool>& processed,
+                           const unordered_map<Node*, size_t>& node_indices,
+                           size_t i)
+    {
+        if (has_consumers(*nodes[i]))
+        {
+            return;
+        }
+        vector<size_t> inputs;
+        for (const auto& input_value : nodes[i]->input_values())
+        {
+            const auto it = node_indices.find(input_value.get_node());
+            if (it != node_indices.end() && nodes[it->second] &&
+                is_type<op::Constant>(nodes[it->second]))
+            {
+                inputs.push_back(it->second);
+            }
+        }
+        nodes[i].reset();
+        for (const auto j : inputs)
+        {
+            if (nodes[j] && !has_consumers(*nodes[j]))
+            {
+                nodes[j].reset();
+                processed[j] = true;
+            }
+        }
+    }
+
+    // Nodes which can be folded together with other nodes: they do not access variables or
+    // subgraphs and do not have control dependencies
+    bool is_independently_foldable(const shared_ptr<Node>& node)
+    {
+        return node->get_input_size() > 0 && !op::is_parameter(node) && !op::is_output(node) &&
+               !op::is_sink(node) && !dynamic_pointer_cast<VariableExtension>(node) &&
+               !dynamic_pointer_cast<op::util::SubGraphOp>(node) &&
+               node->get_control_dependencies().empty();
+    }
+} // namespace
+
 bool ngraph::pass::ConstantFolding::run_on_function(std::shared_ptr<ngraph::Function> f)
 {
-    bool rewritten = pre_calculated_values_folding(f);
+    NodeSet nodes_to_validate;
+    bool rewritten = pre_calculated_values_folding(f, nodes_to_validate);
+
+    auto nodes = f->get_ordered_ops();
+    unordered_map<Node*, size_t> node_indices;
+    for (size_t i = 0; i < nodes.size(); ++i)
+    {
+        node_indices.emplace(nodes[i].get(), i);
+    }
+    vector<bool> processed(nodes.size());
+    rewritten |= fold_constant_subgraphs(nodes, processed, node_indices, nodes_to_validate);
 
-    for (const auto& node : f->get_ordered_ops())
+    for (size_t i = 0; i < nodes.size(); ++i)
     {
-        if (rewritten)
+        if (processed[i])
         {
-            node->validate_and_infer_types();
+            continue;
         }
+        const auto& node = nodes[i];
+        validate_if_needed(node.get(), nodes_to_validate);
 
         OutputVector replacements(node->get_output_size());
         if (node->constant_fold(replacements, node->input_values()))
         {
-            NGRAPH_CHECK(replacements.size() == node->get_output_size(),
-                         "constant_fold_default returned incorrect number of replacements for ",
-                         node);
+            rewritten |= replace_outputs(node, replacements, nodes_to_validate);
+            release_if_unused(nodes, processed, node_indices, i);
+        }
+        else
+        {
+            // recursively constant fold operators containing subgraphs (ie: TensorIterator, Loop)
+            if (auto sub_graph_node = std::dynamic_pointer_cast<op::util::SubGraphOp>(node))
+            {
+                if (const auto& sub_graph = sub_graph_node->get_function())
+                {
+                    rewritten |= run_on_function(sub_graph);
+                }
+            }
+        }
+    }
 
-            for (size_t i = 0; i < replacements.size(); ++i)
+    return rewritten;
+}
+
+bool ngraph::pass::ConstantFolding::fold_constant_subgraphs(vector<shared_ptr<Node>>& nodes,
+                                                            vector<bool>& processed,
+                                                            const unordered_map<Node*, size_t>& node_indices,
+                                                            NodeSet& nodes_to_validate)
+{
+    // A node of a constant subgraph goes to the level following the levels of its inputs, the
+    // constants are at level 0. The nodes of a level do not depend on each other.
+    unordered_map<Node*, size_t> node_levels;
+    vector<vector<size_t>> levels;
+    for (size_t i = 0; i < nodes.size(); ++i)
+    {
+        const auto& node = nodes[i];
+        if (is_type<op::Constant>(node))
+        {
+            node_levels[node.get()] = 0;
+            continue;
+        }
+        if (!is_independently_foldable(node))
+        {
+            continue;
+        }
+        size_t level = 1;
+        bool constant_inputs = true;
+        for (const auto& input_value : node->input_values())
+        {
+            const auto it = node_levels.find(input_value.get_node());
+            if (it == node_levels.end())
+            {
+                constant_inputs = false;
+                break;
+            }
+            level = max(level, it->second + 1);
+        }
+        if (!constant_inputs)
+        {
+            continue;
+        }
+        node_levels[node.get()] = level;
+        if (level >= levels.size())
+        {
+            levels.resize(level + 1);
+        }
+        levels[level].push_back(i);
+    }
+
+    bool rewritten = false;
+    for (const auto& level : levels)
+    {
+        // Folding may reshape an input constant in place or connect temporary nodes to it, so
+        // the nodes folded at the same time must not share inputs. The nodes whose inputs could
+        // not be folded are left to the sequential pass.
+        vector<size_t> pending;
+        for (const auto i : level)
+        {
+            const auto& node = nodes[i];
+            validate_if_needed(node.get(), nodes_to_validate);
+            const auto inputs = node->input_values();
+            if (all_of(inputs.begin(), inputs.end(), [](const Output<Node>& input) {
+                    return is_type<op::Constant>(input.get_node());
+                }))
             {
-                auto node_output = node->output(i);
-                auto replacement = replacements.at(i);
-                if (replacement.get_node_shared_ptr() && (node_output != replacement))
+                pending.push_back(i);
+            }
+        }
+
+        while (!pending.empty())
+        {
+            vector<size_t> batch;
+            vector<size_t> deferred;
+            unordered_set<Node*> batch_inputs;
+            for (const auto i : pending)
+            {
+                const auto inputs = nodes[i]->input_values();
+                if (any_of(inputs.begin(), inputs.end(), [&](const Output<Node>& input) {
+                        return batch_inputs.count(input.get_node()) > 0;
+                    }))
+                {
+                    deferred.push_back(i);
+                    continue;
+                }
+                for (const auto& input : inputs)
+                {
+                    batch_inputs.insert(input.get_node());
+                }
+                batch.push_back(i);
+            }
+
+            vector<OutputVector> replacements(batch.size());
+            vector<char> folded(batch.size());
+            vector<exception_ptr> errors(batch.size());
+            runtime::parallel_for(batch.size(), 1, [&](size_t begin, size_t end) {
+                for (size_t b = begin; b < end; ++b)
                 {
-                    if (replacements.size() == 1)
+                    const auto& node = nodes[batch[b]];
+                    replacements[b].resize(node->get_output_size());
+                    try
                     {
-                        replacement.get_node_shared_ptr()->set_friendly_name(
-                            node->get_friendly_name());
+                        folded[b] = node->constant_fold(replacements[b], node->input_values());
                     }
-                    else
+                    catch (...)
                     {
-                        replacement.get_node_shared_ptr()->set_friendly_name(
-                            node->get_friendly_name() + "." + std::to_string(i));
+                        errors[b] = current_exception();
                     }
-                    node_output.replace(replacement);
-                    // Propagate runtime info attributes to replacement consumer nodes
-                    copy_runtime_info_to_target_inputs(node, replacement);
+                }
+            });
 
-                    rewritten = true;
+            for (size_t b = 0; b < batch.size(); ++b)
+            {
+                const auto i = batch[b];
+                processed[i] = true;
+                if (errors[b])
+                {
+                    rethrow_exception(errors[b]);
+                }
+                if (folded[b])
+                {
+                    rewritten |= replace_outputs(nodes[i], replacements[b], nodes_to_validate);
+                    replacements[b].clear();
+                    release_if_unused(nodes, processed, node_indices, i);
                 }
             }
+            pending = move(deferred);
         }
-        else
+    }
+    return rewritten;
+}
+
+bool ngraph::pass::ConstantFolding::replace_outputs(const shared_ptr<Node>& node,
+                                                    const OutputVector& replacements,
+                                                    NodeSet& nodes_to_validate)
+{
+    NGRAPH_CHECK(replacements.size() == node->get_output_size(),
+                 "constant_fold_default returned incorrect number of replacements for ",
+                 node);
+
+    bool rewritten = false;
+    for (size_t i = 0; i < replacements.size(); ++i)
+    {
+        auto node_output = node->output(i);
+        auto replacement = replacements.at(i);
+        if (replacement.get_node_shared_ptr() && (node_output != replacement))
         {
-            // recursively constant fold operators containing subgraphs (ie: TensorIterator, Loop)
-            if (auto sub_graph_node = std::dynamic_pointer_cast<op::util::SubGraphOp>(node))
+            if (replacements.size() == 1)
             {
-                if (const auto& sub_graph = sub_graph_node->get_function())
-                {
-                    rewritten |= run_on_function(sub_graph);
-                }
+                replacement.get_node_shared_ptr()->set_friendly_name(node->get_friendly_name());
             }
+            else
+            {
+                replacement.get_node_shared_ptr()->set_friendly_name(
+                    node->get_friendly_name() + "." + std::to_string(i));
+            }
+            node_output.replace(replacement);
+            // Propagate runtime info attributes to replacement consumer nodes
+            copy_runtime_info_to_target_inputs(node, replacement);
+            add_consumers(replacement, nodes_to_validate);
+
+            rewritten = true;
         }
     }
-
     return rewritten;
 }
 
@@ -81,7 +326,7 @@ void ngraph::pass::ConstantFolding::copy_runtime_info_to_target_inputs(
 }
 
 bool ngraph::pass::ConstantFolding::pre_calculated_values_folding(
-    const std::shared_ptr<ngraph::Function>& f)
+    const std::shared_ptr<ngraph::Function>& f, NodeSet& nodes_to_validate)
 {
     deque<shared_ptr<Node>> nodes;
     set<shared_ptr<Node>> visited;
@@ -120,6 +365,7 @@ bool ngraph::pass::ConstantFolding::pre_calculated_values_folding(
                     input_value.replace(replacement);
                     // Propagate runtime info attributes to replacement consumer nodes
                     copy_runtime_info_to_target_inputs(input_node, replacement);
+                    add_consumers(replacement, nodes_to_validate);
 
                     rewritten = true;
                 }
@@ -0,0 +1,47 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <atomic>
+
+#include "ngraph/runtime/parallel.hpp"
+
+using namespace ngraph;
+
+namespace
+{
+    std::atomic<runtime::parallel_for_t> s_parallel_for{nullptr};
+} // namespace
+
+void runtime::set_parallel_for(parallel_for_t parallel_for)
+{
+    s_parallel_for = parallel_for;
+}
+
+runtime::parallel_for_t runtime::get_parallel_for()
+{
+    return s_parallel_for;
+}
+
+void runtime::parallel_for(size_t work_amount, size_t grain_size, const parallel_body_t& body)
+{
+    if (work_amount == 0)
+    {
+        return;
+    }
+    // The backend splits chunks of grain_size items, so it may use any number of threads
+    const size_t chunks = work_amount / std::max<size_t>(grain_size, 1);
+    const auto backend = s_parallel_for.load();
+    if (backend == nullptr || chunks < 2)
+    {
+        body(0, work_amount);
+        return;
+    }
+    backend(chunks, [&](size_t begin, size_t end) {
+        if (begin < end)
+        {
+            body(begin * work_amount / chunks, end * work_amount / chunks);
+        }
+    });
+}
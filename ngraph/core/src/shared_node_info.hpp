@@ -0,0 +1,30 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+
+namespace ngraph
+{
+    /// \brief Information shared between a Function and all the nodes it consists of.
+    ///
+    /// Function keeps a topological order of its nodes and attaches the same SharedRTInfo to
+    /// each of them. Every change of node connections drops the flag, so the Function knows the
+    /// cached order is outdated without traversing the graph.
+    class SharedRTInfo
+    {
+    public:
+        SharedRTInfo()
+            : m_use_topological_cache(false)
+        {
+        }
+
+        void set_use_topological_cache(bool status) { m_use_topological_cache = status; }
+        bool get_use_topological_cache() const { return m_use_topological_cache; }
+
+    private:
+        std::atomic_bool m_use_topological_cache;
+    };
+} // namespace ngraph
@@ -12,6 +12,7 @@
 #include "util/test_tools.hpp"
 
 #include <memory>
+#include <thread>
 #include <util/type_prop.hpp>
 
 NGRAPH_SUPPRESS_DEPRECATED_START
@@ -559,4 +560,114 @@ TEST(build_graph, build_graph_unregistred_variables)
 
     EXPECT_ANY_THROW(make_shared<Function>(OutputVector{res, res2}, SinkVector{assign, assign_2},
                                    ParameterVector{arg, arg2}, VariableVector{variable}));
-}
\ No newline at end of file
+}
+
+TEST(build_graph, topological_cache_replace_node)
+{
+    using namespace opset7;
+    auto arg = make_shared<Parameter>(element::f32, Shape{2, 4});
+    auto relu = make_shared<Relu>(arg);
+    auto res = make_shared<Result>(relu);
+    auto f = make_shared<Function>(ResultVector{res}, ParameterVector{arg});
+
+    EXPECT_EQ(f->get_ordered_ops(), (NodeVector{arg, relu, res}));
+
+    auto neg = make_shared<Negative>(relu);
+    replace_node(relu, neg);
+    neg->input(0).replace_source_output(relu);
+    EXPECT_EQ(f->get_ordered_ops(), (NodeVector{arg, relu, neg, res}));
+
+    res->input(0).replace_source_output(arg);
+    EXPECT_EQ(f->get_ordered_ops(), (NodeVector{arg, res}));
+}
+
+TEST(build_graph, topological_cache_control_dependencies)
+{
+    using namespace opset7;
+    auto arg = make_shared<Parameter>(element::f32, Shape{2, 4});
+    auto relu = make_shared<Relu>(arg);
+    auto res = make_shared<Result>(relu);
+    auto f = make_shared<Function>(ResultVector{res}, ParameterVector{arg});
+
+    auto abs = make_shared<Abs>(arg);
+    EXPECT_EQ(f->get_ordered_ops().size(), 3);
+
+    relu->add_control_dependency(abs);
+    EXPECT_EQ(f->get_ordered_ops().size(), 4);
+
+    relu->remove_control_dependency(abs);
+    EXPECT_EQ(f->get_ordered_ops().size(), 3);
+}
+
+TEST(build_graph, topological_cache_function_lists)
+{
+    using namespace opset7;
+    auto arg = make_shared<Parameter>(element::f32, Shape{2, 4});
+    auto relu = make_shared<Relu>(arg);
+    auto res = make_shared<Result>(relu);
+    auto f = make_shared<Function>(ResultVector{res}, ParameterVector{arg});
+    EXPECT_EQ(f->get_ordered_ops().size(), 3);
+
+    auto abs = make_shared<Abs>(arg);
+    auto res2 = make_shared<Result>(abs);
+    f->add_results(ResultVector{res2});
+    EXPECT_EQ(f->get_ordered_ops().size(), 5);
+
+    f->remove_result(res2);
+    EXPECT_EQ(f->get_ordered_ops().size(), 3);
+
+    auto arg2 = make_shared<Parameter>(element::f32, Shape{2, 4});
+    f->add_parameters(ParameterVector{arg2});
+    EXPECT_EQ(f->get_ordered_ops().size(), 4);
+}
+
+TEST(build_graph, topological_cache_removed_node)
+{
+    using namespace opset7;
+    auto arg = make_shared<Parameter>(element::f32, Shape{2, 4});
+    auto relu = make_shared<Relu>(arg);
+    auto res = make_shared<Result>(relu);
+    auto f = make_shared<Function>(ResultVector{res}, ParameterVector{arg});
+    EXPECT_EQ(f->get_ordered_ops(), (NodeVector{arg, relu, res}));
+
+    // The removed node is moved to another function, which order is cached independently
+    res->input(0).replace_source_output(arg);
+    EXPECT_EQ(f->get_ordered_ops(), (NodeVector{arg, res}));
+    auto arg2 = make_shared<Parameter>(element::f32, Shape{2, 4});
+    relu->input(0).replace_source_output(arg2);
+    auto res2 = make_shared<Result>(relu);
+    auto f2 = make_shared<Function>(ResultVector{res2}, ParameterVector{arg2});
+    EXPECT_EQ(f2->get_ordered_ops(), (NodeVector{arg2, relu, res2}));
+    EXPECT_EQ(f->get_ordered_ops(), (NodeVector{arg, res}));
+
+    // Nodes outlive the function
+    f2.reset();
+    relu->input(0).replace_source_output(arg);
+    EXPECT_EQ(f->get_ordered_ops(), (NodeVector{arg, res}));
+}
+
+TEST(build_graph, topological_cache_shared_nodes_concurrent)
+{
+    using namespace opset7;
+    auto arg = make_shared<Parameter>(element::f32, Shape{2, 4});
+    auto relu = make_shared<Relu>(arg);
+    auto f1 = make_shared<Function>(ResultVector{make_shared<Result>(relu)}, ParameterVector{arg});
+    auto f2 = make_shared<Function>(ResultVector{make_shared<Result>(relu)}, ParameterVector{arg});
+
+    // Both functions attach their caches to the shared nodes at once
+    auto sort = [](const shared_ptr<Function>& f) {
+        for (int i = 0; i < 1000; ++i)
+        {
+            f->set_topological_sort(topological_sort<std::vector<std::shared_ptr<Node>>>);
+            EXPECT_EQ(f->get_ordered_ops().size(), 3);
+        }
+    };
+    std::thread t1(sort, f1);
+    std::thread t2(sort, f2);
+    t1.join();
+    t2.join();
+
+    relu->add_control_dependency(make_shared<Abs>(arg));
+    EXPECT_EQ(f1->get_ordered_ops().size(), 4);
+    EXPECT_EQ(f2->get_ordered_ops().size(), 4);
+}
@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <numeric>
+
 #include "gtest/gtest.h"
 
 #include "ngraph/ngraph.hpp"
@@ -9,6 +11,7 @@
 #include "ngraph/pass/constant_folding.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "util/all_close_f.hpp"
+#include "util/parallel_for_guard.hpp"
 #include "util/test_tools.hpp"
 
 using namespace ngraph;
@@ -3430,3 +3433,114 @@ TEST(constant_folding, constant_loop)
     range_test_check(result_node_0->cast_vector<float>(), expected_0);
     range_test_check(result_node_1->cast_vector<float>(), expected_1);
 }
+
+TEST(constant_folding, parallel_independent_subgraphs)
+{
+    test::ParallelForGuard guard;
+    constexpr size_t chains = 8;
+    auto input = make_shared<op::Parameter>(element::f32, Shape{2, 4});
+    // Shared by all the chains, so their Multiply nodes are folded one after another
+    auto scale = op::Constant::create(element::f32, Shape{}, {2.0f});
+    auto pattern = op::Constant::create(element::i64, Shape{2}, {2, 4});
+    OutputVector outputs;
+    for (size_t i = 0; i < chains; ++i)
+    {
+        vector<int32_t> values(8);
+        iota(values.begin(), values.end(), static_cast<int32_t>(i));
+        auto weights = op::Constant::create(element::i32, Shape{8}, values);
+        auto convert = make_shared<op::v0::Convert>(weights, element::f32);
+        auto multiply = make_shared<op::v1::Multiply>(convert, scale);
+        auto reshape = make_shared<op::v1::Reshape>(multiply, pattern, false);
+        reshape->set_friendly_name("weights_" + to_string(i));
+        outputs.push_back(make_shared<op::v1::Add>(input, reshape));
+    }
+    auto f = make_shared<Function>(outputs, ParameterVector{input});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    EXPECT_EQ(count_ops_of_type<op::v0::Convert>(f), 0);
+    EXPECT_EQ(count_ops_of_type<op::v1::Multiply>(f), 0);
+    EXPECT_EQ(count_ops_of_type<op::v1::Reshape>(f), 0);
+    EXPECT_EQ(count_ops_of_type<op::v1::Add>(f), chains);
+    for (size_t i = 0; i < chains; ++i)
+    {
+        auto add = f->get_results().at(i)->get_input_node_shared_ptr(0);
+        auto folded = as_type_ptr<op::Constant>(add->get_input_node_shared_ptr(1));
+        ASSERT_TRUE(folded);
+        EXPECT_EQ(folded->get_friendly_name(), "weights_" + to_string(i));
+        EXPECT_EQ(folded->get_shape(), (Shape{2, 4}));
+        vector<float> expected(8);
+        for (size_t j = 0; j < expected.size(); ++j)
+        {
+            expected[j] = 2.0f * (i + j);
+        }
+        EXPECT_EQ(folded->cast_vector<float>(), expected);
+    }
+}
+
+TEST(constant_folding, parallel_shared_input)
+{
+    test::ParallelForGuard guard;
+    auto data = op::Constant::create(element::f32, Shape{2, 3}, {1, 2, 3, 4, 5, 6});
+    auto like = op::Constant::create(element::i32, Shape{}, {0});
+    auto reshape = make_shared<op::v1::Reshape>(
+        data, op::Constant::create(element::i64, Shape{1}, {6}), false);
+    auto convert_like = make_shared<op::v1::ConvertLike>(data, like);
+    auto f = make_shared<Function>(OutputVector{reshape, convert_like}, ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    EXPECT_EQ(get_result_constant<float>(f, 0), (vector<float>{1, 2, 3, 4, 5, 6}));
+    EXPECT_EQ(f->get_output_shape(0), (Shape{6}));
+    EXPECT_EQ(get_result_constant<int32_t>(f, 1), (vector<int32_t>{1, 2, 3, 4, 5, 6}));
+    EXPECT_EQ(f->get_output_shape(1), (Shape{2, 3}));
+}
+
+TEST(constant_folding, folded_nodes_are_released)
+{
+    auto data = op::Constant::create(element::f32, Shape{2, 3}, {1, 2, 3, 4, 5, 6});
+    auto reshape_1 = make_shared<op::v1::Reshape>(
+        data, op::Constant::create(element::i64, Shape{2}, {3, 2}), false);
+    auto reshape_2 = make_shared<op::v1::Reshape>(
+        reshape_1, op::Constant::create(element::i64, Shape{1}, {6}), false);
+    auto f = make_shared<Function>(reshape_2, ParameterVector{});
+    weak_ptr<Node> folded = reshape_1;
+    reshape_1.reset();
+    reshape_2.reset();
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    EXPECT_TRUE(folded.expired());
+    // The first Reshape is released once folded, so the second one reshapes the data in place
+    EXPECT_EQ(f->get_results().at(0)->get_input_node_shared_ptr(0), data);
+    EXPECT_EQ(data->get_shape(), (Shape{6}));
+}
+
+TEST(constant_folding, folded_constants_are_released)
+{
+    auto a = op::Constant::create(element::f32, Shape{2}, {1, 2});
+    auto b = op::Constant::create(element::f32, Shape{2}, {3, 4});
+    auto add = make_shared<op::v1::Add>(a, b);
+    auto neg = make_shared<op::Negative>(make_shared<op::v1::Add>(add, b));
+    auto f = make_shared<Function>(neg, ParameterVector{});
+    weak_ptr<Node> weak_a = a;
+    weak_ptr<Node> weak_b = b;
+    a.reset();
+    b.reset();
+    add.reset();
+    neg.reset();
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    EXPECT_TRUE(weak_a.expired());
+    EXPECT_TRUE(weak_b.expired());
+    EXPECT_EQ(get_result_constant<float>(f, 0), (vector<float>{-7, -10}));
+}
@@ -0,0 +1,172 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/function_evaluator.hpp"
+#include "ngraph/op/util/variable.hpp"
+#include "ngraph/op/util/variable_context.hpp"
+#include "ngraph/opsets/opset7.hpp"
+#include "ngraph/runtime/host_tensor.hpp"
+#include "util/parallel_for_guard.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    shared_ptr<Function> make_chain(size_t length)
+    {
+        auto p = make_shared<opset7::Parameter>(element::f32, Shape{2, 8});
+        Output<Node> value = p;
+        for (size_t i = 0; i < length; ++i)
+        {
+            auto c = opset7::Constant::create(element::f32, Shape{}, {1.0f});
+            value = make_shared<opset7::Add>(make_shared<opset7::Relu>(value), c);
+        }
+        return make_shared<Function>(OutputVector{value}, ParameterVector{p});
+    }
+
+    shared_ptr<Function> make_branches(size_t width)
+    {
+        auto p = make_shared<opset7::Parameter>(element::f32, Shape{4});
+        OutputVector branches;
+        for (size_t i = 0; i < width; ++i)
+        {
+            auto c = opset7::Constant::create(element::f32, Shape{4}, {1.0f * i});
+            branches.push_back(make_shared<opset7::Multiply>(make_shared<opset7::Abs>(p), c));
+        }
+        auto concat = make_shared<opset7::Concat>(branches, 0);
+        return make_shared<Function>(OutputVector{concat, branches[0]}, ParameterVector{p});
+    }
+
+    vector<float> iota_vector(size_t size, float start)
+    {
+        vector<float> values(size);
+        for (size_t i = 0; i < size; ++i)
+        {
+            values[i] = start + i;
+        }
+        return values;
+    }
+} // namespace
+
+TEST(function_evaluator, matches_function_evaluate)
+{
+    auto f = make_chain(6);
+    FunctionEvaluator evaluator(f);
+    for (float start : {-5.0f, 3.0f})
+    {
+        const auto input = make_host_tensor<element::Type_t::f32>(Shape{2, 8},
+                                                                  iota_vector(16, start));
+        auto expected = make_shared<HostTensor>();
+        ASSERT_TRUE(f->evaluate({expected}, {input}));
+        auto result = make_shared<HostTensor>();
+        ASSERT_TRUE(evaluator.evaluate({result}, {input}));
+        EXPECT_EQ(result->get_shape(), (Shape{2, 8}));
+        EXPECT_EQ(read_vector<float>(result), read_vector<float>(expected));
+    }
+}
+
+TEST(function_evaluator, reuses_buffers)
+{
+    // Each intermediate is consumed by the next node only, so two buffers are enough
+    FunctionEvaluator evaluator(make_chain(10));
+    EXPECT_EQ(evaluator.get_intermediate_buffers_size(), 2 * 16 * sizeof(float));
+}
+
+TEST(function_evaluator, parallel_levels)
+{
+    auto f = make_branches(8);
+    FunctionEvaluator evaluator(f, 4);
+    // Abs, Multiply, Concat and the Results
+    EXPECT_EQ(evaluator.get_level_count(), 4);
+
+    const auto input =
+        make_host_tensor<element::Type_t::f32>(Shape{4}, vector<float>{-1, 2, -3, 4});
+    auto expected = make_shared<HostTensor>();
+    auto expected_branch = make_shared<HostTensor>();
+    ASSERT_TRUE(f->evaluate({expected, expected_branch}, {input}));
+    for (int i = 0; i < 3; ++i)
+    {
+        auto result = make_shared<HostTensor>();
+        auto result_branch = make_shared<HostTensor>();
+        ASSERT_TRUE(evaluator.evaluate({result, result_branch}, {input}));
+        EXPECT_EQ(read_vector<float>(result), read_vector<float>(expected));
+        EXPECT_EQ(read_vector<float>(result_branch), read_vector<float>(expected_branch));
+    }
+}
+
+TEST(function_evaluator, parallel_levels_on_backend)
+{
+    auto f = make_branches(8);
+    FunctionEvaluator evaluator(f, 4);
+    const auto input =
+        make_host_tensor<element::Type_t::f32>(Shape{4}, vector<float>{-1, 2, -3, 4});
+    auto expected = make_shared<HostTensor>();
+    auto expected_branch = make_shared<HostTensor>();
+    ASSERT_TRUE(f->evaluate({expected, expected_branch}, {input}));
+
+    // The nodes of a level run on the threads of the backend
+    auto result = make_shared<HostTensor>();
+    auto result_branch = make_shared<HostTensor>();
+    {
+        test::ParallelForGuard guard;
+        EXPECT_NO_THROW(evaluator.evaluate({result, result_branch}, {input}));
+    }
+    EXPECT_EQ(read_vector<float>(result), read_vector<float>(expected));
+    EXPECT_EQ(read_vector<float>(result_branch), read_vector<float>(expected_branch));
+}
+
+TEST(function_evaluator, dynamic_shapes)
+{
+    auto p = make_shared<opset7::Parameter>(element::f32, PartialShape::dynamic(2));
+    auto relu = make_shared<opset7::Relu>(p);
+    auto shape_of = make_shared<opset7::ShapeOf>(relu);
+    auto f = make_shared<Function>(OutputVector{relu, shape_of}, ParameterVector{p});
+    FunctionEvaluator evaluator(f, 2);
+    // Only the output of ShapeOf has a static shape
+    EXPECT_EQ(evaluator.get_intermediate_buffers_size(), 2 * sizeof(int64_t));
+
+    for (size_t rows : {1, 3})
+    {
+        auto result = make_shared<HostTensor>();
+        auto result_shape = make_shared<HostTensor>();
+        ASSERT_TRUE(evaluator.evaluate(
+            {result, result_shape},
+            {make_host_tensor<element::Type_t::f32>(Shape{rows, 2},
+                                                    iota_vector(rows * 2, -2.0f))}));
+        EXPECT_EQ(result->get_shape(), (Shape{rows, 2}));
+        EXPECT_EQ(read_vector<int64_t>(result_shape), (vector<int64_t>{int64_t(rows), 2}));
+    }
+}
+
+TEST(function_evaluator, variables)
+{
+    auto p = make_shared<opset7::Parameter>(element::f32, Shape{3});
+    auto c = opset7::Constant::create(element::f32, Shape{3}, {0.0f, 0.0f, 0.0f});
+    auto variable =
+        make_shared<Variable>(VariableInfo{PartialShape::dynamic(), element::dynamic, "var_1"});
+    auto read_value = make_shared<opset7::ReadValue>(c, variable);
+    auto add = make_shared<opset7::Add>(p, read_value);
+    auto assign = make_shared<opset7::Assign>(add, variable);
+    auto f = make_shared<Function>(
+        OutputVector{add}, SinkVector{assign}, ParameterVector{p}, VariableVector{variable});
+    FunctionEvaluator evaluator(f, 2);
+
+    EvaluationContext context;
+    context["VariableContext"] = make_shared<VariantWrapper<VariableContext>>(VariableContext());
+    const auto input =
+        make_host_tensor<element::Type_t::f32>(Shape{3}, vector<float>{1, 1, 1});
+    // The variable accumulates the inputs between the evaluations
+    for (float expected : {1.0f, 2.0f, 3.0f})
+    {
+        auto result = make_shared<HostTensor>();
+        ASSERT_TRUE(evaluator.evaluate({result}, {input}, context));
+        EXPECT_EQ(read_vector<float>(result), (vector<float>{expected, expected, expected}));
+    }
+}
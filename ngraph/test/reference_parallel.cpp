@@ -0,0 +1,197 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <atomic>
+#include <functional>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/runtime/opt_kernel/reshape.hpp"
+#include "ngraph/runtime/parallel.hpp"
+#include "ngraph/runtime/reference/autobroadcast_binop.hpp"
+#include "ngraph/runtime/reference/convert.hpp"
+#include "ngraph/runtime/reference/convolution.hpp"
+#include "ngraph/runtime/reference/gather.hpp"
+#include "ngraph/runtime/reference/matmul.hpp"
+#include "util/parallel_for_guard.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    class reference_parallel : public ::testing::Test
+    {
+    protected:
+        // Runs the kernel serially and with the threads, the results must be the same
+        template <typename T>
+        void compare(size_t size, const function<void(T*)>& kernel)
+        {
+            vector<T> expected(size);
+            {
+                test::ParallelForGuard serial(nullptr);
+                kernel(expected.data());
+            }
+
+            vector<T> result(size);
+            {
+                test::ParallelForGuard threads;
+                kernel(result.data());
+            }
+            EXPECT_EQ(result, expected);
+        }
+
+        static vector<float> iota_vector(size_t size)
+        {
+            vector<float> values(size);
+            for (size_t i = 0; i < size; ++i)
+            {
+                values[i] = static_cast<float>(i % 97) - 48.0f;
+            }
+            return values;
+        }
+    };
+} // namespace
+
+TEST_F(reference_parallel, parallel_for_ranges)
+{
+    test::ParallelForGuard guard;
+    constexpr size_t work_amount = 1000;
+    constexpr size_t grain_size = 64;
+    vector<atomic<int>> visits(work_amount);
+    atomic<size_t> tasks{0};
+    runtime::parallel_for(work_amount, grain_size, [&](size_t begin, size_t end) {
+        EXPECT_GE(end - begin, grain_size);
+        for (size_t i = begin; i < end; ++i)
+        {
+            visits[i]++;
+        }
+        tasks++;
+    });
+    EXPECT_GT(tasks, 1);
+    for (const auto& v : visits)
+    {
+        EXPECT_EQ(v, 1);
+    }
+
+    // Loops smaller than two grains run on the calling thread
+    const auto caller = this_thread::get_id();
+    runtime::parallel_for(work_amount, work_amount, [&](size_t begin, size_t end) {
+        EXPECT_EQ(this_thread::get_id(), caller);
+        EXPECT_EQ(begin, 0);
+        EXPECT_EQ(end, work_amount);
+    });
+}
+
+TEST_F(reference_parallel, convert)
+{
+    const auto input = iota_vector(100003);
+    compare<int32_t>(input.size(), [&](int32_t* out) {
+        runtime::reference::convert(input.data(), out, input.size());
+    });
+}
+
+TEST_F(reference_parallel, binop_broadcast)
+{
+    const Shape shape0{2, 64, 33, 17};
+    const Shape shape1{64, 1, 17};
+    const auto arg0 = iota_vector(shape_size(shape0));
+    const auto arg1 = iota_vector(shape_size(shape1));
+    auto multiply = [&](float* out) {
+        runtime::reference::autobroadcast_binop(arg0.data(),
+                                                arg1.data(),
+                                                out,
+                                                shape0,
+                                                shape1,
+                                                op::AutoBroadcastType::NUMPY,
+                                                [](float a, float b) { return a * b; });
+    };
+    compare<float>(shape_size(shape0), multiply);
+
+    vector<float> result(shape_size(shape0));
+    multiply(result.data());
+    for (size_t i = 0; i < result.size(); ++i)
+    {
+        const size_t c = (i / (33 * 17)) % 64;
+        const size_t x = i % 17;
+        ASSERT_EQ(result[i], arg0[i] * arg1[c * 17 + x]) << "at index " << i;
+    }
+    compare<float>(shape_size(shape0), [&](float* out) {
+        runtime::reference::autobroadcast_binop(arg0.data(),
+                                                arg0.data(),
+                                                out,
+                                                shape0,
+                                                shape0,
+                                                op::AutoBroadcastType::NONE,
+                                                [](float a, float b) { return a - b; });
+    });
+}
+
+TEST_F(reference_parallel, transpose)
+{
+    const Shape shape{3, 40, 50, 70};
+    const AxisVector order{2, 0, 3, 1};
+    const auto input = iota_vector(shape_size(shape));
+    compare<float>(input.size(), [&](float* out) {
+        runtime::opt_kernel::reshape(reinterpret_cast<const char*>(input.data()),
+                                     reinterpret_cast<char*>(out),
+                                     shape,
+                                     order,
+                                     Shape{50, 3, 70, 40},
+                                     sizeof(float));
+    });
+}
+
+TEST_F(reference_parallel, matmul)
+{
+    const Shape shape0{3, 1, 67, 45};
+    const Shape shape1{2, 53, 45};
+    const Shape out_shape{3, 2, 67, 53};
+    const auto arg0 = iota_vector(shape_size(shape0));
+    const auto arg1 = iota_vector(shape_size(shape1));
+    compare<float>(shape_size(out_shape), [&](float* out) {
+        runtime::reference::matmul(
+            arg0.data(), arg1.data(), out, shape0, shape1, out_shape, false, true);
+    });
+}
+
+TEST_F(reference_parallel, convolution)
+{
+    const Shape in_shape{2, 8, 20, 20};
+    const Shape f_shape{16, 8, 3, 3};
+    const Shape out_shape{2, 16, 18, 18};
+    const auto input = iota_vector(shape_size(in_shape));
+    const auto filters = iota_vector(shape_size(f_shape));
+    compare<float>(shape_size(out_shape), [&](float* out) {
+        runtime::reference::convolution(input.data(),
+                                        filters.data(),
+                                        out,
+                                        in_shape,
+                                        f_shape,
+                                        out_shape,
+                                        Strides{1, 1},
+                                        Strides{1, 1},
+                                        CoordinateDiff{0, 0},
+                                        CoordinateDiff{0, 0});
+    });
+}
+
+TEST_F(reference_parallel, gather)
+{
+    const Shape data_shape{4, 300, 200};
+    const Shape indices_shape{4, 150};
+    const Shape out_shape{4, 150, 200};
+    const auto data = iota_vector(shape_size(data_shape));
+    vector<int32_t> indices(shape_size(indices_shape));
+    for (size_t i = 0; i < indices.size(); ++i)
+    {
+        indices[i] = static_cast<int32_t>((i * 7) % 300) - 150;
+    }
+    compare<float>(shape_size(out_shape), [&](float* out) {
+        runtime::reference::gather(
+            data.data(), indices.data(), out, data_shape, indices_shape, out_shape, 1, 1);
+    });
+}
@@ -0,0 +1,57 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include "ngraph/runtime/parallel.hpp"
+
+namespace ngraph
+{
+    namespace test
+    {
+        /// \brief Threading backend of the reference kernels for unit tests. Splits the work
+        ///        between up to four threads, so ranges run concurrently on any host.
+        inline void thread_parallel_for(size_t work_amount, const runtime::parallel_body_t& body)
+        {
+            const size_t threads_count = std::min<size_t>(work_amount, 4);
+            std::vector<std::thread> threads;
+            for (size_t i = 0; i < threads_count; ++i)
+            {
+                threads.emplace_back(body,
+                                     work_amount * i / threads_count,
+                                     work_amount * (i + 1) / threads_count);
+            }
+            for (auto& t : threads)
+            {
+                t.join();
+            }
+        }
+
+        /// \brief Install a threading backend of the reference kernels for the duration of a
+        ///        unit test.
+        ///
+        /// During creation this object installs the backend, when it's destroyed it restores
+        /// the previously installed one.
+        class ParallelForGuard
+        {
+        public:
+            explicit ParallelForGuard(runtime::parallel_for_t parallel_for = thread_parallel_for)
+            {
+                saved_parallel_for = runtime::get_parallel_for();
+                runtime::set_parallel_for(parallel_for);
+            }
+            ~ParallelForGuard() { runtime::set_parallel_for(saved_parallel_for); }
+
+            ParallelForGuard(const ParallelForGuard&) = delete;
+            ParallelForGuard& operator=(const ParallelForGuard&) = delete;
+
+        private:
+            runtime::parallel_for_t saved_parallel_for;
+        };
+    }
+}